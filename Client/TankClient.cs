@@ -16,6 +16,7 @@ namespace TankGame
         public float CurrentHealth { get; set; } // Added: Current health
         public float MaxHealth { get; set; } // Added: Maximum health
         public bool IsDestroyed { get; set; } // Added: Destruction status
+        public bool InRange { get; set; } // False after the server reports the tank outside the interest radius
 
         public TankInfo(int clientId, float posX = 0, float posY = 0, float direction = 0, int tankType = 0, float maxHealth = 100f)
         {
@@ -27,6 +28,7 @@ namespace TankGame
             MaxHealth = maxHealth;
             CurrentHealth = maxHealth; // Initial health is set to maximum health
             IsDestroyed = false;
+            InRange = true;
         }
     }
 
@@ -46,6 +48,62 @@ namespace TankGame
         // Information of other tanks
         private Dictionary<int, TankInfo> otherTanks = new Dictionary<int, TankInfo>();
 
+        // Room slot -> client ID table for compact snapshots (filled by OnRoomSlots)
+        private Dictionary<int, int> roomSlots = new Dictionary<int, int>();
+
+        // Compact movement quantization (must match Server_CPP/src/CompactMove.h)
+        private const float CompactMapOriginX = 50.0f;
+        private const float CompactMapOriginY = 50.0f;
+        private const float CompactPositionScale = 64.0f;
+
+        // Quantized tank state carried by delta snapshots (see Server_CPP/src/DeltaSnapshot.h)
+        private struct DeltaTankState
+        {
+            public short PosX;
+            public short PosY;
+            public byte Direction;
+            public bool IsDestroyed;
+            public int TankType;
+            public float CurrentHealth;
+            public float MaxHealth;
+        }
+
+        // Room states of delta snapshot ticks that may still be used as a baseline (tick -> client ID -> state)
+        private Dictionary<int, Dictionary<int, DeltaTankState>> deltaStates = new Dictionary<int, Dictionary<int, DeltaTankState>>();
+
+        // Latest delta snapshot tick applied (snapshots are unreliable and may arrive out of order)
+        private int latestDeltaTick = 0;
+
+        // Latest snapshot tick applied per tank, so a late unreliable snapshot never moves a tank back
+        private Dictionary<int, int> positionTicks = new Dictionary<int, int>();
+
+        // Linear model of another tank built from the snapshot entries received for it (velocity per server tick)
+        private struct PositionModel
+        {
+            public float PosX;
+            public float PosY;
+            public float VelX;
+            public float VelY;
+            public int TickId;
+        }
+
+        // Extrapolate other tanks between snapshot entries (must match the server's --dead-reckoning, which
+        // only sends a position once the same extrapolation drifts past its threshold; see Server_CPP/src/DeadReckoning.h)
+        public bool ExtrapolateRemoteTanks { get; set; }
+        private Dictionary<int, PositionModel> positionModels = new Dictionary<int, PositionModel>();
+        private int latestPositionTick = 0;
+
+        // Counter sent with each unreliable move so the server can drop late ones
+        private ushort moveSequence = 0;
+
+        // Last move is resent reliably once the tank has been still for IdleResendMs, in case the unreliable one was lost
+        private const int IdleResendMs = 100;
+        private bool idleResendPending = false;
+        private int lastMoveTickCount = 0;
+        private short lastMovePosX = 0;
+        private short lastMovePosY = 0;
+        private byte lastMoveDirection = 0;
+
         // Local tank information
         private TankInfo localTank;
 
@@ -130,6 +188,212 @@ namespace TankGame
                 return true;
             };
 
+            // Handle per-tick position snapshots (16 bytes per tank: clientId, posX, posY, direction)
+            tankStub.OnTankSnapshot = (remote, rmiContext, tickId, snapshot) =>
+            {
+                lock (syncObj)
+                {
+                    byte[] data = snapshot.ToArray();
+                    int localId = (int)netClient.GetLocalHostID();
+
+                    for (int offset = 0; offset + 16 <= data.Length; offset += 16)
+                    {
+                        int clientId = BitConverter.ToInt32(data, offset);
+                        float posX = BitConverter.ToSingle(data, offset + 4);
+                        float posY = BitConverter.ToSingle(data, offset + 8);
+                        float direction = BitConverter.ToSingle(data, offset + 12);
+
+                        // Own tank position is authoritative on the client
+                        if (clientId == localId || !AcceptPositionTick(clientId, tickId))
+                            continue;
+
+                        if (otherTanks.ContainsKey(clientId))
+                        {
+                            otherTanks[clientId].PosX = posX;
+                            otherTanks[clientId].PosY = posY;
+                            otherTanks[clientId].Direction = direction;
+                            otherTanks[clientId].InRange = true;
+                            RecordPositionSample(clientId, tickId, posX, posY);
+                        }
+                    }
+
+                    ExtrapolateOtherTanks(tickId);
+                }
+                return true;
+            };
+
+            // Handle tanks leaving the interest radius (4 bytes per tank: clientId)
+            tankStub.OnTanksOutOfRange = (remote, rmiContext, tickId, clientIds) =>
+            {
+                lock (syncObj)
+                {
+                    byte[] data = clientIds.ToArray();
+                    for (int offset = 0; offset + 4 <= data.Length; offset += 4)
+                    {
+                        int clientId = BitConverter.ToInt32(data, offset);
+
+                        // Also drops older snapshot entries for this tank still in flight on the unreliable channel
+                        if (!AcceptPositionTick(clientId, tickId))
+                            continue;
+
+                        TankInfo tank;
+                        if (otherTanks.TryGetValue(clientId, out tank))
+                            tank.InRange = false;
+                        positionModels.Remove(clientId); // Stop extrapolating until the tank is back in range
+                    }
+                }
+                return true;
+            };
+
+            // Handle room slot table updates (slot:varint, clientId:int)
+            tankStub.OnRoomSlots = (remote, rmiContext, slots) =>
+            {
+                lock (syncObj)
+                {
+                    byte[] data = slots.ToArray();
+                    int offset = 0;
+                    while (offset < data.Length)
+                    {
+                        int slot = ReadVarInt(data, ref offset);
+                        if (slot < 0 || offset + 4 > data.Length)
+                            break;
+                        roomSlots[slot] = BitConverter.ToInt32(data, offset);
+                        offset += 4;
+                    }
+                }
+                return true;
+            };
+
+            // Handle compact per-tick position snapshots (slot:varint, posX:short, posY:short, direction:byte)
+            tankStub.OnTankSnapshotCompact = (remote, rmiContext, tickId, snapshot) =>
+            {
+                lock (syncObj)
+                {
+                    byte[] data = snapshot.ToArray();
+                    int localId = (int)netClient.GetLocalHostID();
+                    int offset = 0;
+                    while (offset < data.Length)
+                    {
+                        int slot = ReadVarInt(data, ref offset);
+                        if (slot < 0 || offset + 5 > data.Length)
+                            break;
+                        float posX = CompactMapOriginX + BitConverter.ToInt16(data, offset) / CompactPositionScale;
+                        float posY = CompactMapOriginY + BitConverter.ToInt16(data, offset + 2) / CompactPositionScale;
+                        float direction = data[offset + 4] * (360.0f / 256.0f);
+                        offset += 5;
+
+                        int clientId;
+                        if (!roomSlots.TryGetValue(slot, out clientId) || clientId == localId
+                            || !AcceptPositionTick(clientId, tickId))
+                            continue;
+
+                        if (otherTanks.ContainsKey(clientId))
+                        {
+                            otherTanks[clientId].PosX = posX;
+                            otherTanks[clientId].PosY = posY;
+                            otherTanks[clientId].Direction = direction;
+                            otherTanks[clientId].InRange = true;
+                            RecordPositionSample(clientId, tickId, posX, posY);
+                        }
+                    }
+
+                    ExtrapolateOtherTanks(tickId);
+                }
+                return true;
+            };
+
+            // Handle delta snapshots: rebuild the room state from the baseline tick, apply it and acknowledge the tick
+            tankStub.OnTankDeltaSnapshot = (remote, rmiContext, tickId, baselineTickId, delta) =>
+            {
+                lock (syncObj)
+                {
+                    if (tickId <= latestDeltaTick)
+                        return true; // Late or duplicated snapshot
+
+                    Dictionary<int, DeltaTankState> baseline;
+                    if (baselineTickId == 0)
+                        baseline = new Dictionary<int, DeltaTankState>();
+                    else if (!deltaStates.TryGetValue(baselineTickId, out baseline))
+                        return true; // Baseline already discarded; the server falls back to a full snapshot
+
+                    var states = new Dictionary<int, DeltaTankState>(baseline);
+                    if (!ApplyDelta(delta.ToArray(), states))
+                        return true;
+
+                    // The server never goes back to a baseline older than the one it just used
+                    var stale = new List<int>();
+                    foreach (int tick in deltaStates.Keys)
+                    {
+                        if (tick < baselineTickId)
+                            stale.Add(tick);
+                    }
+                    foreach (int tick in stale)
+                        deltaStates.Remove(tick);
+                    deltaStates[tickId] = states;
+                    latestDeltaTick = tickId;
+
+                    int localId = (int)netClient.GetLocalHostID();
+                    foreach (var pair in states)
+                    {
+                        if (pair.Key == localId)
+                            continue;
+
+                        TankInfo tank;
+                        if (!otherTanks.TryGetValue(pair.Key, out tank))
+                        {
+                            tank = new TankInfo(pair.Key);
+                            otherTanks[pair.Key] = tank;
+                        }
+                        tank.PosX = CompactMapOriginX + pair.Value.PosX / CompactPositionScale;
+                        tank.PosY = CompactMapOriginY + pair.Value.PosY / CompactPositionScale;
+                        tank.Direction = pair.Value.Direction * (360.0f / 256.0f);
+                        tank.TankType = pair.Value.TankType;
+                        tank.CurrentHealth = pair.Value.CurrentHealth;
+                        tank.MaxHealth = pair.Value.MaxHealth;
+                        tank.IsDestroyed = pair.Value.IsDestroyed;
+                    }
+                }
+
+                tankProxy.SendSnapshotAck(HostID.HostID_Server, RmiContext.UnreliableSend, tickId);
+                return true;
+            };
+
+            // Handle the full room state sent once after joining (32 bytes per tank:
+            // clientId, posX, posY, direction, tankType, currentHealth, maxHealth, flags)
+            tankStub.OnWorldSnapshot = (remote, rmiContext, tickId, world) =>
+            {
+                lock (syncObj)
+                {
+                    byte[] data = world.ToArray();
+                    int localId = (int)netClient.GetLocalHostID();
+
+                    for (int offset = 0; offset + 32 <= data.Length; offset += 32)
+                    {
+                        int clientId = BitConverter.ToInt32(data, offset);
+                        TankInfo tank = clientId == localId ? localTank : new TankInfo(clientId);
+                        tank.ClientId = clientId;
+                        tank.PosX = BitConverter.ToSingle(data, offset + 4);
+                        tank.PosY = BitConverter.ToSingle(data, offset + 8);
+                        tank.Direction = BitConverter.ToSingle(data, offset + 12);
+                        tank.TankType = BitConverter.ToInt32(data, offset + 16);
+                        tank.CurrentHealth = BitConverter.ToSingle(data, offset + 20);
+                        tank.MaxHealth = BitConverter.ToSingle(data, offset + 24);
+                        tank.IsDestroyed = (BitConverter.ToUInt32(data, offset + 28) & 1) != 0;
+
+                        if (clientId != localId)
+                        {
+                            otherTanks[clientId] = tank;
+                            positionTicks[clientId] = tickId;
+                            positionModels.Remove(clientId);
+                            RecordPositionSample(clientId, tickId, tank.PosX, tank.PosY);
+                        }
+                    }
+
+                    Console.WriteLine($"OnWorldSnapshot: {data.Length / 32} tanks in room (tick {tickId})");
+                }
+                return true;
+            };
+
             // Handle bullet firing
             tankStub.OnSpawnBullet = (remote, rmiContext, clientId, shooterId, posX, posY, direction, launchForce, fireX, fireY, fireZ) =>
             {
@@ -177,6 +441,7 @@ namespace TankGame
                 lock (syncObj)
                 {
                     // Remove left tank information
+                    positionModels.Remove(clientId);
                     if (otherTanks.ContainsKey(clientId))
                     {
                         otherTanks.Remove(clientId);
@@ -311,6 +576,7 @@ namespace TankGame
                 lock (syncObj)
                 {
                     Console.WriteLine($"OnTankSpawned: Tank {clientId} spawned at ({posX},{posY}) with type {tankType} and health {initialHealth}");
+                    positionModels.Remove(clientId); // Teleport: restart the extrapolation without velocity
 
                     if (clientId == (int)netClient.GetLocalHostID())
                     {
@@ -362,6 +628,9 @@ namespace TankGame
                     localTank.ClientId = (int)netClient.GetLocalHostID();
 
                     Console.WriteLine($"Connected to server. My ID: {localTank.ClientId}");
+
+                    // Announce protocol revision so the server switches this client to compact movement
+                    tankProxy.SendHello(HostID.HostID_Server, RmiContext.ReliableSend, Vars.ProtocolRevision);
                 }
                 else
                 {
@@ -446,9 +715,27 @@ namespace TankGame
 
 
 
-                // Send movement request to server
-                tankProxy.SendMove(HostID.HostID_Server, RmiContext.ReliableSend,
-                    posX, posY, direction);
+                // Send quantized movement request to server (1/64 unit positions, 360/256 degree direction)
+                // Unreliable, so a lost move never delays the newer ones; the sequence lets the server drop late ones
+                lock (syncObj)
+                {
+                    // Outside the int16 range the quantized position would be clamped, so send the float position reliably
+                    if (!CompactPositionInRange(posX, CompactMapOriginX) || !CompactPositionInRange(posY, CompactMapOriginY))
+                    {
+                        tankProxy.SendMove(HostID.HostID_Server, RmiContext.ReliableSend, posX, posY, direction);
+                        idleResendPending = false;
+                    }
+                    else
+                    {
+                        lastMovePosX = QuantizePosition(posX, CompactMapOriginX);
+                        lastMovePosY = QuantizePosition(posY, CompactMapOriginY);
+                        lastMoveDirection = QuantizeDirection(direction);
+                        tankProxy.SendMoveSequenced(HostID.HostID_Server, RmiContext.UnreliableSend, ++moveSequence,
+                            lastMovePosX, lastMovePosY, lastMoveDirection);
+                        idleResendPending = true;
+                        lastMoveTickCount = Environment.TickCount;
+                    }
+                }
 
 
 
@@ -460,6 +747,176 @@ namespace TankGame
             }
         }
 
+        // Resend the last position reliably (with a new sequence number) after the tank stopped moving
+        private void ResendIdlePosition()
+        {
+            lock (syncObj)
+            {
+                if (!isConnected || !idleResendPending || Environment.TickCount - lastMoveTickCount < IdleResendMs)
+                    return;
+
+                idleResendPending = false;
+                tankProxy.SendMoveSequenced(HostID.HostID_Server, RmiContext.ReliableSend, ++moveSequence,
+                    lastMovePosX, lastMovePosY, lastMoveDirection);
+            }
+        }
+
+        // Update the linear model of a tank from a snapshot entry (velocity = change since the previous entry / ticks)
+        private void RecordPositionSample(int clientId, int tickId, float posX, float posY)
+        {
+            PositionModel model;
+            if (positionModels.TryGetValue(clientId, out model) && tickId > model.TickId)
+            {
+                model.VelX = (posX - model.PosX) / (tickId - model.TickId);
+                model.VelY = (posY - model.PosY) / (tickId - model.TickId);
+            }
+            else
+            {
+                model = new PositionModel();
+            }
+            model.PosX = posX;
+            model.PosY = posY;
+            model.TickId = tickId;
+            positionModels[clientId] = model;
+        }
+
+        // Move tanks that were not in this snapshot along their model to the snapshot's tick
+        private void ExtrapolateOtherTanks(int tickId)
+        {
+            if (!ExtrapolateRemoteTanks || tickId <= latestPositionTick)
+                return;
+            latestPositionTick = tickId;
+
+            foreach (var pair in positionModels)
+            {
+                TankInfo tank;
+                if (!otherTanks.TryGetValue(pair.Key, out tank))
+                    continue;
+                int elapsed = tickId - pair.Value.TickId;
+                tank.PosX = pair.Value.PosX + pair.Value.VelX * elapsed;
+                tank.PosY = pair.Value.PosY + pair.Value.VelY * elapsed;
+            }
+        }
+
+        // Accept a snapshot entry only if it is newer than the last one applied to that tank
+        private bool AcceptPositionTick(int clientId, int tickId)
+        {
+            int lastTick;
+            if (positionTicks.TryGetValue(clientId, out lastTick) && tickId <= lastTick)
+                return false;
+            positionTicks[clientId] = tickId;
+            return true;
+        }
+
+        // Map-relative fixed point position (clamped to the int16 range)
+        private static short QuantizePosition(float value, float origin)
+        {
+            float scaled = (float)Math.Round((value - origin) * CompactPositionScale);
+            return (short)Math.Max(short.MinValue, Math.Min(short.MaxValue, scaled));
+        }
+
+        // Whether QuantizePosition keeps the position without clamping it
+        private static bool CompactPositionInRange(float value, float origin)
+        {
+            float scaled = (float)Math.Round((value - origin) * CompactPositionScale);
+            return scaled >= short.MinValue && scaled <= short.MaxValue;
+        }
+
+        // Direction in 360/256 degree steps (wrapped into one turn)
+        private static byte QuantizeDirection(float degrees)
+        {
+            double turns = degrees / 360.0;
+            turns -= Math.Floor(turns);
+            return (byte)((int)Math.Round(turns * 256.0) & 0xFF);
+        }
+
+        // Apply a delta snapshot (clientId:varint, mask:byte, masked fields) to a copy of the baseline state
+        private static bool ApplyDelta(byte[] data, Dictionary<int, DeltaTankState> states)
+        {
+            int offset = 0;
+            while (offset < data.Length)
+            {
+                int clientId = ReadVarInt(data, ref offset);
+                if (clientId < 0 || offset >= data.Length)
+                    return false;
+                byte mask = data[offset++];
+
+                if ((mask & 0x80) != 0)
+                {
+                    states.Remove(clientId);
+                    continue;
+                }
+
+                DeltaTankState state;
+                states.TryGetValue(clientId, out state);
+                int value;
+                if ((mask & 0x01) != 0)
+                {
+                    if (!ReadZigZag(data, ref offset, out value))
+                        return false;
+                    state.PosX = (short)(state.PosX + value);
+                }
+                if ((mask & 0x02) != 0)
+                {
+                    if (!ReadZigZag(data, ref offset, out value))
+                        return false;
+                    state.PosY = (short)(state.PosY + value);
+                }
+                if ((mask & 0x04) != 0)
+                {
+                    if (offset >= data.Length)
+                        return false;
+                    state.Direction = (byte)(state.Direction + data[offset++]);
+                }
+                if ((mask & 0x08) != 0)
+                {
+                    if (!ReadZigZag(data, ref offset, out value))
+                        return false;
+                    state.TankType = value;
+                }
+                if ((mask & 0x10) != 0)
+                {
+                    if (offset + 4 > data.Length)
+                        return false;
+                    state.CurrentHealth = BitConverter.ToSingle(data, offset);
+                    offset += 4;
+                }
+                if ((mask & 0x20) != 0)
+                {
+                    if (offset + 4 > data.Length)
+                        return false;
+                    state.MaxHealth = BitConverter.ToSingle(data, offset);
+                    offset += 4;
+                }
+                if ((mask & 0x40) != 0)
+                    state.IsDestroyed = !state.IsDestroyed;
+                states[clientId] = state;
+            }
+            return true;
+        }
+
+        // Zigzag-encoded signed varint (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+        private static bool ReadZigZag(byte[] data, ref int offset, out int value)
+        {
+            int raw = ReadVarInt(data, ref offset);
+            value = (int)((uint)raw >> 1) ^ -(raw & 1);
+            return raw >= 0;
+        }
+
+        // Unsigned LEB128 varint, returns -1 if truncated
+        private static int ReadVarInt(byte[] data, ref int offset)
+        {
+            int value = 0;
+            for (int shift = 0; shift < 35 && offset < data.Length; shift += 7)
+            {
+                byte b = data[offset++];
+                value |= (b & 0x7F) << shift;
+                if ((b & 0x80) == 0)
+                    return value;
+            }
+            return -1;
+        }
+
         // Request fire
         private void RequestFire(float direction, float launchForce = 25.0f)
         {
@@ -636,6 +1093,7 @@ namespace TankGame
                 {
                     // Process network periodically
                     netClient.FrameMove();
+                    ResendIdlePosition();
                     Thread.Sleep(10); // Control CPU usage
                 }
             });
@@ -952,6 +1410,7 @@ namespace TankGame
         static void Main(string[] args)
         {
             TankClient client = new TankClient();
+            client.ExtrapolateRemoteTanks = Array.IndexOf(args, "--dead-reckoning") >= 0;
             client.Run();
         }
     }
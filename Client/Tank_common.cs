@@ -27,6 +27,16 @@ namespace Tank
 			public const Nettention.Proud.RmiID OnTankSpawned = (Nettention.Proud.RmiID)2000+12;
 			public const Nettention.Proud.RmiID OnSpawnBullet = (Nettention.Proud.RmiID)2000+13;
 			public const Nettention.Proud.RmiID P2PMessage = (Nettention.Proud.RmiID)2000+14;
+			public const Nettention.Proud.RmiID OnTankSnapshot = (Nettention.Proud.RmiID)2000+15;
+			public const Nettention.Proud.RmiID SendHello = (Nettention.Proud.RmiID)2000+16;
+			public const Nettention.Proud.RmiID OnTanksOutOfRange = (Nettention.Proud.RmiID)2000+17;
+			public const Nettention.Proud.RmiID OnWorldSnapshot = (Nettention.Proud.RmiID)2000+18;
+			public const Nettention.Proud.RmiID SendMoveCompact = (Nettention.Proud.RmiID)2000+19;
+			public const Nettention.Proud.RmiID OnRoomSlots = (Nettention.Proud.RmiID)2000+20;
+			public const Nettention.Proud.RmiID OnTankSnapshotCompact = (Nettention.Proud.RmiID)2000+21;
+			public const Nettention.Proud.RmiID OnTankDeltaSnapshot = (Nettention.Proud.RmiID)2000+22;
+			public const Nettention.Proud.RmiID SendSnapshotAck = (Nettention.Proud.RmiID)2000+23;
+			public const Nettention.Proud.RmiID SendMoveSequenced = (Nettention.Proud.RmiID)2000+24;
 		// List that has RMI ID.
 		public static Nettention.Proud.RmiID[] RmiIDList = new Nettention.Proud.RmiID[] {
 			SendMove,
@@ -43,6 +53,16 @@ namespace Tank
 			OnTankSpawned,
 			OnSpawnBullet,
 			P2PMessage,
+			OnTankSnapshot,
+			SendHello,
+			OnTanksOutOfRange,
+			OnWorldSnapshot,
+			SendMoveCompact,
+			OnRoomSlots,
+			OnTankSnapshotCompact,
+			OnTankDeltaSnapshot,
+			SendSnapshotAck,
+			SendMoveSequenced,
 		};
 	}
 }
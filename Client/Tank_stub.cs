@@ -86,6 +86,56 @@ public BeforeRmiInvocationDelegate BeforeRmiInvocation = delegate(Nettention.Pro
 		{ 
 			return false;
 		};
+		public delegate bool OnTankSnapshotDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray snapshot);  
+		public OnTankSnapshotDelegate OnTankSnapshot = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray snapshot)
+		{ 
+			return false;
+		};
+		public delegate bool SendHelloDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int protocolRevision);  
+		public SendHelloDelegate SendHello = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int protocolRevision)
+		{ 
+			return false;
+		};
+		public delegate bool OnTanksOutOfRangeDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray clientIds);  
+		public OnTanksOutOfRangeDelegate OnTanksOutOfRange = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray clientIds)
+		{ 
+			return false;
+		};
+		public delegate bool OnWorldSnapshotDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray world);  
+		public OnWorldSnapshotDelegate OnWorldSnapshot = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray world)
+		{ 
+			return false;
+		};
+		public delegate bool SendMoveCompactDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, System.Int16 posX, System.Int16 posY, System.Byte direction);  
+		public SendMoveCompactDelegate SendMoveCompact = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, System.Int16 posX, System.Int16 posY, System.Byte direction)
+		{ 
+			return false;
+		};
+		public delegate bool OnRoomSlotsDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, Nettention.Proud.ByteArray slots);  
+		public OnRoomSlotsDelegate OnRoomSlots = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, Nettention.Proud.ByteArray slots)
+		{ 
+			return false;
+		};
+		public delegate bool OnTankSnapshotCompactDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray snapshot);  
+		public OnTankSnapshotCompactDelegate OnTankSnapshotCompact = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray snapshot)
+		{ 
+			return false;
+		};
+		public delegate bool OnTankDeltaSnapshotDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, int baselineTickId, Nettention.Proud.ByteArray delta);  
+		public OnTankDeltaSnapshotDelegate OnTankDeltaSnapshot = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, int baselineTickId, Nettention.Proud.ByteArray delta)
+		{ 
+			return false;
+		};
+		public delegate bool SendSnapshotAckDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId);  
+		public SendSnapshotAckDelegate SendSnapshotAck = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId)
+		{ 
+			return false;
+		};
+		public delegate bool SendMoveSequencedDelegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, System.UInt16 sequence, System.Int16 posX, System.Int16 posY, System.Byte direction);  
+		public SendMoveSequencedDelegate SendMoveSequenced = delegate(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, System.UInt16 sequence, System.Int16 posX, System.Int16 posY, System.Byte direction)
+		{ 
+			return false;
+		};
 	public override bool ProcessReceivedMessage(Nettention.Proud.ReceivedMessage pa, Object hostTag) 
 	{
 		Nettention.Proud.HostID remote=pa.RemoteHostID;
@@ -143,6 +193,36 @@ public BeforeRmiInvocationDelegate BeforeRmiInvocation = delegate(Nettention.Pro
             break;
         case Common.P2PMessage:
             ProcessReceivedMessage_P2PMessage(__msg, pa, hostTag, remote);
+            break;
+        case Common.OnTankSnapshot:
+            ProcessReceivedMessage_OnTankSnapshot(__msg, pa, hostTag, remote);
+            break;
+        case Common.SendHello:
+            ProcessReceivedMessage_SendHello(__msg, pa, hostTag, remote);
+            break;
+        case Common.OnTanksOutOfRange:
+            ProcessReceivedMessage_OnTanksOutOfRange(__msg, pa, hostTag, remote);
+            break;
+        case Common.OnWorldSnapshot:
+            ProcessReceivedMessage_OnWorldSnapshot(__msg, pa, hostTag, remote);
+            break;
+        case Common.SendMoveCompact:
+            ProcessReceivedMessage_SendMoveCompact(__msg, pa, hostTag, remote);
+            break;
+        case Common.OnRoomSlots:
+            ProcessReceivedMessage_OnRoomSlots(__msg, pa, hostTag, remote);
+            break;
+        case Common.OnTankSnapshotCompact:
+            ProcessReceivedMessage_OnTankSnapshotCompact(__msg, pa, hostTag, remote);
+            break;
+        case Common.OnTankDeltaSnapshot:
+            ProcessReceivedMessage_OnTankDeltaSnapshot(__msg, pa, hostTag, remote);
+            break;
+        case Common.SendSnapshotAck:
+            ProcessReceivedMessage_SendSnapshotAck(__msg, pa, hostTag, remote);
+            break;
+        case Common.SendMoveSequenced:
+            ProcessReceivedMessage_SendMoveSequenced(__msg, pa, hostTag, remote);
             break;
 		default:
 			 goto __fail;
@@ -921,6 +1001,528 @@ core.PostCheckReadMessage(__msg, RmiName_P2PMessage);
         summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
         AfterRmiInvocation(summary);
         }
+    }
+    void ProcessReceivedMessage_OnTankSnapshot(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        int tickId; Nettention.Proud.Marshaler.Read(__msg,out tickId);	
+Nettention.Proud.ByteArray snapshot; Nettention.Proud.Marshaler.Read(__msg,out snapshot);	
+core.PostCheckReadMessage(__msg, RmiName_OnTankSnapshot);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=tickId.ToString()+",";
+parameterString+=snapshot.ToString()+",";
+        NotifyCallFromStub(Common.OnTankSnapshot, RmiName_OnTankSnapshot,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.OnTankSnapshot;
+        summary.rmiName = RmiName_OnTankSnapshot;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =OnTankSnapshot (remote,ctx , tickId, snapshot );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_OnTankSnapshot);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.OnTankSnapshot;
+        summary.rmiName = RmiName_OnTankSnapshot;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
+    }
+    void ProcessReceivedMessage_SendHello(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        int protocolRevision; Nettention.Proud.Marshaler.Read(__msg,out protocolRevision);	
+core.PostCheckReadMessage(__msg, RmiName_SendHello);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=protocolRevision.ToString()+",";
+        NotifyCallFromStub(Common.SendHello, RmiName_SendHello,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.SendHello;
+        summary.rmiName = RmiName_SendHello;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =SendHello (remote,ctx , protocolRevision );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_SendHello);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.SendHello;
+        summary.rmiName = RmiName_SendHello;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
+    }
+    void ProcessReceivedMessage_OnTanksOutOfRange(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        int tickId; Nettention.Proud.Marshaler.Read(__msg,out tickId);	
+Nettention.Proud.ByteArray clientIds; Nettention.Proud.Marshaler.Read(__msg,out clientIds);	
+core.PostCheckReadMessage(__msg, RmiName_OnTanksOutOfRange);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=tickId.ToString()+",";
+parameterString+=clientIds.ToString()+",";
+        NotifyCallFromStub(Common.OnTanksOutOfRange, RmiName_OnTanksOutOfRange,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.OnTanksOutOfRange;
+        summary.rmiName = RmiName_OnTanksOutOfRange;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =OnTanksOutOfRange (remote,ctx , tickId, clientIds );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_OnTanksOutOfRange);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.OnTanksOutOfRange;
+        summary.rmiName = RmiName_OnTanksOutOfRange;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
+    }
+    void ProcessReceivedMessage_OnWorldSnapshot(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        int tickId; Nettention.Proud.Marshaler.Read(__msg,out tickId);	
+Nettention.Proud.ByteArray world; Nettention.Proud.Marshaler.Read(__msg,out world);	
+core.PostCheckReadMessage(__msg, RmiName_OnWorldSnapshot);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=tickId.ToString()+",";
+parameterString+=world.ToString()+",";
+        NotifyCallFromStub(Common.OnWorldSnapshot, RmiName_OnWorldSnapshot,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.OnWorldSnapshot;
+        summary.rmiName = RmiName_OnWorldSnapshot;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =OnWorldSnapshot (remote,ctx , tickId, world );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_OnWorldSnapshot);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.OnWorldSnapshot;
+        summary.rmiName = RmiName_OnWorldSnapshot;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
+    }
+    void ProcessReceivedMessage_SendMoveCompact(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        System.Int16 posX; Nettention.Proud.Marshaler.Read(__msg,out posX);	
+System.Int16 posY; Nettention.Proud.Marshaler.Read(__msg,out posY);	
+System.Byte direction; Nettention.Proud.Marshaler.Read(__msg,out direction);	
+core.PostCheckReadMessage(__msg, RmiName_SendMoveCompact);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=posX.ToString()+",";
+parameterString+=posY.ToString()+",";
+parameterString+=direction.ToString()+",";
+        NotifyCallFromStub(Common.SendMoveCompact, RmiName_SendMoveCompact,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.SendMoveCompact;
+        summary.rmiName = RmiName_SendMoveCompact;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =SendMoveCompact (remote,ctx , posX, posY, direction );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_SendMoveCompact);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.SendMoveCompact;
+        summary.rmiName = RmiName_SendMoveCompact;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
+    }
+    void ProcessReceivedMessage_OnRoomSlots(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        Nettention.Proud.ByteArray slots; Nettention.Proud.Marshaler.Read(__msg,out slots);	
+core.PostCheckReadMessage(__msg, RmiName_OnRoomSlots);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=slots.ToString()+",";
+        NotifyCallFromStub(Common.OnRoomSlots, RmiName_OnRoomSlots,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.OnRoomSlots;
+        summary.rmiName = RmiName_OnRoomSlots;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =OnRoomSlots (remote,ctx , slots );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_OnRoomSlots);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.OnRoomSlots;
+        summary.rmiName = RmiName_OnRoomSlots;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
+    }
+    void ProcessReceivedMessage_OnTankSnapshotCompact(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        int tickId; Nettention.Proud.Marshaler.Read(__msg,out tickId);	
+Nettention.Proud.ByteArray snapshot; Nettention.Proud.Marshaler.Read(__msg,out snapshot);	
+core.PostCheckReadMessage(__msg, RmiName_OnTankSnapshotCompact);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=tickId.ToString()+",";
+parameterString+=snapshot.ToString()+",";
+        NotifyCallFromStub(Common.OnTankSnapshotCompact, RmiName_OnTankSnapshotCompact,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.OnTankSnapshotCompact;
+        summary.rmiName = RmiName_OnTankSnapshotCompact;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =OnTankSnapshotCompact (remote,ctx , tickId, snapshot );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_OnTankSnapshotCompact);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.OnTankSnapshotCompact;
+        summary.rmiName = RmiName_OnTankSnapshotCompact;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
+    }
+    void ProcessReceivedMessage_OnTankDeltaSnapshot(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        int tickId; Nettention.Proud.Marshaler.Read(__msg,out tickId);	
+int baselineTickId; Nettention.Proud.Marshaler.Read(__msg,out baselineTickId);	
+Nettention.Proud.ByteArray delta; Nettention.Proud.Marshaler.Read(__msg,out delta);	
+core.PostCheckReadMessage(__msg, RmiName_OnTankDeltaSnapshot);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=tickId.ToString()+",";
+parameterString+=baselineTickId.ToString()+",";
+parameterString+=delta.ToString()+",";
+        NotifyCallFromStub(Common.OnTankDeltaSnapshot, RmiName_OnTankDeltaSnapshot,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.OnTankDeltaSnapshot;
+        summary.rmiName = RmiName_OnTankDeltaSnapshot;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =OnTankDeltaSnapshot (remote,ctx , tickId, baselineTickId, delta );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_OnTankDeltaSnapshot);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.OnTankDeltaSnapshot;
+        summary.rmiName = RmiName_OnTankDeltaSnapshot;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
+    }
+    void ProcessReceivedMessage_SendSnapshotAck(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        int tickId; Nettention.Proud.Marshaler.Read(__msg,out tickId);	
+core.PostCheckReadMessage(__msg, RmiName_SendSnapshotAck);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=tickId.ToString()+",";
+        NotifyCallFromStub(Common.SendSnapshotAck, RmiName_SendSnapshotAck,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.SendSnapshotAck;
+        summary.rmiName = RmiName_SendSnapshotAck;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =SendSnapshotAck (remote,ctx , tickId );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_SendSnapshotAck);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.SendSnapshotAck;
+        summary.rmiName = RmiName_SendSnapshotAck;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
+    }
+    void ProcessReceivedMessage_SendMoveSequenced(Nettention.Proud.Message __msg, Nettention.Proud.ReceivedMessage pa, Object hostTag, Nettention.Proud.HostID remote)
+    {
+        Nettention.Proud.RmiContext ctx = new Nettention.Proud.RmiContext();
+        ctx.sentFrom=pa.RemoteHostID;
+        ctx.relayed=pa.IsRelayed;
+        ctx.hostTag=hostTag;
+        ctx.encryptMode = pa.EncryptMode;
+        ctx.compressMode = pa.CompressMode;
+
+        System.UInt16 sequence; Nettention.Proud.Marshaler.Read(__msg,out sequence);	
+System.Int16 posX; Nettention.Proud.Marshaler.Read(__msg,out posX);	
+System.Int16 posY; Nettention.Proud.Marshaler.Read(__msg,out posY);	
+System.Byte direction; Nettention.Proud.Marshaler.Read(__msg,out direction);	
+core.PostCheckReadMessage(__msg, RmiName_SendMoveSequenced);
+        if(enableNotifyCallFromStub==true)
+        {
+        string parameterString = "";
+        parameterString+=sequence.ToString()+",";
+parameterString+=posX.ToString()+",";
+parameterString+=posY.ToString()+",";
+parameterString+=direction.ToString()+",";
+        NotifyCallFromStub(Common.SendMoveSequenced, RmiName_SendMoveSequenced,parameterString);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.BeforeRmiSummary summary = new Nettention.Proud.BeforeRmiSummary();
+        summary.rmiID = Common.SendMoveSequenced;
+        summary.rmiName = RmiName_SendMoveSequenced;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        BeforeRmiInvocation(summary);
+        }
+
+        long t0 = Nettention.Proud.PreciseCurrentTime.GetTimeMs();
+
+        // Call this method.
+        bool __ret =SendMoveSequenced (remote,ctx , sequence, posX, posY, direction );
+
+        if(__ret==false)
+        {
+        // Error: RMI function that a user did not create has been called. 
+        core.ShowNotImplementedRmiWarning(RmiName_SendMoveSequenced);
+        }
+
+        if(enableStubProfiling)
+        {
+        Nettention.Proud.AfterRmiSummary summary = new Nettention.Proud.AfterRmiSummary();
+        summary.rmiID = Common.SendMoveSequenced;
+        summary.rmiName = RmiName_SendMoveSequenced;
+        summary.hostID = remote;
+        summary.hostTag = hostTag;
+        summary.elapsedTime = Nettention.Proud.PreciseCurrentTime.GetTimeMs()-t0;
+        AfterRmiInvocation(summary);
+        }
     }
 		#if USE_RMI_NAME_STRING
 // RMI name declaration.
@@ -939,6 +1541,16 @@ public const string RmiName_OnTankDestroyed="OnTankDestroyed";
 public const string RmiName_OnTankSpawned="OnTankSpawned";
 public const string RmiName_OnSpawnBullet="OnSpawnBullet";
 public const string RmiName_P2PMessage="P2PMessage";
+public const string RmiName_OnTankSnapshot="OnTankSnapshot";
+public const string RmiName_SendHello="SendHello";
+public const string RmiName_OnTanksOutOfRange="OnTanksOutOfRange";
+public const string RmiName_OnWorldSnapshot="OnWorldSnapshot";
+public const string RmiName_SendMoveCompact="SendMoveCompact";
+public const string RmiName_OnRoomSlots="OnRoomSlots";
+public const string RmiName_OnTankSnapshotCompact="OnTankSnapshotCompact";
+public const string RmiName_OnTankDeltaSnapshot="OnTankDeltaSnapshot";
+public const string RmiName_SendSnapshotAck="SendSnapshotAck";
+public const string RmiName_SendMoveSequenced="SendMoveSequenced";
        
 public const string RmiName_First = RmiName_SendMove;
 		#else
@@ -958,6 +1570,16 @@ public const string RmiName_OnTankDestroyed="";
 public const string RmiName_OnTankSpawned="";
 public const string RmiName_OnSpawnBullet="";
 public const string RmiName_P2PMessage="";
+public const string RmiName_OnTankSnapshot="";
+public const string RmiName_SendHello="";
+public const string RmiName_OnTanksOutOfRange="";
+public const string RmiName_OnWorldSnapshot="";
+public const string RmiName_SendMoveCompact="";
+public const string RmiName_OnRoomSlots="";
+public const string RmiName_OnTankSnapshotCompact="";
+public const string RmiName_OnTankDeltaSnapshot="";
+public const string RmiName_SendSnapshotAck="";
+public const string RmiName_SendMoveSequenced="";
        
 public const string RmiName_First = "";
 		#endif
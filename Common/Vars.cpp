@@ -8,9 +8,14 @@ using namespace Proud;
 PNGUID guid = { 0x3ae33249, 0xecc6, 0x4980, { 0xbc, 0x5d, 0x7b, 0xa, 0x99, 0x9c, 0x7, 0x39 } };
 Guid g_Version = Guid(guid);
 
+// Protocol revision within g_Version (1: tick snapshots, 2: compact movement, 3: delta snapshots, 4: unreliable sequenced moves)
+int g_ProtocolRevision = 4;
+
 // TCP listening port number.
 int g_ServerPort = 33334;
 
 // WebSocket port number (default: TCP port + 1)
 int g_WebSocketPort = 33335;
 
+// Web server port number (metrics / health check HTTP endpoint)
+int g_WebServerPort = 33336;
@@ -7,6 +7,9 @@ namespace TankGame
     {
         // Protocol version between server and client (must match)
         public static readonly System.Guid m_Version = new System.Guid("{ 0x3ae33249, 0xecc6, 0x4980, { 0xbc, 0x5d, 0x7b, 0xa, 0x99, 0x9c, 0x7, 0x39 } }");
+
+        // Protocol revision within m_Version, sent with SendHello (1: tick snapshots, 2: compact movement, 3: delta snapshots, 4: unreliable sequenced moves)
+        public const int ProtocolRevision = 4;
         
         // Server port
         public const int ServerPort = 33334;
@@ -6,6 +6,10 @@
 // Your server app and client app must have the same value below.
 extern Proud::Guid g_Version;
 
+// Protocol revision within g_Version, announced by the client with SendHello.
+// Clients that never send it keep the per-tank RMIs (OnPlayerJoined, OnTankPositionUpdated).
+extern int g_ProtocolRevision;
+
 // TCP listening port number.
 extern int g_ServerPort;
 
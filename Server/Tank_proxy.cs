@@ -557,6 +557,368 @@ Nettention.Proud.Marshaler.Write(__msg, message);
 		RmiName_P2PMessage, Common.P2PMessage);
         }
 }
+public bool OnTankSnapshot(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray snapshot)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.OnTankSnapshot;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, tickId);
+		Nettention.Proud.Marshaler.Write(__msg, snapshot);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_OnTankSnapshot, Common.OnTankSnapshot);
+        }
+}
+
+public bool OnTankSnapshot(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray snapshot)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.OnTankSnapshot;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, tickId);
+Nettention.Proud.Marshaler.Write(__msg, snapshot);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_OnTankSnapshot, Common.OnTankSnapshot);
+        }
+}
+public bool SendHello(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int protocolRevision)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.SendHello;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, protocolRevision);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_SendHello, Common.SendHello);
+        }
+}
+
+public bool SendHello(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, int protocolRevision)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.SendHello;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, protocolRevision);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_SendHello, Common.SendHello);
+        }
+}
+public bool OnTanksOutOfRange(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray clientIds)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.OnTanksOutOfRange;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, tickId);
+		Nettention.Proud.Marshaler.Write(__msg, clientIds);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_OnTanksOutOfRange, Common.OnTanksOutOfRange);
+        }
+}
+
+public bool OnTanksOutOfRange(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray clientIds)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.OnTanksOutOfRange;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, tickId);
+Nettention.Proud.Marshaler.Write(__msg, clientIds);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_OnTanksOutOfRange, Common.OnTanksOutOfRange);
+        }
+}
+public bool OnWorldSnapshot(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray world)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.OnWorldSnapshot;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, tickId);
+		Nettention.Proud.Marshaler.Write(__msg, world);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_OnWorldSnapshot, Common.OnWorldSnapshot);
+        }
+}
+
+public bool OnWorldSnapshot(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray world)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.OnWorldSnapshot;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, tickId);
+Nettention.Proud.Marshaler.Write(__msg, world);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_OnWorldSnapshot, Common.OnWorldSnapshot);
+        }
+}
+public bool SendMoveCompact(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, System.Int16 posX, System.Int16 posY, System.Byte direction)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.SendMoveCompact;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, posX);
+		Nettention.Proud.Marshaler.Write(__msg, posY);
+		Nettention.Proud.Marshaler.Write(__msg, direction);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_SendMoveCompact, Common.SendMoveCompact);
+        }
+}
+
+public bool SendMoveCompact(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, System.Int16 posX, System.Int16 posY, System.Byte direction)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.SendMoveCompact;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, posX);
+Nettention.Proud.Marshaler.Write(__msg, posY);
+Nettention.Proud.Marshaler.Write(__msg, direction);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_SendMoveCompact, Common.SendMoveCompact);
+        }
+}
+public bool OnRoomSlots(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, Nettention.Proud.ByteArray slots)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.OnRoomSlots;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, slots);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_OnRoomSlots, Common.OnRoomSlots);
+        }
+}
+
+public bool OnRoomSlots(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, Nettention.Proud.ByteArray slots)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.OnRoomSlots;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, slots);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_OnRoomSlots, Common.OnRoomSlots);
+        }
+}
+public bool OnTankSnapshotCompact(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray snapshot)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.OnTankSnapshotCompact;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, tickId);
+		Nettention.Proud.Marshaler.Write(__msg, snapshot);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_OnTankSnapshotCompact, Common.OnTankSnapshotCompact);
+        }
+}
+
+public bool OnTankSnapshotCompact(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, int tickId, Nettention.Proud.ByteArray snapshot)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.OnTankSnapshotCompact;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, tickId);
+Nettention.Proud.Marshaler.Write(__msg, snapshot);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_OnTankSnapshotCompact, Common.OnTankSnapshotCompact);
+        }
+}
+public bool OnTankDeltaSnapshot(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId, int baselineTickId, Nettention.Proud.ByteArray delta)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.OnTankDeltaSnapshot;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, tickId);
+		Nettention.Proud.Marshaler.Write(__msg, baselineTickId);
+		Nettention.Proud.Marshaler.Write(__msg, delta);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_OnTankDeltaSnapshot, Common.OnTankDeltaSnapshot);
+        }
+}
+
+public bool OnTankDeltaSnapshot(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, int tickId, int baselineTickId, Nettention.Proud.ByteArray delta)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.OnTankDeltaSnapshot;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, tickId);
+Nettention.Proud.Marshaler.Write(__msg, baselineTickId);
+Nettention.Proud.Marshaler.Write(__msg, delta);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_OnTankDeltaSnapshot, Common.OnTankDeltaSnapshot);
+        }
+}
+public bool SendSnapshotAck(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, int tickId)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.SendSnapshotAck;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, tickId);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_SendSnapshotAck, Common.SendSnapshotAck);
+        }
+}
+
+public bool SendSnapshotAck(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, int tickId)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.SendSnapshotAck;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, tickId);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_SendSnapshotAck, Common.SendSnapshotAck);
+        }
+}
+public bool SendMoveSequenced(Nettention.Proud.HostID remote,Nettention.Proud.RmiContext rmiContext, System.UInt16 sequence, System.Int16 posX, System.Int16 posY, System.Byte direction)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+		{
+		Nettention.Proud.Message __msg=freeList.GetObject();
+		__msg.Clear();
+		__msg.SimplePacketMode = core.IsSimplePacketMode();
+		Nettention.Proud.RmiID __msgid= Common.SendMoveSequenced;
+		__msg.Write(__msgid);
+		Nettention.Proud.Marshaler.Write(__msg, sequence);
+		Nettention.Proud.Marshaler.Write(__msg, posX);
+		Nettention.Proud.Marshaler.Write(__msg, posY);
+		Nettention.Proud.Marshaler.Write(__msg, direction);
+		
+	Nettention.Proud.HostID[] __list = new Nettention.Proud.HostID[1];
+	__list[0] = remote;
+		
+	return RmiSend(__list,rmiContext,__msg,
+		RmiName_SendMoveSequenced, Common.SendMoveSequenced);
+        }
+}
+
+public bool SendMoveSequenced(Nettention.Proud.HostID[] remotes,Nettention.Proud.RmiContext rmiContext, System.UInt16 sequence, System.Int16 posX, System.Int16 posY, System.Byte direction)
+{
+	using (Nettention.Proud.FreeListPopper<Nettention.Proud.Message> freeList = new Nettention.Proud.FreeListPopper<Nettention.Proud.Message>())
+{
+Nettention.Proud.Message __msg=freeList.GetObject();
+__msg.Clear();
+__msg.SimplePacketMode = core.IsSimplePacketMode();
+Nettention.Proud.RmiID __msgid= Common.SendMoveSequenced;
+__msg.Write(__msgid);
+Nettention.Proud.Marshaler.Write(__msg, sequence);
+Nettention.Proud.Marshaler.Write(__msg, posX);
+Nettention.Proud.Marshaler.Write(__msg, posY);
+Nettention.Proud.Marshaler.Write(__msg, direction);
+		
+	return RmiSend(remotes,rmiContext,__msg,
+		RmiName_SendMoveSequenced, Common.SendMoveSequenced);
+        }
+}
 	
 		#if USE_RMI_NAME_STRING
 // RMI name declaration.
@@ -575,6 +937,16 @@ public const string RmiName_OnTankDestroyed="OnTankDestroyed";
 public const string RmiName_OnTankSpawned="OnTankSpawned";
 public const string RmiName_OnSpawnBullet="OnSpawnBullet";
 public const string RmiName_P2PMessage="P2PMessage";
+public const string RmiName_OnTankSnapshot="OnTankSnapshot";
+public const string RmiName_SendHello="SendHello";
+public const string RmiName_OnTanksOutOfRange="OnTanksOutOfRange";
+public const string RmiName_OnWorldSnapshot="OnWorldSnapshot";
+public const string RmiName_SendMoveCompact="SendMoveCompact";
+public const string RmiName_OnRoomSlots="OnRoomSlots";
+public const string RmiName_OnTankSnapshotCompact="OnTankSnapshotCompact";
+public const string RmiName_OnTankDeltaSnapshot="OnTankDeltaSnapshot";
+public const string RmiName_SendSnapshotAck="SendSnapshotAck";
+public const string RmiName_SendMoveSequenced="SendMoveSequenced";
        
 public const string RmiName_First = RmiName_SendMove;
 		#else
@@ -594,6 +966,16 @@ public const string RmiName_OnTankDestroyed="";
 public const string RmiName_OnTankSpawned="";
 public const string RmiName_OnSpawnBullet="";
 public const string RmiName_P2PMessage="";
+public const string RmiName_OnTankSnapshot="";
+public const string RmiName_SendHello="";
+public const string RmiName_OnTanksOutOfRange="";
+public const string RmiName_OnWorldSnapshot="";
+public const string RmiName_SendMoveCompact="";
+public const string RmiName_OnRoomSlots="";
+public const string RmiName_OnTankSnapshotCompact="";
+public const string RmiName_OnTankDeltaSnapshot="";
+public const string RmiName_SendSnapshotAck="";
+public const string RmiName_SendMoveSequenced="";
        
 public const string RmiName_First = "";
 		#endif
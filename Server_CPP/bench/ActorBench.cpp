@@ -0,0 +1,192 @@
+// 공유 뮤텍스(lock) vs 명령 큐 + 단일 시뮬레이션 스레드(actor) 비교 벤치마크
+// ProudNet 워커 스레드를 흉내 낸 생산자 스레드들이 SendMove/SendFire 형태의 명령을 보냅니다
+//  - lock : 생산자가 MeasuredMutex를 잡고 월드 갱신 + 팬아웃(송신 큐 복사)까지 잠금 안에서 처리 (기존 방식)
+//  - actor: 생산자는 MpscQueue에 명령만 넣고, 소비자 스레드 하나가 배치로 꺼내 적용
+// 생산자 처리량(핸들러가 반환되기까지), 전체 적용 완료 시간, 잠금 대기, 큐 깊이, 적용 지연을 출력합니다.
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/LockStats.h"
+#include "../src/MpscQueue.h"
+#include "../src/SimCommand.h"
+#include "../src/TankRegistry.h"
+
+namespace {
+
+typedef SimCommand<std::string> BenchCommand;
+
+const int TankCount = 64;
+const int CommandsPerThread = 100000;
+const int FireEvery = 16;               // 16번에 한 번은 발사 (팬아웃 발생)
+const size_t FireMessageSize = 38;      // OnSpawnBullet 크기 (RmiID + int 2개 + float 7개)
+
+// 월드 모형 - 레지스트리 갱신과 수신자별 송신 큐 복사
+struct BenchWorld {
+    TankRegistry tanks;
+    std::vector<std::vector<uint8_t>> sendQueues;
+    SimLatencyRecorder latency;
+
+    BenchWorld() {
+        sendQueues.resize(TankCount);
+        for (int i = 0; i < TankCount; i++) {
+            tanks.Insert(i + 3, TankInfo(i + 3, 0.0f, 0.0f, 0.0f, 0, 100.0f));
+        }
+    }
+
+    void Apply(const BenchCommand& command) {
+        latency.Record(command.enqueueNs, SimNowNs());
+
+        TankHandle handle = tanks.Find(command.remote);
+        if (!handle.IsValid()) {
+            return;
+        }
+        if (command.type == SimCommandType::Move) {
+            TankPose& pose = tanks.Pose(handle);
+            pose.posX = command.pose.posX;
+            pose.posY = command.pose.posY;
+            pose.direction = command.pose.direction;
+            tanks.MarkPoseDirty(handle);
+        } else if (command.type == SimCommandType::Fire) {
+            uint8_t message[FireMessageSize];
+            std::memcpy(message, &command.fire, sizeof(command.fire));
+            for (int i = 0; i < TankCount; i++) {
+                if (i + 3 == command.remote) {
+                    continue;
+                }
+                std::vector<uint8_t>& queue = sendQueues[i];
+                if (queue.size() > 64 * 1024) {
+                    queue.clear();
+                }
+                queue.insert(queue.end(), message, message + FireMessageSize);
+            }
+        }
+    }
+};
+
+BenchCommand MakeCommand(int threadIndex, int i) {
+    BenchCommand command;
+    command.remote = 3 + (i + threadIndex) % TankCount;
+    if (i % FireEvery == 0) {
+        command.type = SimCommandType::Fire;
+        command.fire = SimFireArgs{ command.remote, (float)(i % 360), 25.0f, 1.0f, 0.5f, 2.0f };
+    } else {
+        command.type = SimCommandType::Move;
+        command.pose = SimPoseArgs{ (float)i * 0.01f, (float)threadIndex, (float)(i % 360) };
+    }
+    command.enqueueNs = SimNowNs();
+    return command;
+}
+
+struct CaseResult {
+    double producerMs = 0.0;   // 모든 생산자 스레드가 끝날 때까지
+    double totalMs = 0.0;      // 모든 명령이 적용될 때까지
+};
+
+void PrintResult(const char* mode, int threadCount, const CaseResult& result, const SimLatencyStats& latency) {
+    double commands = (double)CommandsPerThread * threadCount;
+    std::printf("%-6s %8d %14.0f %14.0f %12.2f %12.2f\n", mode, threadCount,
+                result.producerMs > 0 ? commands / result.producerMs * 1000.0 : 0.0,
+                result.totalMs > 0 ? commands / result.totalMs * 1000.0 : 0.0,
+                latency.avgLatencyUs, latency.maxLatencyUs);
+}
+
+void RunLock(int threadCount) {
+    BenchWorld world;
+    MeasuredMutex mutex;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threadCount; t++) {
+        producers.emplace_back([&, t]() {
+            for (int i = 0; i < CommandsPerThread; i++) {
+                BenchCommand command = MakeCommand(t, i);
+                std::lock_guard<MeasuredMutex> lock(mutex);
+                world.Apply(command);
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    CaseResult result;
+    result.producerMs = std::chrono::duration<double, std::milli>(end - start).count();
+    result.totalMs = result.producerMs;
+    PrintResult("lock", threadCount, result, world.latency.TakeStats());
+
+    LockWaitStats lockWait = mutex.TakeStats();
+    std::printf("       lock acquires %llu, contended %llu, wait avg/max %.2f / %.2f us\n",
+                (unsigned long long)lockWait.acquireCount, (unsigned long long)lockWait.contendedCount,
+                lockWait.avgWaitUs, lockWait.maxWaitUs);
+}
+
+void RunActor(int threadCount) {
+    BenchWorld world;
+    MpscQueue<BenchCommand> queue(65536);
+    const uint64_t totalCommands = (uint64_t)CommandsPerThread * threadCount;
+
+    std::atomic<bool> producersDone{ false };
+    std::chrono::steady_clock::time_point applyEnd;
+    std::thread consumer([&]() {
+        std::vector<BenchCommand> batch(256);
+        uint64_t applied = 0;
+        while (applied < totalCommands) {
+            size_t count = queue.PopBatch(batch.data(), batch.size());
+            if (count == 0) {
+                queue.WaitUntil(std::chrono::steady_clock::now() + std::chrono::milliseconds(1));
+                continue;
+            }
+            for (size_t i = 0; i < count; i++) {
+                world.Apply(batch[i]);
+            }
+            applied += count;
+        }
+        applyEnd = std::chrono::steady_clock::now();
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threadCount; t++) {
+        producers.emplace_back([&, t]() {
+            for (int i = 0; i < CommandsPerThread; i++) {
+                queue.Push(MakeCommand(t, i));
+            }
+        });
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    auto producerEnd = std::chrono::steady_clock::now();
+    producersDone = true;
+    consumer.join();
+
+    CaseResult result;
+    result.producerMs = std::chrono::duration<double, std::milli>(producerEnd - start).count();
+    result.totalMs = std::chrono::duration<double, std::milli>(applyEnd - start).count();
+    PrintResult("actor", threadCount, result, world.latency.TakeStats());
+
+    MpscQueueStats stats = queue.TakeStats();
+    std::printf("       batches %llu, avg batch %.1f, depth avg/max %.1f / %llu, full waits %llu\n",
+                (unsigned long long)stats.batchCount, stats.avgBatchSize, stats.avgDepth,
+                (unsigned long long)stats.maxDepth, (unsigned long long)stats.fullWaitCount);
+}
+
+} // namespace
+
+int main() {
+    std::printf("%d commands per producer thread, 1/%d fire (fan-out to %d tanks)\n",
+                CommandsPerThread, FireEvery, TankCount - 1);
+    std::printf("%-6s %8s %14s %14s %12s %12s\n", "mode", "threads", "handler/s", "applied/s", "lat avg us", "lat max us");
+
+    const int threadCounts[] = { 1, 2, 4, 8 };
+    for (int threadCount : threadCounts) {
+        RunLock(threadCount);
+        RunActor(threadCount);
+    }
+    return 0;
+}
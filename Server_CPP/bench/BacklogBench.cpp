@@ -0,0 +1,269 @@
+// 송신 대기열 백프레셔 - 느린/읽지 않는 클라이언트가 섞였을 때 클라이언트별 송신 대기열 크기와 대기열 지연 비교
+//
+//   BacklogBench [--tanks N] [--slow N] [--slow-rate KBPS] [--seconds S] [--high KB] [--limit KB]
+//     기본은 64대 중 4대가 초당 12KB 링크, 1대는 전혀 읽지 않고 나머지는 초당 1MB 링크, 30초
+//     백프레셔는 highWater 16KB (lowWater 4KB, 버림 64KB), 한도 256KB, 버리는 상태 10초면 연결 종료
+//
+// 탱크마다 20Hz로 돌아다니며 평균 3초에 한 번 발사하고, float 스냅샷을 20Hz로 받습니다.
+// 서버 송신 대기열은 클라이언트마다 RecordingEventSink가 기록한 메시지 크기(RmiID + 인자, ProudNet 헤더 제외)만큼 늘고
+// 틱마다 링크 속도만큼 줄어들며, 그 값을 ProudNet의 m_sendQueuedAmountInBytes처럼 월드에 알려 줍니다.
+// 대기열 지연은 틱마다 (대기열 크기 / 링크 속도) - 새 위치가 클라이언트에 닿기까지 앞에서 기다리는 시간입니다.
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+
+namespace {
+
+const int FirstHostId = 3;
+const int TickRateHz = 20;
+const float MapSize = 100.0f;
+const float Speed = 8.0f;   // 초당 이동 거리
+
+struct BenchOptions {
+    int tanks = 64;
+    int slow = 4;
+    int slowRateKBps = 12;
+    int seconds = 30;
+    int highKB = 16;
+    int limitKB = 256;
+};
+
+enum ClientClass { Fast, Slow, Stalled, ClassCount };
+const char* ClassNames[] = { "fast", "slow", "stalled" };
+
+struct Client {
+    ClientClass kind;
+    double rateBytesPerSec;
+    double queuedBytes = 0.0;
+    uint64_t receivedBytes = 0;
+    double maxQueuedBytes = 0.0;
+    double delaySumMs = 0.0;
+    double maxDelayMs = 0.0;
+    int delaySamples = 0;
+    int disconnectedTick = 0;   // 0이면 끝까지 접속
+    float posX, posY, heading;
+};
+
+struct ClassTotals {
+    int clients = 0;
+    uint64_t receivedBytes = 0;
+    double maxQueuedBytes = 0.0;
+    double delaySumMs = 0.0;
+    double maxDelayMs = 0.0;
+    int delaySamples = 0;
+    int disconnected = 0;
+    int firstDisconnectTick = 0;
+};
+
+bool ParseOptions(int argc, char* argv[], BenchOptions& options) {
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        int value = std::max(0, std::atoi(argv[i + 1]));
+        if (arg == "--tanks") {
+            options.tanks = std::max(2, value);
+        } else if (arg == "--slow") {
+            options.slow = value;
+        } else if (arg == "--slow-rate") {
+            options.slowRateKBps = std::max(1, value);
+        } else if (arg == "--seconds") {
+            options.seconds = std::max(1, value);
+        } else if (arg == "--high") {
+            options.highKB = value;
+        } else if (arg == "--limit") {
+            options.limitKB = value;
+        } else {
+            return false;
+        }
+    }
+    return argc % 2 == 1;
+}
+
+void Run(const BenchOptions& options, bool backpressure) {
+    RecordingEventSink sink;
+    sink.SetKeepEvents(true);
+    GameWorld world(sink);
+    world.SetRandomSeed(1234);
+    world.SetPositionRefreshTicks(TickRateHz);
+    if (backpressure) {
+        SendBacklogConfig config;
+        config.highWaterBytes = (uint32_t)options.highKB * 1024;
+        config.disconnectBytes = (uint32_t)options.limitKB * 1024;
+        config.coalesceTicks = TickRateHz / 4;
+        config.dropTimeoutTicks = TickRateHz * 10;
+        world.SetSendBacklog(config);
+    }
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<Client> clients(options.tanks);
+    for (int i = 0; i < options.tanks; i++) {
+        Client& c = clients[i];
+        c.kind = i == 0 ? Stalled : (i <= options.slow ? Slow : Fast);
+        c.rateBytesPerSec = c.kind == Stalled ? 0.0 : (c.kind == Slow ? options.slowRateKBps * 1024.0 : 1024.0 * 1024.0);
+        c.posX = MapSize * unit(random);
+        c.posY = MapSize * unit(random);
+        c.heading = 6.2831853f * unit(random);
+
+        GameCommand join;
+        join.type = SimCommandType::Join;
+        join.remote = FirstHostId + i;
+        join.enqueueNs = 0;
+        world.Apply(join);
+
+        GameCommand hello = join;
+        hello.type = SimCommandType::Hello;
+        hello.protocolRevision = TickSnapshotProtocolRevision;
+        world.Apply(hello);
+    }
+
+    // 기록된 이벤트를 수신자별 대기열에 더함 (퇴장한 클라이언트는 대기열이 해제됨)
+    size_t processed = 0;
+    auto enqueueEvents = [&]() {
+        const std::vector<RecordedGameEvent>& events = sink.Events();
+        for (; processed < events.size(); processed++) {
+            for (int hostId : events[processed].recipients) {
+                Client& c = clients[hostId - FirstHostId];
+                if (c.disconnectedTick == 0) {
+                    c.queuedBytes += events[processed].messageBytes;
+                }
+            }
+        }
+    };
+
+    float dt = 1.0f / TickRateHz;
+    int ticks = options.seconds * TickRateHz;
+    for (uint32_t tickId = 1; tickId <= (uint32_t)ticks; tickId++) {
+        for (int i = 0; i < options.tanks; i++) {
+            Client& c = clients[i];
+            if (c.disconnectedTick != 0) {
+                continue;
+            }
+            c.heading += (unit(random) - 0.5f) * 0.3f;
+            c.posX += std::cos(c.heading) * Speed * dt;
+            c.posY += std::sin(c.heading) * Speed * dt;
+            if (c.posX < 0.0f || c.posX > MapSize || c.posY < 0.0f || c.posY > MapSize) {
+                c.heading += 3.14159265f;
+                c.posX = std::min(std::max(c.posX, 0.0f), MapSize);
+                c.posY = std::min(std::max(c.posY, 0.0f), MapSize);
+            }
+
+            GameCommand move;
+            move.type = SimCommandType::Move;
+            move.remote = FirstHostId + i;
+            move.enqueueNs = 0;
+            move.pose = SimPoseArgs{ c.posX, c.posY, std::fmod(c.heading * 57.29578f + 3600.0f, 360.0f) };
+            world.Apply(move);
+
+            if (unit(random) < 1.0f / (3.0f * TickRateHz)) {
+                GameCommand fire;
+                fire.type = SimCommandType::Fire;
+                fire.remote = FirstHostId + i;
+                fire.enqueueNs = 0;
+                fire.fire = SimFireArgs{ FirstHostId + i, move.pose.direction, 25.0f, c.posX, 1.0f, c.posY };
+                world.Apply(fire);
+            }
+        }
+        enqueueEvents();
+
+        // 링크가 한 틱 동안 보낸 만큼 대기열을 비우고, 남은 크기를 월드에 알림 (전송 계층의 SampleSendQueues)
+        for (int i = 0; i < options.tanks; i++) {
+            Client& c = clients[i];
+            if (c.disconnectedTick != 0) {
+                continue;
+            }
+            double sent = std::min(c.queuedBytes, c.rateBytesPerSec * dt);
+            c.queuedBytes -= sent;
+            c.receivedBytes += (uint64_t)sent;
+            c.maxQueuedBytes = std::max(c.maxQueuedBytes, c.queuedBytes);
+            if (c.rateBytesPerSec > 0.0) {
+                double delayMs = c.queuedBytes / c.rateBytesPerSec * 1000.0;
+                c.delaySumMs += delayMs;
+                c.maxDelayMs = std::max(c.maxDelayMs, delayMs);
+                c.delaySamples++;
+            }
+
+            if (world.UpdateSendQueue(FirstHostId + i, (uint32_t)std::min(c.queuedBytes, 4e9))) {
+                c.disconnectedTick = (int)tickId;
+                c.queuedBytes = 0.0;
+                GameCommand leave;
+                leave.type = SimCommandType::Leave;
+                leave.remote = FirstHostId + i;
+                leave.enqueueNs = 0;
+                world.Apply(leave);
+            }
+        }
+
+        world.BroadcastSnapshot(tickId);
+        enqueueEvents();
+    }
+
+    ClassTotals totals[ClassCount];
+    for (const Client& c : clients) {
+        ClassTotals& t = totals[c.kind];
+        t.clients++;
+        t.receivedBytes += c.receivedBytes;
+        t.maxQueuedBytes = std::max(t.maxQueuedBytes, c.maxQueuedBytes);
+        t.delaySumMs += c.delaySumMs;
+        t.delaySamples += c.delaySamples;
+        t.maxDelayMs = std::max(t.maxDelayMs, c.maxDelayMs);
+        if (c.disconnectedTick != 0) {
+            t.disconnected++;
+            if (t.firstDisconnectTick == 0 || c.disconnectedTick < t.firstDisconnectTick) {
+                t.firstDisconnectTick = c.disconnectedTick;
+            }
+        }
+    }
+
+    for (int k = 0; k < ClassCount; k++) {
+        const ClassTotals& t = totals[k];
+        if (t.clients == 0) {
+            continue;
+        }
+        char delay[32] = "-";
+        if (t.delaySamples > 0) {
+            std::snprintf(delay, sizeof(delay), "%.0f / %.0f", t.delaySumMs / t.delaySamples, t.maxDelayMs);
+        }
+        char disconnected[32] = "-";
+        if (t.disconnected > 0) {
+            std::snprintf(disconnected, sizeof(disconnected), "%d at %.1f s", t.disconnected,
+                          (double)t.firstDisconnectTick / TickRateHz);
+        }
+        std::printf("%-14s %-8s %7d %12.0f %14.1f %18s %14s\n", backpressure ? "backpressure" : "off", ClassNames[k],
+                    t.clients, (double)t.receivedBytes / options.seconds / t.clients, t.maxQueuedBytes / 1024.0, delay,
+                    disconnected);
+    }
+
+    const SendBacklogStats& stats = world.SendBacklogStatsRef();
+    std::printf("%-14s skipped %llu, coalesced %llu, bullets dropped %llu, disconnects %llu\n", "",
+                (unsigned long long)stats.skipped.load(), (unsigned long long)stats.coalesced.load(),
+                (unsigned long long)stats.droppedBullets.load(), (unsigned long long)stats.disconnects.load());
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "usage: BacklogBench [--tanks N] [--slow N] [--slow-rate KBPS] [--seconds S] [--high KB] [--limit KB]\n");
+        return 2;
+    }
+
+    QuietWorldLogs();
+
+    std::printf("%d tanks (%d slow at %d KB/s, 1 stalled, rest 1 MB/s), float snapshots %d Hz, %d s, high %d KB, limit %d KB\n",
+                options.tanks, options.slow, options.slowRateKBps, TickRateHz, options.seconds, options.highKB, options.limitKB);
+    std::printf("%-14s %-8s %7s %12s %14s %18s %14s\n", "mode", "class", "clients", "recv B/s", "max queue KB",
+                "delay avg/max ms", "disconnected");
+    Run(options, false);
+    Run(options, true);
+
+    AsyncLog::Instance().Stop();
+    return 0;
+}
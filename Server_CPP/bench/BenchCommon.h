@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../src/AsyncLog.h"
+
+// 벤치마크 공용 유틸리티 - ProudNet 없이 빌드됩니다
+
+// 최적화로 결과가 제거되지 않도록 값을 소비합니다
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#ifdef _MSC_VER
+    static volatile const void* sink;
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+// 함수를 iterations번 반복 실행하고 1회당 평균 나노초를 반환
+template <typename Func>
+inline double MeasureNs(int iterations, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double totalNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    return totalNs / iterations;
+}
+
+// 결과 한 줄 출력 (이름, 크기, 비교 대상 두 개의 ns/op)
+inline void PrintRow(const std::string& name, size_t count, double baselineNs, double candidateNs) {
+    std::printf("%-24s %8zu %14.1f %14.1f %8.2fx\n", name.c_str(), count, baselineNs, candidateNs,
+                candidateNs > 0 ? baselineNs / candidateNs : 0.0);
+}
+
+inline void PrintHeader(const char* baselineName, const char* candidateName) {
+    std::printf("%-24s %8s %14s %14s %9s\n", "case", "tanks", baselineName, candidateName, "speedup");
+}
+
+// 월드의 info 로그(접속, 방 배정 등)가 측정에 섞이지 않도록 경고 이상만 출력
+inline void QuietWorldLogs() {
+    AsyncLog::Instance().SetAllLevels(LogLevel::Warn);
+}
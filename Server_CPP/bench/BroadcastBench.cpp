@@ -0,0 +1,117 @@
+// 단일 대상 Proxy 호출 반복 vs 멀티캐스트 Proxy 호출 비교 벤치마크
+// 생성된 Tank_proxy.cpp와 같은 순서로 메시지를 직렬화하는 모형을 사용합니다
+//  - loop     : 수신자마다 메시지를 새로 직렬화하고 송신 큐에 복사 (기존 브로드캐스트 루프)
+//  - multicast: 한 번 직렬화한 메시지를 모든 수신자 송신 큐가 공유 (BroadcastGroup + 멀티캐스트 오버로드)
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/BroadcastGroup.h"
+
+namespace {
+
+// CMessage 모형 - 내부 버퍼에 순서대로 기록
+class BenchMessage {
+public:
+    void Reserve(size_t size) { buffer.reserve(size); }
+
+    template <typename T>
+    void Write(const T& value) {
+        size_t offset = buffer.size();
+        buffer.resize(offset + sizeof(T));
+        std::memcpy(buffer.data() + offset, &value, sizeof(T));
+    }
+
+    size_t Length() const { return buffer.size(); }
+
+    std::vector<uint8_t> buffer;
+};
+
+typedef std::shared_ptr<const BenchMessage> SharedMessage;
+
+// 수신자별 송신 큐 모형
+struct BenchPeer {
+    std::vector<SharedMessage> queue;
+};
+
+// OnSpawnBullet과 같은 파라미터 구성 (RmiID + int 2개 + float 7개)
+void SerializeSpawnBullet(BenchMessage& msg, int clientId, int shooterId) {
+    msg.Write((uint16_t)2013);
+    msg.Write(clientId);
+    msg.Write(shooterId);
+    msg.Write(1.0f);  // posX
+    msg.Write(2.0f);  // posY
+    msg.Write(90.0f); // direction
+    msg.Write(25.0f); // launchForce
+    msg.Write(1.5f);  // fireX
+    msg.Write(0.5f);  // fireY
+    msg.Write(2.5f);  // fireZ
+}
+
+void RunCase(size_t recipientCount) {
+    std::vector<BenchPeer> peers(recipientCount + 1);
+    BroadcastGroup<int> group;
+    group.Reserve(peers.size());
+    for (size_t i = 0; i < peers.size(); i++) {
+        group.Add((int)i);
+    }
+    const int sender = 0;
+    const int rounds = (int)std::max<size_t>(200, 400000 / recipientCount);
+
+    // 기존 방식: 전체 탱크를 돌며 보낸 사람을 건너뛰고, 수신자마다 직렬화
+    size_t loopBytes = 0;
+    double loopNs = MeasureNs(rounds, [&]() {
+        loopBytes = 0;
+        for (size_t i = 0; i < peers.size(); i++) {
+            if ((int)i == sender) {
+                continue;
+            }
+            auto msg = std::make_shared<BenchMessage>();
+            msg->Reserve(64);
+            SerializeSpawnBullet(*msg, sender, sender);
+            loopBytes += msg->Length();
+            peers[i].queue.push_back(msg);
+        }
+        for (BenchPeer& peer : peers) {
+            peer.queue.clear();
+        }
+    });
+
+    // 멀티캐스트: 수신자 배열은 미리 유지, 직렬화는 한 번
+    size_t multicastBytes = 0;
+    double multicastNs = MeasureNs(rounds, [&]() {
+        int count = 0;
+        int* recipients = group.AllExcept(sender, count);
+        auto msg = std::make_shared<BenchMessage>();
+        msg->Reserve(64);
+        SerializeSpawnBullet(*msg, sender, sender);
+        multicastBytes = msg->Length();
+        SharedMessage shared = msg;
+        for (int i = 0; i < count; i++) {
+            peers[recipients[i]].queue.push_back(shared);
+        }
+        for (BenchPeer& peer : peers) {
+            peer.queue.clear();
+        }
+    });
+
+    std::printf("%10zu %14zu %14zu %14.1f %14.1f %8.2fx\n",
+                recipientCount, loopBytes, multicastBytes, loopNs, multicastNs,
+                multicastNs > 0 ? loopNs / multicastNs : 0.0);
+}
+
+} // namespace
+
+int main() {
+    std::printf("OnSpawnBullet-sized message fan-out, sender excluded\n");
+    std::printf("%10s %14s %14s %14s %14s %9s\n",
+                "recipients", "loop bytes", "mcast bytes", "loop ns", "mcast ns", "speedup");
+
+    const size_t sizes[] = { 1, 16, 64, 256, 1024 };
+    for (size_t count : sizes) {
+        RunCase(count);
+    }
+    return 0;
+}
@@ -0,0 +1,346 @@
+// broadphase 색인 비교 - 전체 순회 vs 균일 격자(SpatialHash) vs 느슨한 사분 트리(LooseQuadtree)
+//
+//   BroadphaseBench [--tanks N] [--queries N] [--cell M] [--shells N]
+//     기본은 탱크 1000대, 밀도마다 쿼리 20000번, 격자 셀 50m (관심 영역 반경과 같게), 포탄 10000발
+//
+// 탱크 1000대를 100/300/1000/3000m 맵에 고르게, 또는 3000m 맵의 반경 15m 무리 8개에 모아 두고
+// 이동 하나(30Hz 이동의 한 번 - 최대 0.5m씩 무작위 이동), 반경 50m 쿼리 (관심 영역), 30m 선분 쓸기 (반경 1.5m - 한 틱의 포탄 경로),
+// 최근접 8대 쿼리의 평균 시간을 잽니다. 세 색인의 결과 수 합이 같은지 확인해 함께 출력합니다.
+// 마지막 표는 포탄 명중 판정 (포탄 하나와 탱크 반경 1.5m 비교)을 ProjectileSystem의 전체 비교(AVX2)와 색인 쿼리로 비교합니다
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/LooseQuadtree.h"
+#include "../src/ProjectileSystem.h"
+#include "../src/SpatialHash.h"
+
+namespace {
+
+const int MoveRounds = 30;
+const float MoveStep = 0.5f;
+const float InterestRadius = 50.0f;
+const float SweepLength = 30.0f;
+const float TankRadius = 1.5f;
+const size_t NearestCount = 8;
+const int ClusterCount = 8;
+const float ClusterRadius = 15.0f;
+
+struct BenchOptions {
+    int tanks = 1000;
+    int queries = 20000;
+    float cellSize = 50.0f;
+    int shells = 10000;
+};
+
+struct Layout {
+    const char* name;
+    float mapSize;
+    bool clustered;
+};
+
+// 비교 기준 - 탱크 배열을 전부 훑음 (id는 0 ~ N-1)
+class LinearIndex {
+public:
+    void Update(int id, float x, float y) {
+        if ((size_t)id >= xs.size()) {
+            xs.resize(id + 1);
+            ys.resize(id + 1);
+        }
+        xs[id] = x;
+        ys[id] = y;
+    }
+
+    template <typename Visitor>
+    void QueryRadius(float x, float y, float radius, Visitor&& visit) const {
+        float radiusSq = radius * radius;
+        for (size_t i = 0; i < xs.size(); i++) {
+            float dx = xs[i] - x;
+            float dy = ys[i] - y;
+            if (dx * dx + dy * dy <= radiusSq) {
+                visit((int)i);
+            }
+        }
+    }
+
+    template <typename Visitor>
+    void QuerySegment(float x0, float y0, float x1, float y1, float radius, Visitor&& visit) const {
+        float dx = x1 - x0;
+        float dy = y1 - y0;
+        float lengthSq = dx * dx + dy * dy;
+        float invLengthSq = lengthSq > 0.0f ? 1.0f / lengthSq : 0.0f;
+        for (size_t i = 0; i < xs.size(); i++) {
+            float t;
+            if (SegmentDistanceSq(x0, y0, dx, dy, invLengthSq, xs[i], ys[i], t) <= radius * radius) {
+                visit((int)i, t);
+            }
+        }
+    }
+
+    size_t QueryNearest(float x, float y, size_t k, float maxDistance, int exclude, std::vector<SpatialNeighbor>& out) const {
+        out.clear();
+        float limitSq = maxDistance * maxDistance;
+        for (size_t i = 0; i < xs.size(); i++) {
+            float dx = xs[i] - x;
+            float dy = ys[i] - y;
+            float distanceSq = dx * dx + dy * dy;
+            if (distanceSq <= limitSq && (int)i != exclude) {
+                out.push_back(SpatialNeighbor{ (int)i, distanceSq });
+            }
+        }
+        size_t keep = std::min(k, out.size());
+        std::partial_sort(out.begin(), out.begin() + keep, out.end(),
+                          [](const SpatialNeighbor& a, const SpatialNeighbor& b) { return a.distanceSq < b.distanceSq; });
+        out.resize(keep);
+        return keep;
+    }
+
+private:
+    std::vector<float> xs;
+    std::vector<float> ys;
+};
+
+// 탱크 배치와 쿼리 위치 (모든 색인이 같은 값을 씀)
+struct Scene {
+    std::vector<float> tankX, tankY;
+    std::vector<float> moveX, moveY;     // 이동 라운드 r의 탱크 i 위치는 [r * tanks + i]
+    std::vector<float> queryX, queryY;   // 쿼리 위치 (탱크 위치 근처)
+    std::vector<float> angle;            // 선분 쓸기 방향
+};
+
+Scene MakeScene(const BenchOptions& options, const Layout& layout) {
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(0.0f, layout.mapSize);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> direction(0.0f, 6.2831853f);
+    std::vector<float> centerX(ClusterCount), centerY(ClusterCount);
+    for (int c = 0; c < ClusterCount; c++) {
+        centerX[c] = position(random);
+        centerY[c] = position(random);
+    }
+
+    Scene scene;
+    for (int i = 0; i < options.tanks; i++) {
+        if (layout.clustered) {
+            int c = i % ClusterCount;
+            scene.tankX.push_back(centerX[c] + unit(random) * ClusterRadius);
+            scene.tankY.push_back(centerY[c] + unit(random) * ClusterRadius);
+        } else {
+            scene.tankX.push_back(position(random));
+            scene.tankY.push_back(position(random));
+        }
+    }
+    std::vector<float> x = scene.tankX, y = scene.tankY;
+    for (int round = 0; round < MoveRounds; round++) {
+        for (int i = 0; i < options.tanks; i++) {
+            x[i] += unit(random) * MoveStep;
+            y[i] += unit(random) * MoveStep;
+            scene.moveX.push_back(x[i]);
+            scene.moveY.push_back(y[i]);
+        }
+    }
+    for (int q = 0; q < options.queries; q++) {
+        int i = (int)(random() % options.tanks);
+        scene.queryX.push_back(x[i] + unit(random) * 5.0f);
+        scene.queryY.push_back(y[i] + unit(random) * 5.0f);
+        scene.angle.push_back(direction(random));
+    }
+    return scene;
+}
+
+struct IndexResult {
+    double updateNs = 0.0;
+    double radiusNs = 0.0;
+    double sweepNs = 0.0;
+    double nearestNs = 0.0;
+    uint64_t radiusFound = 0;
+    uint64_t sweepFound = 0;
+    double nearestSum = 0.0;   // 최근접 거리 제곱의 합 (결과 비교용)
+};
+
+double ElapsedNs(std::chrono::steady_clock::time_point start, size_t count) {
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double)count;
+}
+
+template <typename Index>
+IndexResult RunIndex(Index& index, const BenchOptions& options, const Scene& scene) {
+    IndexResult result;
+    for (int i = 0; i < options.tanks; i++) {
+        index.Update(i, scene.tankX[i], scene.tankY[i]);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t m = 0; m < scene.moveX.size(); m++) {
+        index.Update((int)(m % options.tanks), scene.moveX[m], scene.moveY[m]);
+    }
+    result.updateNs = ElapsedNs(start, scene.moveX.size());
+
+    const size_t queries = scene.queryX.size();
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < queries; q++) {
+        index.QueryRadius(scene.queryX[q], scene.queryY[q], InterestRadius, [&](int) { result.radiusFound++; });
+    }
+    result.radiusNs = ElapsedNs(start, queries);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < queries; q++) {
+        float x1 = scene.queryX[q] + SweepLength * std::sin(scene.angle[q]);
+        float y1 = scene.queryY[q] + SweepLength * std::cos(scene.angle[q]);
+        index.QuerySegment(scene.queryX[q], scene.queryY[q], x1, y1, TankRadius, [&](int, float) { result.sweepFound++; });
+    }
+    result.sweepNs = ElapsedNs(start, queries);
+
+    std::vector<SpatialNeighbor> nearest;
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < queries; q++) {
+        index.QueryNearest(scene.queryX[q], scene.queryY[q], NearestCount, INFINITY, -1, nearest);
+        for (const SpatialNeighbor& n : nearest) {
+            result.nearestSum += n.distanceSq;
+        }
+    }
+    result.nearestNs = ElapsedNs(start, queries);
+    DoNotOptimize(result.nearestSum);
+    return result;
+}
+
+LooseQuadtreeConfig MakeQuadtreeConfig(const Layout& layout) {
+    LooseQuadtreeConfig config;
+    config.minX = -ClusterRadius;
+    config.minY = -ClusterRadius;
+    config.size = layout.mapSize + 2.0f * ClusterRadius;
+    config.maxDepth = 10;
+    config.leafCapacity = 16;
+    return config;
+}
+
+bool SameResults(const IndexResult& a, const IndexResult& b) {
+    return a.radiusFound == b.radiusFound && a.sweepFound == b.sweepFound
+        && std::fabs(a.nearestSum - b.nearestSum) <= 1e-6 * std::max(1.0, a.nearestSum);
+}
+
+void PrintIndex(const char* name, const IndexResult& result, const IndexResult& reference, size_t extra) {
+    std::printf("  %-10s %10.1f %12.1f %12.1f %12.1f %10zu  %s\n", name, result.updateNs, result.radiusNs, result.sweepNs,
+                result.nearestNs, extra, SameResults(result, reference) ? "ok" : "MISMATCH");
+}
+
+// 포탄 명중 판정 - 포탄 위치는 탱크 근처 (탱크 배치를 따라감)
+void RunShells(const BenchOptions& options, const Layout& layout, const Scene& scene) {
+    std::mt19937 random(99);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::vector<float> shellX, shellY;
+    for (int s = 0; s < options.shells; s++) {
+        int i = (int)(random() % options.tanks);
+        shellX.push_back(scene.tankX[i] + unit(random) * 10.0f);
+        shellY.push_back(scene.tankY[i] + unit(random) * 10.0f);
+    }
+
+    ProjectileTargets targets;
+    SpatialHash grid(options.cellSize);
+    LooseQuadtree tree(MakeQuadtreeConfig(layout));
+    for (int i = 0; i < options.tanks; i++) {
+        targets.Add(i, scene.tankX[i], scene.tankY[i]);
+        grid.Update(i, scene.tankX[i], scene.tankY[i]);
+        tree.Update(i, scene.tankX[i], scene.tankY[i]);
+    }
+    targets.Pad();
+    const float radiusSq = TankRadius * TankRadius;
+
+    uint64_t bruteHits = 0, gridHits = 0, treeHits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int s = 0; s < options.shells; s++) {
+#ifdef TANK_PROJECTILE_AVX2
+        int hit = CpuSupportsAvx2() ? FindProjectileHitAvx2(targets, shellX[s], shellY[s], -1, radiusSq)
+                                    : FindProjectileHitScalar(targets, shellX[s], shellY[s], -1, radiusSq);
+#else
+        int hit = FindProjectileHitScalar(targets, shellX[s], shellY[s], -1, radiusSq);
+#endif
+        bruteHits += hit >= 0 ? 1 : 0;
+    }
+    double bruteNs = ElapsedNs(start, options.shells);
+
+    auto firstHit = [&](auto& index, uint64_t& hits) {
+        auto begin = std::chrono::steady_clock::now();
+        for (int s = 0; s < options.shells; s++) {
+            bool hit = false;
+            index.QueryRadius(shellX[s], shellY[s], TankRadius, [&](int id) {
+                float dx = scene.tankX[id] - shellX[s];
+                float dy = scene.tankY[id] - shellY[s];
+                hit = hit || dx * dx + dy * dy < radiusSq;
+            });
+            hits += hit ? 1 : 0;
+        }
+        return ElapsedNs(begin, options.shells);
+    };
+    double gridNs = firstHit(grid, gridHits);
+    double treeNs = firstHit(tree, treeHits);
+    std::printf("%-16s %14.1f %12.1f %12.1f %10llu  %s\n", layout.name, bruteNs, gridNs, treeNs,
+                (unsigned long long)bruteHits, bruteHits == gridHits && bruteHits == treeHits ? "ok" : "MISMATCH");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        int value = std::max(1, std::atoi(argv[i + 1]));
+        if (arg == "--tanks") {
+            options.tanks = value;
+        } else if (arg == "--queries") {
+            options.queries = value;
+        } else if (arg == "--cell") {
+            options.cellSize = (float)value;
+        } else if (arg == "--shells") {
+            options.shells = value;
+        } else {
+            std::fprintf(stderr, "usage: BroadphaseBench [--tanks N] [--queries N] [--cell M] [--shells N]\n");
+            return 2;
+        }
+    }
+
+    const Layout layouts[] = {
+        { "uniform 100m", 100.0f, false },
+        { "uniform 300m", 300.0f, false },
+        { "uniform 1000m", 1000.0f, false },
+        { "uniform 3000m", 3000.0f, false },
+        { "clusters 3000m", 3000.0f, true },
+    };
+
+    std::printf("%d tanks, %d queries per row, grid cell %.0f m, quadtree leaf 16 / depth 10\n", options.tanks, options.queries,
+                options.cellSize);
+    std::printf("move %.1f m, radius query %.0f m, sweep %.0f m x %.1f m, nearest %zu - ns per operation\n", MoveStep,
+                InterestRadius, SweepLength, TankRadius, NearestCount);
+    for (const Layout& layout : layouts) {
+        Scene scene = MakeScene(options, layout);
+        LinearIndex linear;
+        SpatialHash grid(options.cellSize);
+        LooseQuadtree tree(MakeQuadtreeConfig(layout));
+        IndexResult linearResult = RunIndex(linear, options, scene);
+        IndexResult gridResult = RunIndex(grid, options, scene);
+        IndexResult treeResult = RunIndex(tree, options, scene);
+
+        std::printf("\n%s (%.1f in radius, %.2f on sweep)\n", layout.name, (double)linearResult.radiusFound / options.queries,
+                    (double)linearResult.sweepFound / options.queries);
+        std::printf("  %-10s %10s %12s %12s %12s %10s\n", "index", "update", "radius", "sweep", "nearest", "cells/nodes");
+        PrintIndex("linear", linearResult, linearResult, 0);
+        PrintIndex("grid", gridResult, linearResult, grid.CellCount());
+        PrintIndex("quadtree", treeResult, linearResult, tree.NodeCount());
+    }
+
+    bool hasAvx2 = false;
+#ifdef TANK_PROJECTILE_AVX2
+    hasAvx2 = CpuSupportsAvx2();
+#endif
+    std::printf("\nshell hit test, %d shells near tanks - ns per shell\n", options.shells);
+    std::printf("%-16s %14s %12s %12s %10s\n", "layout", hasAvx2 ? "brute (avx2)" : "brute", "grid", "quadtree", "hits");
+    for (const Layout& layout : layouts) {
+        RunShells(options, layout, MakeScene(options, layout));
+    }
+    return 0;
+}
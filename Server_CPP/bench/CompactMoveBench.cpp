@@ -0,0 +1,143 @@
+// 압축 이동 프로토콜 검증/비교
+// 1) 양자화 오차 - 맵 범위 안의 위치와 전체 각도를 훑어 복원 오차의 최댓값을 보고하고 허용 범위를 넘으면 실패
+// 2) 대역폭 - 64대가 20Hz로 이동하고 20Hz 스냅샷 틱을 돌 때 float 경로와 압축 경로의 초당 송수신 바이트
+// 바이트는 RmiID(2바이트) + 인자 크기 기준이며 ProudNet 헤더/암호화는 포함하지 않습니다.
+
+#include <cmath>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/CompactMove.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+
+namespace {
+
+const int TankCount = 64;
+const int MoveRateHz = 20;
+const int TickRateHz = 20;
+const int Seconds = 30;
+const int FirstHostId = 3;
+
+// SendMove(float x3) / SendMoveCompact(int16 x2 + uint8) 메시지 크기
+const uint32_t FloatMoveBytes = 2 + 4 * 3;
+const uint32_t CompactMoveBytes = 2 + 2 * 2 + 1;
+
+float AngleDifference(float a, float b) {
+    float diff = std::fmod(std::fabs(a - b), 360.0f);
+    return diff > 180.0f ? 360.0f - diff : diff;
+}
+
+// 맵 범위(기준점 +-500)와 각도 전체를 훑어 최대 오차 확인
+bool CheckErrorBounds() {
+    float maxPositionError = 0.0f;
+    for (float value = -450.0f; value <= 550.0f; value += 0.00731f) {
+        float restored = DequantizePosition(QuantizePosition(value, CompactMapOriginX), CompactMapOriginX);
+        maxPositionError = std::max(maxPositionError, std::fabs(restored - value));
+    }
+
+    float maxDirectionError = 0.0f;
+    for (float degrees = -720.0f; degrees <= 720.0f; degrees += 0.0137f) {
+        float restored = DequantizeDirection(QuantizeDirection(degrees));
+        maxDirectionError = std::max(maxDirectionError, AngleDifference(restored, degrees));
+    }
+
+    // 범위 밖은 가장자리로 고정
+    float clampedHigh = DequantizePosition(QuantizePosition(10000.0f, CompactMapOriginX), CompactMapOriginX);
+    float clampedLow = DequantizePosition(QuantizePosition(-10000.0f, CompactMapOriginX), CompactMapOriginX);
+
+    // varint/항목 왕복
+    bool roundTrip = true;
+    uint8_t buffer[MaxCompactSnapshotEntrySize];
+    for (uint32_t slot : { 0u, 1u, 127u, 128u, 16383u, 16384u, 0xFFFFFFFFu }) {
+        CompactSnapshotEntry in = MakeCompactSnapshotEntry(slot, 12.5f, 87.25f, 271.0f);
+        CompactSnapshotEntry out{};
+        size_t written = WriteCompactSnapshotEntry(buffer, in);
+        size_t read = ReadCompactSnapshotEntry(buffer, written, out);
+        roundTrip = roundTrip && read == written && out.slot == in.slot && out.posX == in.posX
+                 && out.posY == in.posY && out.direction == in.direction
+                 && ReadCompactSnapshotEntry(buffer, written - 1, out) == 0;
+    }
+
+    float positionBound = 0.5f / CompactPositionScale;
+    float directionBound = CompactDirectionStep * 0.5f;
+    // 기준점에서 수백 단위 떨어진 float 자체의 반올림 오차 (~3e-5)만큼 여유를 둠
+    bool ok = maxPositionError <= positionBound + 1e-4f && maxDirectionError <= directionBound + 1e-3f && roundTrip;
+
+    std::printf("position: max error %.5f (bound %.5f), range %.2f .. %.2f\n", maxPositionError, positionBound,
+                clampedLow, clampedHigh);
+    std::printf("direction: max error %.4f deg (bound %.4f)\n", maxDirectionError, directionBound);
+    std::printf("entry round trip: %s\n", roundTrip ? "ok" : "FAILED");
+    std::printf("error bounds: %s\n\n", ok ? "ok" : "FAILED");
+    return ok;
+}
+
+GameCommand MakeCommand(SimCommandType type, int remote) {
+    GameCommand command;
+    command.type = type;
+    command.remote = remote;
+    command.enqueueNs = 0;
+    return command;
+}
+
+// 탱크들이 원을 그리며 이동하는 Seconds초 매치를 돌리고 초당 바이트 출력
+void RunBandwidth(bool compact, float interestRadius) {
+    RecordingEventSink sink;
+    GameWorld world(sink, interestRadius);
+    world.SetRandomSeed(1234);
+    for (int i = 0; i < TankCount; i++) {
+        world.Apply(MakeCommand(SimCommandType::Join, FirstHostId + i));
+        GameCommand hello = MakeCommand(SimCommandType::Hello, FirstHostId + i);
+        hello.protocolRevision = compact ? CompactMoveProtocolRevision : TickSnapshotProtocolRevision;
+        world.Apply(hello);
+    }
+    world.BroadcastSnapshot(0);
+    sink.Reset();
+
+    uint32_t tickId = 0;
+    uint64_t inboundBytes = 0;
+    int steps = Seconds * MoveRateHz;
+    for (int step = 0; step < steps; step++) {
+        for (int i = 0; i < TankCount; i++) {
+            float angle = (float)step * 0.02f + (float)i;
+            GameCommand command = MakeCommand(SimCommandType::Move, FirstHostId + i);
+            command.pose = SimPoseArgs{ 50.0f + 40.0f * std::cos(angle), 50.0f + 40.0f * std::sin(angle),
+                                        std::fmod(angle * 57.3f, 360.0f) };
+            if (compact) {
+                // 서버가 받는 값과 같게 양자화 후 복원
+                command.pose = SimPoseArgs{
+                    DequantizePosition(QuantizePosition(command.pose.posX, CompactMapOriginX), CompactMapOriginX),
+                    DequantizePosition(QuantizePosition(command.pose.posY, CompactMapOriginY), CompactMapOriginY),
+                    DequantizeDirection(QuantizeDirection(command.pose.direction)) };
+            }
+            world.Apply(command);
+            inboundBytes += compact ? CompactMoveBytes : FloatMoveBytes;
+        }
+        if ((step + 1) % (MoveRateHz / TickRateHz) == 0) {
+            world.BroadcastSnapshot(++tickId);
+        }
+    }
+
+    const GameEventCounters& snapshots = sink.Counters(compact ? GameEventType::TankSnapshotCompact : GameEventType::TankSnapshot);
+    std::printf("%-8s %8.1f %14.0f %14.0f %14.1f\n", compact ? "compact" : "float", interestRadius,
+                (double)inboundBytes / Seconds, (double)snapshots.bytes / Seconds,
+                snapshots.deliveries > 0 ? (double)snapshots.bytes / snapshots.deliveries : 0.0);
+}
+
+} // namespace
+
+int main() {
+    QuietWorldLogs();
+
+    bool ok = CheckErrorBounds();
+
+    std::printf("%d tanks, moves %d Hz, snapshot ticks %d Hz, %d s\n", TankCount, MoveRateHz, TickRateHz, Seconds);
+    std::printf("%-8s %8s %14s %14s %14s\n", "format", "radius", "in B/s", "snapshot B/s", "B/snapshot");
+    for (float radius : { 0.0f, 20.0f }) {
+        RunBandwidth(false, radius);
+        RunBandwidth(true, radius);
+    }
+
+    AsyncLog::Instance().Stop();
+    return ok ? 0 : 1;
+}
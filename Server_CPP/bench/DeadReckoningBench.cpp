@@ -0,0 +1,279 @@
+// 데드 레커닝 전송 억제 - 기록된 트래픽 재생으로 절약한 스냅샷 대역폭과 늘어난 위치 오차 비교
+//
+//   DeadReckoningBench [capture] [--tick-rate N] [--heartbeat MS] [--tanks N] [--seconds S]
+//     capture는 서버가 --capture로 기록한 파일 (RmiReplay와 같은 형식)
+//     없으면 직진/회전/정지를 섞은 합성 주행 캡처를 임시 파일에 만들어 사용 (이동 20Hz, 도착 시각 +-10ms 흔들림)
+//
+// 허용치마다 같은 캡처를 GameWorld에 다시 적용하고, 틱마다 탱크별로 실제 위치(마지막 SendMove)와
+// 관찰자가 보는 위치(데드 레커닝 모델을 그 틱까지 외삽한 위치)의 거리를 잽니다.
+// 끔(0)일 때는 바뀐 위치를 매 틱 보내므로 틱 시점 오차가 0이고, 표의 오차는 억제로 늘어난 만큼입니다.
+// 바이트는 float 스냅샷(OnTankSnapshot) RmiID + 인자 크기 x 수신자 수 기준입니다.
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+#include "../src/RmiCapture.h"
+
+namespace {
+
+struct BenchOptions {
+    std::string capturePath;
+    int tickRateHz = 20;
+    int heartbeatMs = 500;
+    int tanks = 32;
+    int seconds = 60;
+};
+
+bool ParseOptions(int argc, char* argv[], BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value = i + 1 < argc ? argv[i + 1] : "";
+        if (arg == "--tick-rate" && !value.empty()) {
+            options.tickRateHz = std::max(1, std::atoi(value.c_str()));
+            i++;
+        } else if (arg == "--heartbeat" && !value.empty()) {
+            options.heartbeatMs = std::max(0, std::atoi(value.c_str()));
+            i++;
+        } else if (arg == "--tanks" && !value.empty()) {
+            options.tanks = std::max(1, std::atoi(value.c_str()));
+            i++;
+        } else if (arg == "--seconds" && !value.empty()) {
+            options.seconds = std::max(1, std::atoi(value.c_str()));
+            i++;
+        } else if (arg.compare(0, 2, "--") != 0 && options.capturePath.empty()) {
+            options.capturePath = arg;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 합성 주행 캡처 - 탱크마다 2~5초 직진, 1초 동안 회전, 가끔 2초 정지를 반복 (맵 가장자리에서는 안쪽으로 회전)
+bool SynthesizeDriving(const BenchOptions& options, const std::string& path) {
+    RmiCaptureWriter writer;
+    if (!writer.Open(path, 1234)) {
+        return false;
+    }
+
+    struct Driver {
+        float posX, posY, heading;   // heading은 도
+        float turnRate;              // 초당 회전 (도)
+        float speed;                 // 초당 이동 거리
+        double segmentEnd;           // 현재 동작이 끝나는 시각 (초)
+        int state;                   // 0 직진, 1 회전, 2 정지
+    };
+
+    const uint64_t MoveIntervalNs = 50000000;   // 20Hz
+    const int FirstHostId = 3;
+    const float Speed = 8.0f;
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_int_distribution<int> jitterNs(-10000000, 10000000);
+
+    std::vector<Driver> drivers(options.tanks);
+    for (int i = 0; i < options.tanks; i++) {
+        drivers[i] = Driver{ 10.0f + 80.0f * unit(random), 10.0f + 80.0f * unit(random), 360.0f * unit(random),
+                             0.0f, Speed, 2.0 + 3.0 * unit(random), 0 };
+        writer.AppendAt(CaptureRecordKind::Join, 0, FirstHostId + i, 1000000000ull * i / options.tanks, nullptr, 0);
+        writer.AppendAt(CaptureRecordKind::Rmi, CaptureRmiId::SendHello, FirstHostId + i, 1000000000ull * i / options.tanks + 1,
+                        (const uint8_t*)&TickSnapshotProtocolRevision, sizeof(TickSnapshotProtocolRevision));
+    }
+
+    uint64_t endNs = (uint64_t)options.seconds * 1000000000ull;
+    const float dt = MoveIntervalNs / 1e9f;
+    for (uint64_t t = 1000000000ull; t < endNs; t += MoveIntervalNs) {
+        double now = t / 1e9;
+        for (int i = 0; i < options.tanks; i++) {
+            Driver& d = drivers[i];
+            if (now >= d.segmentEnd) {
+                bool nearEdge = d.posX < 10.0f || d.posX > 90.0f || d.posY < 10.0f || d.posY > 90.0f;
+                if (d.state != 0) {
+                    d.state = 0;
+                    d.segmentEnd = now + 2.0 + 3.0 * unit(random);
+                } else if (!nearEdge && unit(random) < 0.25f) {
+                    d.state = 2;
+                    d.segmentEnd = now + 2.0;
+                } else {
+                    // 가장자리면 맵 중앙 쪽으로, 아니면 +-30~120도
+                    float target = nearEdge ? std::atan2(50.0f - d.posY, 50.0f - d.posX) * 57.29578f
+                                            : d.heading + (unit(random) < 0.5f ? -1.0f : 1.0f) * (30.0f + 90.0f * unit(random));
+                    float delta = std::remainder(target - d.heading, 360.0f);
+                    d.state = 1;
+                    d.turnRate = delta;
+                    d.segmentEnd = now + 1.0;
+                }
+            }
+
+            if (d.state == 1) {
+                d.heading += d.turnRate * dt;
+            }
+            if (d.state != 2) {
+                float radians = d.heading / 57.29578f;
+                d.posX += std::cos(radians) * d.speed * dt;
+                d.posY += std::sin(radians) * d.speed * dt;
+            }
+
+            float direction = std::fmod(d.heading + 360.0f * 4, 360.0f);
+            uint8_t payload[12];
+            std::memcpy(payload, &d.posX, 4);
+            std::memcpy(payload + 4, &d.posY, 4);
+            std::memcpy(payload + 8, &direction, 4);
+            uint64_t at = t + MoveIntervalNs * i / options.tanks + (uint64_t)(25000000 + jitterNs(random));
+            writer.AppendAt(CaptureRecordKind::Rmi, CaptureRmiId::SendMove, FirstHostId + i, at, payload, sizeof(payload));
+        }
+    }
+
+    for (int i = 0; i < options.tanks; i++) {
+        writer.AppendAt(CaptureRecordKind::Leave, 0, FirstHostId + i, endNs + 100000000ull + i, nullptr, 0);
+    }
+    writer.Close();
+    return true;
+}
+
+struct RunResult {
+    double seconds = 0.0;
+    uint64_t snapshotBytes = 0;
+    uint64_t forwarded = 0;
+    uint64_t suppressed = 0;
+    std::vector<float> errors;
+};
+
+// 캡처를 한 번 재생하며 틱마다 관찰자 오차 수집
+bool Run(const RmiCaptureReader& reader, const BenchOptions& options, float threshold, RunResult& result) {
+    RecordingEventSink sink;
+    GameWorld world(sink);
+    world.SetRandomSeed(reader.Header().worldSeed);
+    if (threshold > 0.0f) {
+        DeadReckoningConfig config;
+        config.positionThreshold = threshold;
+        config.heartbeatTicks = options.heartbeatMs > 0
+            ? (uint32_t)std::max(1, options.heartbeatMs * options.tickRateHz / 1000) : 0u;
+        world.SetDeadReckoning(config);
+    }
+
+    const uint64_t tickIntervalNs = 1000000000ull / (uint64_t)options.tickRateHz;
+    uint64_t nextTickNs = tickIntervalNs;
+    uint64_t lastNs = 0;
+    uint32_t tickId = 0;
+    std::string message;
+
+    auto runTick = [&]() {
+        world.BroadcastSnapshot(++tickId);
+        const TankRegistry& tanks = world.Tanks();
+        for (size_t i = 0; i < tanks.Size(); i++) {
+            const DeadReckoningModel* model = world.FindDeadReckoningModel(tanks.HostIdAt(i));
+            if (model == nullptr) {
+                // 끔 - 바뀐 위치를 이번 틱에 그대로 보냄
+                result.errors.push_back(0.0f);
+                continue;
+            }
+            result.errors.push_back(DeadReckoningPositionError(*model, tanks.PoseAt(i), tickId));
+        }
+    };
+
+    CaptureCursor cursor = reader.Query(CaptureFilter());
+    CaptureRecord record;
+    while (cursor.Next(record)) {
+        while (record.timestampNs >= nextTickNs) {
+            runTick();
+            nextTickNs += tickIntervalNs;
+        }
+        lastNs = record.timestampNs;
+
+        GameCommand command;
+        if (DecodeCaptureRecord(record, command, message)) {
+            world.Apply(command);
+        }
+    }
+
+    result.seconds = lastNs / 1e9;
+    result.snapshotBytes = sink.Counters(GameEventType::TankSnapshot).bytes;
+    result.forwarded = world.DeadReckoningStatsRef().forwarded.load();
+    result.suppressed = world.DeadReckoningStatsRef().suppressed.load();
+    return true;
+}
+
+float Quantile(std::vector<float>& values, double q) {
+    if (values.empty()) {
+        return 0.0f;
+    }
+    size_t index = std::min(values.size() - 1, (size_t)(q * (values.size() - 1)));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+// 허용치별로 재생해 표 출력
+int Compare(const BenchOptions& options, const std::string& path, bool synthesized) {
+    RmiCaptureReader reader;
+    std::string error;
+    if (!reader.Open(path, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    std::printf("capture: %s%s, tick rate %d Hz, heartbeat %d ms\n", path.c_str(),
+                synthesized ? " (synthetic driving)" : "", options.tickRateHz, options.heartbeatMs);
+    std::printf("%-10s %14s %8s %10s %10s %10s %10s %10s\n", "threshold", "snapshot B/s", "saved", "forwarded",
+                "suppressed", "err avg", "err p99", "err max");
+
+    uint64_t baselineBytes = 0;
+    for (float threshold : { 0.0f, 0.05f, 0.1f, 0.25f, 0.5f, 1.0f }) {
+        RunResult result;
+        Run(reader, options, threshold, result);
+        if (threshold == 0.0f) {
+            baselineBytes = result.snapshotBytes;
+        }
+
+        double sum = 0.0;
+        for (float e : result.errors) {
+            sum += e;
+        }
+        double average = result.errors.empty() ? 0.0 : sum / result.errors.size();
+        float maxError = result.errors.empty() ? 0.0f : *std::max_element(result.errors.begin(), result.errors.end());
+        float p99 = Quantile(result.errors, 0.99);
+        double saved = baselineBytes > 0 ? 100.0 * (1.0 - (double)result.snapshotBytes / baselineBytes) : 0.0;
+
+        char label[16];
+        std::snprintf(label, sizeof(label), threshold > 0.0f ? "%.2f" : "off", threshold);
+        std::printf("%-10s %14.0f %7.1f%% %10llu %10llu %10.4f %10.4f %10.4f\n", label,
+                    result.seconds > 0 ? result.snapshotBytes / result.seconds : 0.0, saved,
+                    (unsigned long long)result.forwarded, (unsigned long long)result.suppressed, average, p99, maxError);
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "usage: DeadReckoningBench [capture] [--tick-rate N] [--heartbeat MS] [--tanks N] [--seconds S]\n");
+        return 2;
+    }
+
+    QuietWorldLogs();
+
+    std::string path = options.capturePath;
+    bool synthesized = path.empty();
+    if (synthesized) {
+        path = "DeadReckoningBench.cap";
+        if (!SynthesizeDriving(options, path)) {
+            std::fprintf(stderr, "cannot create %s\n", path.c_str());
+            return 1;
+        }
+    }
+
+    int result = Compare(options, path, synthesized);
+    if (synthesized) {
+        std::remove(path.c_str());
+    }
+    AsyncLog::Instance().Stop();
+    return result;
+}
@@ -0,0 +1,272 @@
+// 델타 스냅샷 압축률 벤치마크 - 캡처된 이동을 float / 압축 / 델타 형식으로 각각 재생해 클라이언트당 스냅샷 바이트를 비교
+//
+//   DeltaSnapshotBench <capture> [--ack-delay N] [--tick-rate N]
+//     캡처는 서버의 --capture 또는 RmiReplay --synthesize로 만듭니다.
+//     접속 직후 각 클라이언트가 그 형식의 리비전으로 SendHello를 보낸 것으로 보고, 델타 모드에서는 클라이언트가
+//     받은 틱을 N틱 뒤에 ack합니다 (기본은 1, 3, 10, 40틱을 차례로 실행 - 40틱은 기록 범위 32틱을 넘어 전체 스냅샷으로 대체됨).
+//     델타 모드는 틱마다 모든 클라이언트가 복원한 방 상태를 서버의 양자화 상태와 비교하며, 다르면 종료 코드 1.
+//
+// 바이트는 RmiID(2바이트) + 인자 크기 기준이며 ProudNet 헤더/암호화는 포함하지 않습니다.
+// 델타 형식은 체력/타입/파괴 상태도 싣지만 (float/압축은 위치만), 별도 이벤트 RMI는 모든 형식에서 그대로 나가므로 비교에서 제외했습니다.
+
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/DeltaSnapshot.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+#include "../src/RmiCapture.h"
+
+namespace {
+
+// 시뮬레이션 클라이언트의 델타 수신 상태
+struct DeltaClient {
+    std::map<uint32_t, std::vector<DeltaTankState>> states;   // 기준으로 쓰일 수 있는 틱의 복원 상태
+    uint32_t latestTick = 0;
+};
+
+struct PendingAck {
+    uint32_t dueTick;
+    int hostId;
+    uint32_t tickId;
+};
+
+// 델타 스냅샷을 수신자마다 복원하고 ack를 예약하는 싱크
+class DeltaClientSink : public RecordingEventSink {
+public:
+    explicit DeltaClientSink(uint32_t ackDelay) : ackDelay(ackDelay) {}
+
+    void OnTankDeltaSnapshot(const int* recipients, int count, int tickId, int baselineTickId,
+                             const uint8_t* data, size_t size) override {
+        RecordingEventSink::OnTankDeltaSnapshot(recipients, count, tickId, baselineTickId, data, size);
+
+        static const std::vector<DeltaTankState> EmptyBaseline;
+        for (int i = 0; i < count; i++) {
+            DeltaClient& client = clients[recipients[i]];
+            const std::vector<DeltaTankState>* baseline = &EmptyBaseline;
+            if (baselineTickId != 0) {
+                auto it = client.states.find((uint32_t)baselineTickId);
+                if (it == client.states.end()) {
+                    decodeErrors++;
+                    continue;
+                }
+                baseline = &it->second;
+            }
+
+            std::vector<DeltaTankState> state;
+            if (!ApplyDeltaSnapshot(*baseline, data, size, state)) {
+                decodeErrors++;
+                continue;
+            }
+            // 서버는 방금 쓴 기준보다 오래된 기준으로 돌아가지 않음
+            client.states.erase(client.states.begin(), client.states.lower_bound((uint32_t)baselineTickId));
+            client.states[(uint32_t)tickId] = std::move(state);
+            client.latestTick = (uint32_t)tickId;
+            acks.push_back(PendingAck{ (uint32_t)tickId + ackDelay, recipients[i], (uint32_t)tickId });
+        }
+    }
+
+    // 다음 틱 전에 도착하는 ack를 월드에 적용
+    void DeliverAcks(GameWorld& world, uint32_t nextTickId) {
+        while (!acks.empty() && acks.front().dueTick <= nextTickId) {
+            GameCommand command;
+            command.type = SimCommandType::SnapshotAck;
+            command.remote = acks.front().hostId;
+            command.enqueueNs = 0;
+            command.ackTickId = acks.front().tickId;
+            world.Apply(command);
+            acks.pop_front();
+            ackCount++;
+        }
+    }
+
+    // 모든 델타 클라이언트의 최신 복원 상태가 서버 상태와 같은지 확인
+    void Verify(const GameWorld& world) {
+        expected.clear();
+        const TankRegistry& tanks = world.Tanks();
+        for (size_t i = 0; i < tanks.Size(); i++) {
+            expected.push_back(MakeDeltaTankState(tanks.HostIdAt(i), tanks.PoseAt(i), tanks.StatusAt(i)));
+        }
+        std::sort(expected.begin(), expected.end(),
+                  [](const DeltaTankState& a, const DeltaTankState& b) { return a.clientId < b.clientId; });
+
+        for (auto it = clients.begin(); it != clients.end(); ) {
+            if (!world.UsesDeltaSnapshot(it->first)) {
+                it = clients.erase(it);
+                continue;
+            }
+            const std::vector<DeltaTankState>& state = it->second.states[it->second.latestTick];
+            bool same = state.size() == expected.size();
+            for (size_t i = 0; same && i < state.size(); i++) {
+                same = state[i].clientId == expected[i].clientId && state[i].posX == expected[i].posX
+                    && state[i].posY == expected[i].posY && state[i].direction == expected[i].direction
+                    && state[i].isDestroyed == expected[i].isDestroyed && state[i].tankType == expected[i].tankType
+                    && std::memcmp(&state[i].currentHealth, &expected[i].currentHealth, 4) == 0
+                    && std::memcmp(&state[i].maxHealth, &expected[i].maxHealth, 4) == 0;
+            }
+            mismatches += same ? 0 : 1;
+            ++it;
+        }
+    }
+
+    uint64_t decodeErrors = 0;
+    uint64_t mismatches = 0;
+    uint64_t ackCount = 0;
+
+private:
+    uint32_t ackDelay;
+    std::unordered_map<int, DeltaClient> clients;
+    std::deque<PendingAck> acks;
+    std::vector<DeltaTankState> expected;
+};
+
+struct ModeResult {
+    uint64_t snapshotBytes = 0;
+    uint64_t snapshotDeliveries = 0;
+    uint64_t clientTicks = 0;       // 틱마다 그 형식을 받는 클라이언트 수의 합
+    uint64_t ackCount = 0;
+    uint64_t fullFallbacks = 0;
+    bool verified = true;
+};
+
+// 캡처를 한 형식으로 재생 (접속마다 protocolRevision으로 Hello)
+ModeResult RunMode(RmiCaptureReader& reader, int tickRateHz, int protocolRevision, uint32_t ackDelay) {
+    DeltaClientSink sink(ackDelay);
+    GameWorld world(sink);
+    world.SetRandomSeed(reader.Header().worldSeed);
+
+    SnapshotFormat format = protocolRevision >= DeltaSnapshotProtocolRevision ? SnapshotFormat::Delta
+                          : protocolRevision >= CompactMoveProtocolRevision ? SnapshotFormat::Compact : SnapshotFormat::Float;
+    const uint64_t tickIntervalNs = 1000000000ull / (uint64_t)tickRateHz;
+    uint64_t nextTickNs = tickIntervalNs;
+    uint32_t tickId = 0;
+    ModeResult result;
+
+    auto runTick = [&]() {
+        sink.DeliverAcks(world, tickId + 1);
+        world.BroadcastSnapshot(++tickId);
+        result.clientTicks += (uint64_t)world.SnapshotStatsRef().Format(format).clients.load(std::memory_order_relaxed);
+        if (format == SnapshotFormat::Delta) {
+            sink.Verify(world);
+        }
+    };
+
+    std::string message;
+    CaptureCursor cursor = reader.All();
+    CaptureRecord record;
+    while (cursor.Next(record)) {
+        while (record.timestampNs >= nextTickNs) {
+            runTick();
+            nextTickNs += tickIntervalNs;
+        }
+
+        GameCommand command;
+        if (!DecodeCaptureRecord(record, command, message) || command.type == SimCommandType::Hello
+            || command.type == SimCommandType::SnapshotAck) {
+            continue;   // 캡처된 Hello/ack 대신 이 모드의 값을 사용
+        }
+        world.Apply(command);
+        if (command.type == SimCommandType::Join) {
+            GameCommand hello = command;
+            hello.type = SimCommandType::Hello;
+            hello.protocolRevision = protocolRevision;
+            world.Apply(hello);
+        }
+    }
+
+    static const GameEventType types[] = { GameEventType::TankSnapshot, GameEventType::TankSnapshotCompact,
+                                           GameEventType::TankDeltaSnapshot };
+    const GameEventCounters& counters = sink.Counters(types[(size_t)format]);
+    result.snapshotBytes = counters.bytes;
+    result.snapshotDeliveries = counters.deliveries;
+    result.ackCount = sink.ackCount;
+    result.fullFallbacks = world.SnapshotStatsRef().fullFallbacks.load(std::memory_order_relaxed);
+    result.verified = sink.decodeErrors == 0 && sink.mismatches == 0;
+    if (!result.verified) {
+        std::printf("  decode errors %llu, state mismatches %llu\n", (unsigned long long)sink.decodeErrors,
+                    (unsigned long long)sink.mismatches);
+    }
+    return result;
+}
+
+void PrintResult(const char* name, int tickRateHz, const ModeResult& result, double floatBytesPerClientSecond) {
+    double clientSeconds = (double)result.clientTicks / tickRateHz;
+    double bytesPerClientSecond = clientSeconds > 0.0 ? result.snapshotBytes / clientSeconds : 0.0;
+    // ack는 SendSnapshotAck(RmiID + int) = 6바이트
+    double ackBytesPerClientSecond = clientSeconds > 0.0 ? result.ackCount * 6.0 / clientSeconds : 0.0;
+    std::printf("%-10s %14.0f %10.2f %12.1f %14.0f %10llu %8s\n", name, bytesPerClientSecond,
+                bytesPerClientSecond > 0.0 ? floatBytesPerClientSecond / bytesPerClientSecond : 0.0,
+                result.snapshotDeliveries > 0 ? (double)result.snapshotBytes / result.snapshotDeliveries : 0.0,
+                ackBytesPerClientSecond, (unsigned long long)result.fullFallbacks, result.verified ? "ok" : "FAILED");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string capturePath;
+    int tickRateHz = 20;
+    std::vector<uint32_t> ackDelays = { 1, 3, 10, 40 };
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value = i + 1 < argc ? argv[i + 1] : "";
+        if (arg == "--ack-delay" && !value.empty()) {
+            ackDelays = { (uint32_t)std::max(1, std::atoi(value.c_str())) };
+            i++;
+        } else if (arg == "--tick-rate" && !value.empty()) {
+            tickRateHz = std::max(1, std::atoi(value.c_str()));
+            i++;
+        } else if (capturePath.empty() && arg[0] != '-') {
+            capturePath = arg;
+        } else {
+            capturePath.clear();
+            break;
+        }
+    }
+    if (capturePath.empty()) {
+        std::fprintf(stderr, "usage: DeltaSnapshotBench <capture> [--ack-delay N] [--tick-rate N]\n"
+                             "  (create a capture with the server's --capture or RmiReplay --synthesize)\n");
+        return 2;
+    }
+
+    RmiCaptureReader reader;
+    std::string error;
+    if (!reader.Open(capturePath, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    QuietWorldLogs();
+
+    std::printf("capture: %s (%llu records, %.1f s), tick rate %d Hz\n", capturePath.c_str(),
+                (unsigned long long)reader.RecordCount(), reader.EndTimestampNs() / 1e9, tickRateHz);
+    std::printf("%-10s %14s %10s %12s %14s %10s %8s\n",
+                "format", "B/client/s", "vs float", "B/snapshot", "ack B/cl/s", "full", "state");
+
+    ModeResult floatResult = RunMode(reader, tickRateHz, TickSnapshotProtocolRevision, 0);
+    double floatClientSeconds = (double)floatResult.clientTicks / tickRateHz;
+    double floatBytesPerClientSecond = floatClientSeconds > 0.0 ? floatResult.snapshotBytes / floatClientSeconds : 0.0;
+    PrintResult("float", tickRateHz, floatResult, floatBytesPerClientSecond);
+    if (floatResult.clientTicks == 0) {
+        // 접속/이동 기록이 없는 캡처는 비교할 것이 없으므로 성공으로 치지 않음
+        std::fprintf(stderr, "capture has no client ticks to replay\n");
+        AsyncLog::Instance().Stop();
+        return 1;
+    }
+    PrintResult("compact", tickRateHz, RunMode(reader, tickRateHz, CompactMoveProtocolRevision, 0), floatBytesPerClientSecond);
+
+    bool ok = true;
+    for (uint32_t delay : ackDelays) {
+        ModeResult result = RunMode(reader, tickRateHz, DeltaSnapshotProtocolRevision, delay);
+        std::string name = "delta/" + std::to_string(delay);
+        PrintResult(name.c_str(), tickRateHz, result, floatBytesPerClientSecond);
+        ok = ok && result.verified;
+    }
+
+    AsyncLog::Instance().Stop();
+    return ok ? 0 : 1;
+}
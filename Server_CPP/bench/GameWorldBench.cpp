@@ -0,0 +1,98 @@
+// 네트워크 없이 실제 게임 로직(GameWorld)을 구동하는 벤치마크
+// ProudNet 대신 RecordingEventSink를 붙이고, SendMove/SendFire 핸들러가 만드는 것과 같은 명령을
+// GameWorld::Apply로 수백만 건 적용하면서 탱크 수만큼 이동할 때마다 스냅샷 틱을 돌립니다.
+// 명령 처리량과 함께 싱크가 집계한 전달 건수/예상 송신 바이트를 출력합니다.
+
+#include <cmath>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+
+namespace {
+
+const int CommandCount = 2000000;
+const int FireEvery = 16;       // 16번에 한 번은 발사 (SendFire)
+const int FirstHostId = 3;      // ProudNet 클라이언트 HostID 시작 값
+
+GameCommand MakeCommand(SimCommandType type, int remote) {
+    GameCommand command;
+    command.type = type;
+    command.remote = remote;
+    command.enqueueNs = 0;
+    return command;
+}
+
+void RunCase(int tankCount, float interestRadius) {
+    RecordingEventSink sink;
+    GameWorld world(sink, interestRadius);
+    world.SetRandomSeed(1234);
+
+    for (int i = 0; i < tankCount; i++) {
+        world.Apply(MakeCommand(SimCommandType::Join, FirstHostId + i));
+        GameCommand hello = MakeCommand(SimCommandType::Hello, FirstHostId + i);
+        hello.protocolRevision = TickSnapshotProtocolRevision;
+        world.Apply(hello);
+    }
+    GameEventCounters joinTotal = sink.Total();
+    sink.Reset();
+
+    // 명령은 미리 만들어 두고 적용 시간만 측정 (이동은 0~100 범위에서 원을 그리며 움직임)
+    std::vector<GameCommand> commands;
+    commands.reserve(CommandCount);
+    for (int i = 0; i < CommandCount; i++) {
+        int remote = FirstHostId + i % tankCount;
+        if (i % FireEvery == 0) {
+            GameCommand command = MakeCommand(SimCommandType::Fire, remote);
+            command.fire = SimFireArgs{ remote, (float)(i % 360), 25.0f, 1.0f, 0.5f, 2.0f };
+            commands.push_back(command);
+        } else {
+            float t = (float)(i / tankCount) * 0.01f + (float)(i % tankCount);
+            GameCommand command = MakeCommand(SimCommandType::Move, remote);
+            command.pose = SimPoseArgs{ 50.0f + 40.0f * std::cos(t), 50.0f + 40.0f * std::sin(t), (float)(i % 360) };
+            commands.push_back(command);
+        }
+    }
+
+    uint32_t tickId = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < CommandCount; i++) {
+        world.Apply(commands[i]);
+        if ((i + 1) % tankCount == 0) {
+            world.BroadcastSnapshot(++tickId);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    GameEventCounters total = sink.Total();
+    const GameEventCounters& bullets = sink.Counters(GameEventType::SpawnBullet);
+    const GameEventCounters& snapshots = sink.Counters(GameEventType::TankSnapshot);
+    std::printf("%6d %8.1f %12.0f %9.1f %12.0f %12.0f %12.0f %10llu\n",
+                tankCount, interestRadius, CommandCount / seconds, seconds * 1e9 / CommandCount,
+                total.deliveries / seconds, bullets.bytes / (double)tickId, snapshots.bytes / (double)tickId,
+                (unsigned long long)joinTotal.deliveries);
+}
+
+} // namespace
+
+int main() {
+    QuietWorldLogs();
+
+    std::printf("%d commands (1/%d SendFire, rest SendMove), one snapshot tick per <tanks> commands\n",
+                CommandCount, FireEvery);
+    std::printf("%6s %8s %12s %9s %12s %12s %12s %10s\n",
+                "tanks", "radius", "cmds/s", "ns/cmd", "deliv/s", "bullet B/tk", "snap B/tk", "join deliv");
+
+    const int tankCounts[] = { 16, 64, 256, 1024 };
+    const float radii[] = { 0.0f, 20.0f };
+    for (float radius : radii) {
+        for (int tankCount : tankCounts) {
+            RunCase(tankCount, radius);
+        }
+    }
+
+    AsyncLog::Instance().Stop();
+    return 0;
+}
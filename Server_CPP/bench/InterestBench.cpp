@@ -0,0 +1,202 @@
+// 관심 영역(공간 해시) 적용 전후 송신 메시지 수 비교 벤치마크
+// 1000대의 탱크를 여러 크기의 맵에 흩뿌리고, 탱크당 초당 30회 이동할 때
+// 전체 브로드캐스트 대비 관심 영역 필터링으로 줄어드는 초당 송신 메시지 수를 측정합니다
+// 측정 전에 InterestVisibility로 탱크가 관찰자의 관심 영역에 들어오고 나가는 판정을 확인합니다 (실패하면 종료 코드 1)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/InterestVisibility.h"
+#include "../src/SpatialHash.h"
+
+namespace {
+
+const int TankCount = 1000;
+const int MovesPerSecond = 30;
+const int TickRateHz = 20;
+const float MoveStep = 2.0f;
+
+struct SimTank {
+    float x;
+    float y;
+};
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("enter/leave check FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+// 서버의 관심 영역 틱과 같은 순서로 관찰자 하나를 비교해 들어온 탱크와 나간 탱크를 구함
+void DiffObserver(InterestVisibility& visibility, const SpatialHash& hash, const std::vector<SimTank>& simTanks,
+                  int observer, float radius, std::vector<int>& entered, std::vector<int>& left) {
+    entered.clear();
+    left.clear();
+    visibility.BeginObserver((uint32_t)observer, [&](auto mark) {
+        for (size_t i = 0; i < simTanks.size(); i++) {
+            mark((uint32_t)i);
+        }
+    });
+    hash.QueryRadius(simTanks[observer].x, simTanks[observer].y, radius, [&](int id) {
+        if (id != observer && visibility.Enter((uint32_t)id)) {
+            entered.push_back(id);
+        }
+    });
+    visibility.ForEachLeft([&](uint32_t slot) { left.push_back((int)slot); });
+    visibility.Commit();
+}
+
+bool Contains(const std::vector<int>& ids, int id) {
+    return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+// 반경 20에서 관찰자 A(슬롯 0)가 멈춰 있는 탱크 B(슬롯 1)에 다가갔다 멀어짐
+// 방 상태를 받은 뒤 첫 틱에 범위 밖의 B를 숨기고, 들어오면 다시 보이고, 나가면 다시 숨겨야 함
+bool CheckEnterLeave() {
+    const float radius = 20.0f;
+    const int observer = 0;
+    const int target = 1;
+
+    std::vector<SimTank> simTanks = { SimTank{ 10.0f, 10.0f }, SimTank{ 90.0f, 90.0f } };
+    SpatialHash hash(radius);
+    InterestVisibility visibility;
+    for (int i = 0; i < (int)simTanks.size(); i++) {
+        hash.Update(i, simTanks[i].x, simTanks[i].y);
+        visibility.AddSlot((uint32_t)i);
+    }
+
+    std::vector<int> entered;
+    std::vector<int> left;
+    bool ok = true;
+    DiffObserver(visibility, hash, simTanks, observer, radius, entered, left);
+    ok &= Expect(Contains(left, target) && entered.empty(), "B not hidden from A after the room state");
+
+    simTanks[observer] = SimTank{ 80.0f, 80.0f };
+    hash.Update(observer, 80.0f, 80.0f);
+    DiffObserver(visibility, hash, simTanks, observer, radius, entered, left);
+    ok &= Expect(Contains(entered, target) && left.empty(), "B did not enter A's range");
+
+    simTanks[observer] = SimTank{ 81.0f, 80.0f };
+    hash.Update(observer, 81.0f, 80.0f);
+    DiffObserver(visibility, hash, simTanks, observer, radius, entered, left);
+    ok &= Expect(entered.empty() && left.empty(), "B entered or left while staying in range");
+
+    simTanks[observer] = SimTank{ 10.0f, 10.0f };
+    hash.Update(observer, 10.0f, 10.0f);
+    DiffObserver(visibility, hash, simTanks, observer, radius, entered, left);
+    ok &= Expect(Contains(left, target) && entered.empty(), "B not hidden from A after leaving range");
+
+    // 퇴장한 탱크는 범위 밖 알림 없이 지워짐
+    simTanks[observer] = SimTank{ 85.0f, 85.0f };
+    hash.Update(observer, 85.0f, 85.0f);
+    DiffObserver(visibility, hash, simTanks, observer, radius, entered, left);
+    ok &= Expect(Contains(entered, target), "B did not re-enter A's range");
+    visibility.RemoveSlot((uint32_t)target);
+    hash.Remove(target);
+    DiffObserver(visibility, hash, simTanks, observer, radius, entered, left);
+    ok &= Expect(left.empty(), "range notice for a tank that left the room");
+
+    std::printf("enter/leave check: %s\n", ok ? "ok" : "FAIL");
+    return ok;
+}
+
+void RunMap(float mapSize, float radius) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> pos(0.0f, mapSize);
+    std::uniform_real_distribution<float> step(-MoveStep, MoveStep);
+
+    std::vector<SimTank> simTanks(TankCount);
+    SpatialHash hash(radius);
+    for (int i = 0; i < TankCount; i++) {
+        simTanks[i] = SimTank{ pos(rng), pos(rng) };
+        hash.Update(i, simTanks[i].x, simTanks[i].y);
+    }
+
+    // 1초 분량의 이동을 시뮬레이션 (모든 탱크가 MovesPerSecond번 이동)
+    uint64_t interestMessages = 0;
+    std::vector<int> movedThisTick(TankCount, 0);
+    std::vector<int> receivedThisTick(TankCount, 0);
+    uint64_t snapshotRmis = 0;
+    uint64_t snapshotEntries = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < MovesPerSecond; round++) {
+        for (int i = 0; i < TankCount; i++) {
+            SimTank& t = simTanks[i];
+            t.x = std::min(mapSize, std::max(0.0f, t.x + step(rng)));
+            t.y = std::min(mapSize, std::max(0.0f, t.y + step(rng)));
+            hash.Update(i, t.x, t.y);
+
+            // 이동 이벤트 하나당 관심 영역 안의 다른 클라이언트 수만큼 송신
+            hash.QueryRadius(t.x, t.y, radius, [&](int id) {
+                if (id != i) {
+                    interestMessages++;
+                }
+            });
+            movedThisTick[i] = 1;
+        }
+
+        // 틱 경계마다 수신자별 스냅샷 RMI 수를 집계
+        if (((round + 1) * TickRateHz) / MovesPerSecond != (round * TickRateHz) / MovesPerSecond) {
+            for (int i = 0; i < TankCount; i++) {
+                if (!movedThisTick[i]) {
+                    continue;
+                }
+                hash.QueryRadius(simTanks[i].x, simTanks[i].y, radius, [&](int id) {
+                    if (id != i) {
+                        receivedThisTick[id]++;
+                        snapshotEntries++;
+                    }
+                });
+                movedThisTick[i] = 0;
+            }
+            for (int i = 0; i < TankCount; i++) {
+                if (receivedThisTick[i] > 0) {
+                    snapshotRmis++;
+                    receivedThisTick[i] = 0;
+                }
+            }
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double elapsedMs = std::chrono::duration<double, std::milli>(end - start).count();
+    uint64_t broadcastMessages = (uint64_t)TankCount * MovesPerSecond * (TankCount - 1);
+    double density = TankCount / ((mapSize / 1000.0) * (mapSize / 1000.0));
+    double avgNeighbors = (double)interestMessages / ((double)TankCount * MovesPerSecond);
+
+    std::printf("%8.0f %12.1f %10.1f %14llu %14llu %8.1fx %14llu %14llu %10.2f\n",
+                mapSize, density, avgNeighbors,
+                (unsigned long long)broadcastMessages, (unsigned long long)interestMessages,
+                interestMessages > 0 ? (double)broadcastMessages / interestMessages : 0.0,
+                (unsigned long long)snapshotRmis, (unsigned long long)snapshotEntries,
+                elapsedMs);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    float radius = argc > 1 ? (float)std::atof(argv[1]) : 100.0f;
+
+    if (!CheckEnterLeave()) {
+        return 1;
+    }
+
+    std::printf("tanks=%d, moves/s per tank=%d, tick=%d Hz, interest radius=%.0f\n",
+                TankCount, MovesPerSecond, TickRateHz, radius);
+    std::printf("%8s %12s %10s %14s %14s %9s %14s %14s %10s\n",
+                "map", "tanks/km2", "neighbors", "relay-all/s", "relay-aoi/s", "saving",
+                "snap-rmi/s", "snap-entry/s", "cpu ms/s");
+
+    const float mapSizes[] = { 500.0f, 1000.0f, 2000.0f, 4000.0f, 8000.0f, 16000.0f };
+    for (float mapSize : mapSizes) {
+        RunMap(mapSize, radius);
+    }
+    return 0;
+}
@@ -0,0 +1,167 @@
+// 방 크기별 늦은 접속 비용 벤치마크
+// 기존 방식: 접속할 때마다 기존 탱크 하나당 OnPlayerJoined + OnTankHealthUpdated (+ 파괴 상태면 OnTankDestroyed)를 따로 전송
+// 현재 방식: 접속자는 대기 목록에 들어가 SendHello를 보내고, 다음 틱에 방 전체 상태를 OnWorldSnapshot 한 번으로 같은 틱 접속자 모두에게 전송
+// 같은 방을 RecordingEventSink로 구동해 접속 한 건당 서버 처리 시간, 접속자가 받는 RMI 수와 바이트를 비교합니다.
+// 현재 방식의 처리 시간은 접속 + 그 틱의 스냅샷 전송까지이며 (기존 방식은 틱 제외), 접속자는 최대 한 틱 간격 뒤에 방 상태를 받습니다.
+
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+#include "../src/RmiMetrics.h"
+
+namespace {
+
+const int Rounds = 2000;
+const int FirstHostId = 3;
+const int DestroyedEvery = 10;   // 10대 중 1대는 파괴 상태
+
+GameCommand MakeCommand(SimCommandType type, int remote) {
+    GameCommand command;
+    command.type = type;
+    command.remote = remote;
+    command.enqueueNs = 0;
+    return command;
+}
+
+// 접속 직후 SendHello (보내지 않으면 월드가 기존 방식의 탱크별 RMI로 방 상태를 보냄)
+void SendHello(GameWorld& world, int hostId) {
+    GameCommand hello = MakeCommand(SimCommandType::Hello, hostId);
+    hello.protocolRevision = TickSnapshotProtocolRevision;
+    world.Apply(hello);
+}
+
+// 방을 roomSize대로 채우고 일부를 파괴 상태로 만듦
+void FillRoom(GameWorld& world, RecordingEventSink& sink, int roomSize) {
+    for (int i = 0; i < roomSize; i++) {
+        world.Apply(MakeCommand(SimCommandType::Join, FirstHostId + i));
+        SendHello(world, FirstHostId + i);
+        if (i % DestroyedEvery == 0) {
+            GameCommand command = MakeCommand(SimCommandType::Destroyed, FirstHostId + i);
+            command.destroyedById = 0;
+            world.Apply(command);
+        }
+    }
+    world.BroadcastSnapshot(0);
+    sink.Reset();
+}
+
+// 기존 ApplyJoin의 새 클라이언트 초기화 루프 (탱크마다 개별 RMI)
+void LegacyBootstrap(const GameWorld& world, GameEventSink& sink, int hostId) {
+    const TankRegistry& tanks = world.Tanks();
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        int tankId = tanks.HostIdAt(i);
+        if (tankId != hostId) {
+            const TankPose& pose = tanks.PoseAt(i);
+            const TankStatus& status = tanks.StatusAt(i);
+            sink.OnPlayerJoined(&hostId, 1, tankId, pose.posX, pose.posY, status.tankType);
+            sink.OnTankHealthUpdated(&hostId, 1, tankId, status.currentHealth, status.maxHealth);
+            if (status.isDestroyed) {
+                sink.OnTankDestroyed(&hostId, 1, tankId, 0);
+            }
+        }
+    }
+}
+
+struct JoinResult {
+    LatencyHistogramSnapshot latency;   // 접속 한 건당 처리 시간
+    double rmisPerJoiner;               // 접속자가 초기화로 받는 RMI 수
+    double bytesPerJoiner;              // 접속자가 초기화로 받는 예상 바이트
+};
+
+// 라운드마다 joinersPerTick명이 접속하고 한 틱을 돈 뒤 모두 퇴장 (방 크기 유지)
+JoinResult RunCase(int roomSize, int joinersPerTick, bool legacy) {
+    RecordingEventSink sink;
+    GameWorld world(sink);
+    world.SetRandomSeed(1234);
+    FillRoom(world, sink, roomSize);
+
+    LatencyHistogram latency;
+    uint64_t bootstrapRmis = 0;
+    uint64_t bootstrapBytes = 0;
+    uint32_t tickId = 0;
+    int nextHostId = FirstHostId + roomSize;
+
+    for (int round = 0; round < Rounds; round++) {
+        int firstJoiner = nextHostId;
+        uint64_t before[(size_t)GameEventType::Count];
+        for (int t = 0; t < (int)GameEventType::Count; t++) {
+            before[t] = sink.Counters((GameEventType)t).deliveries;
+        }
+
+        int64_t start = RmiMetrics::NowNs();
+        for (int j = 0; j < joinersPerTick; j++) {
+            int hostId = nextHostId++;
+            world.ApplyJoin(hostId);
+            if (legacy) {
+                LegacyBootstrap(world, sink, hostId);
+            } else {
+                SendHello(world, hostId);
+            }
+        }
+        if (!legacy) {
+            world.BroadcastSnapshot(++tickId);
+        }
+        int64_t elapsed = RmiMetrics::NowNs() - start;
+        for (int j = 0; j < joinersPerTick; j++) {
+            latency.Record((uint64_t)(elapsed / joinersPerTick));
+        }
+
+        // 초기화 메시지만 집계 (기존 방식은 개별 RMI, 현재 방식은 OnWorldSnapshot)
+        if (legacy) {
+            for (GameEventType type : { GameEventType::PlayerJoined, GameEventType::TankHealthUpdated, GameEventType::TankDestroyed }) {
+                bootstrapRmis += sink.Counters(type).deliveries - before[(size_t)type];
+            }
+        } else {
+            bootstrapRmis += sink.Counters(GameEventType::WorldSnapshot).deliveries - before[(size_t)GameEventType::WorldSnapshot];
+        }
+
+        // 퇴장하면 대기 목록에서도 빠지므로, 기존 방식에서는 틱 없이 OnWorldSnapshot이 나가지 않음
+        for (int hostId = firstJoiner; hostId < nextHostId; hostId++) {
+            world.ApplyLeave(hostId);
+        }
+        world.BroadcastSnapshot(++tickId);
+    }
+
+    if (legacy) {
+        // 기존 방식 바이트는 접속자 한 명에게 간 개별 RMI 크기 합 (다른 클라이언트에게 가는 알림 제외)
+        RecordingEventSink probe;
+        LegacyBootstrap(world, probe, -1);
+        bootstrapBytes = probe.Total().bytes * (uint64_t)Rounds * (uint64_t)joinersPerTick;
+    } else {
+        bootstrapBytes = sink.Counters(GameEventType::WorldSnapshot).bytes;
+    }
+
+    uint64_t joiners = (uint64_t)Rounds * (uint64_t)joinersPerTick;
+    return JoinResult{ latency.Snapshot(), (double)bootstrapRmis / joiners, (double)bootstrapBytes / joiners };
+}
+
+void PrintResult(const char* name, int roomSize, int joinersPerTick, const JoinResult& result) {
+    std::printf("%-8s %6d %6d %10.2f %10.2f %10.2f %12.1f %12.0f\n", name, roomSize, joinersPerTick,
+                result.latency.ValueAtQuantile(0.50) / 1000.0, result.latency.ValueAtQuantile(0.99) / 1000.0,
+                result.latency.AverageNs() / 1000.0, result.rmisPerJoiner, result.bytesPerJoiner);
+}
+
+} // namespace
+
+int main() {
+    QuietWorldLogs();
+
+    std::printf("%d rounds per case, 1/%d of room tanks destroyed, server time per join (batched includes the tick)\n",
+                Rounds, DestroyedEvery);
+    std::printf("%-8s %6s %6s %10s %10s %10s %12s %12s\n",
+                "mode", "room", "join/t", "p50 us", "p99 us", "avg us", "rmis/joiner", "bytes/joiner");
+
+    const int roomSizes[] = { 16, 64, 200, 500, 1000 };
+    const int joinersPerTick[] = { 1, 8 };
+    for (int joiners : joinersPerTick) {
+        for (int roomSize : roomSizes) {
+            PrintResult("legacy", roomSize, joiners, RunCase(roomSize, joiners, true));
+            PrintResult("batched", roomSize, joiners, RunCase(roomSize, joiners, false));
+        }
+    }
+
+    AsyncLog::Instance().Stop();
+    return 0;
+}
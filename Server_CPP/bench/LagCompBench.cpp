@@ -0,0 +1,200 @@
+// 포탄 지연 보상 - 탱크 256대 방에서 발사 하나를 쏜 클라이언트의 RTT만큼 되감아 따라잡는 비용과 위치 기록 메모리
+//
+//   LagCompBench [--tanks N] [--shots N] [--samples N] [--move-rate N]
+//     기본은 탱크 256대가 30Hz로 이동 (2초 예열), 탱크마다 위치 32개 보관, RTT 0/50/100/200/400ms에서 발사 5000번
+//
+// 모든 SendMove가 받은 시각과 함께 링 버퍼에 기록되고, SendFire는 포탄을 RTT 전에 만든 것으로 보고 20Hz 틱 간격마다
+// 모든 탱크 위치를 그 시각으로 보간해 지금까지 따라잡습니다. 발사 하나의 GameWorld::Apply 시간을 재므로
+// RTT 0ms 줄(되감지 않음)과의 차이가 되감기/판정 비용입니다. 명령 시각은 가상 시계라 실행마다 같은 결과가 나옵니다.
+// 명중해도 탱크가 줄지 않도록 피해는 0으로 둡니다. 마지막 표는 이동 하나를 기록하는 추가 비용입니다
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+
+namespace {
+
+const int FirstHostId = 3;
+const int TickRateHz = 20;
+const int WarmupSeconds = 2;
+const int MaxRewindMs = 1000;
+const int64_t StartNs = 1000000000000LL;
+
+struct BenchOptions {
+    int tanks = 256;
+    int shots = 5000;
+    int samples = 32;
+    int moveRateHz = 30;
+};
+
+// 명중해도 탱크가 파괴되지 않도록 피해 0
+ProjectileConfig MakeProjectileConfig() {
+    ProjectileConfig projectiles;
+    projectiles.tickSeconds = 1.0f / TickRateHz;
+    projectiles.hitDamage = 0.0f;
+    return projectiles;
+}
+
+GameCommand MakeCommand(SimCommandType type, int remote, int64_t timeNs) {
+    GameCommand command;
+    command.type = type;
+    command.remote = remote;
+    command.enqueueNs = timeNs;
+    return command;
+}
+
+// 탱크 256대가 각자 원을 그리며 움직이는 방 (maxRewindMs가 0이면 지연 보상 끔)
+class BenchRoom {
+public:
+    BenchRoom(const BenchOptions& options, int maxRewindMs) : options(options), world(sink) {
+        world.SetRandomSeed(1234);
+        world.SetProjectiles(MakeProjectileConfig());
+        LagCompensationConfig lag;
+        lag.maxRewindMs = maxRewindMs;
+        lag.historySamples = (uint32_t)options.samples;
+        world.SetLagCompensation(lag);
+
+        for (int i = 0; i < options.tanks; i++) {
+            world.Apply(MakeCommand(SimCommandType::Join, FirstHostId + i, nowNs));
+            GameCommand hello = MakeCommand(SimCommandType::Hello, FirstHostId + i, nowNs);
+            hello.protocolRevision = TickSnapshotProtocolRevision;
+            world.Apply(hello);
+        }
+    }
+
+    // seconds 동안 moveRateHz로 모든 탱크 이동 - 이동 하나의 평균 적용 시간 (ns) 반환
+    double Drive(double seconds) {
+        int64_t intervalNs = 1000000000LL / options.moveRateHz;
+        int rounds = (int)(seconds * options.moveRateHz);
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; round++) {
+            nowNs += intervalNs;
+            float t = (float)(nowNs - StartNs) / 1e9f;
+            for (int i = 0; i < options.tanks; i++) {
+                GameCommand move = MakeCommand(SimCommandType::Move, FirstHostId + i, nowNs);
+                float phase = t * 0.8f + (float)i;
+                move.pose = SimPoseArgs{ 50.0f + (float)(i % 16) * 6.0f + 4.0f * std::cos(phase),
+                                         50.0f + (float)(i / 16) * 6.0f + 4.0f * std::sin(phase), phase * 57.3f };
+                world.Apply(move);
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / ((double)rounds * options.tanks);
+    }
+
+    void SetRtt(int rttMs) {
+        for (int i = 0; i < options.tanks; i++) {
+            world.UpdateClientRtt(FirstHostId + i, rttMs);
+        }
+    }
+
+    // 발사 하나씩 Apply 시간 (ns)을 모음 - 포탄 풀은 64발마다 비워 풀 크기가 결과에 섞이지 않게 함
+    void Fire(int shots, std::vector<double>& shotNs) {
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> direction(0.0f, 360.0f);
+        std::uniform_real_distribution<float> force(15.0f, 30.0f);
+        shotNs.clear();
+        for (int s = 0; s < shots; s++) {
+            int shooter = FirstHostId + (int)(random() % options.tanks);
+            GameCommand fire = MakeCommand(SimCommandType::Fire, shooter, nowNs);
+            fire.fire = SimFireArgs{ shooter, direction(random), force(random), 0.0f, 1.0f, 0.0f };
+            auto start = std::chrono::steady_clock::now();
+            world.Apply(fire);
+            auto end = std::chrono::steady_clock::now();
+            shotNs.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+            if (s % 64 == 63) {
+                world.SetProjectiles(MakeProjectileConfig());
+            }
+        }
+    }
+
+    const GameWorld& World() const { return world; }
+
+private:
+    const BenchOptions& options;
+    RecordingEventSink sink;
+    GameWorld world;
+    int64_t nowNs = StartNs;
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        int value = std::max(1, std::atoi(argv[i + 1]));
+        if (arg == "--tanks") {
+            options.tanks = value;
+        } else if (arg == "--shots") {
+            options.shots = value;
+        } else if (arg == "--samples") {
+            options.samples = value;
+        } else if (arg == "--move-rate") {
+            options.moveRateHz = value;
+        } else {
+            std::fprintf(stderr, "usage: LagCompBench [--tanks N] [--shots N] [--samples N] [--move-rate N]\n");
+            return 2;
+        }
+    }
+
+    QuietWorldLogs();
+
+    BenchRoom room(options, MaxRewindMs);
+    room.Drive(WarmupSeconds);
+    size_t bytesPerTank = room.World().PoseHistoryBytesPerTank();
+    std::printf("%d tanks moving at %d Hz, %d Hz ticks, %d shots per row, pose history %d moves per tank = %zu bytes per tank "
+                "(%.0f ms at this move rate), %.1f KB for the room\n",
+                options.tanks, options.moveRateHz, TickRateHz, options.shots, options.samples, bytesPerTank,
+                1000.0 * options.samples / options.moveRateHz,
+                room.World().LagCompensationStatsRef().historyBytes.load() / 1024.0);
+    std::printf("%8s %8s %12s %12s %12s %14s %14s %12s %10s\n", "rtt ms", "steps", "shot avg ns", "shot p50 ns", "shot p99 ns",
+                "targets/shot", "ns per target", "clamped", "hits");
+
+    const int rtts[] = { 0, 50, 100, 200, 400 };
+    double baselineNs = 0.0;
+    std::vector<double> shotNs;
+    for (int rttMs : rtts) {
+        room.SetRtt(rttMs);
+        const LagCompensationStats& stats = room.World().LagCompensationStatsRef();
+        uint64_t targetsBefore = stats.rewoundTargets.load();
+        uint64_t clampedBefore = stats.clampedTargets.load();
+        uint64_t hitsBefore = stats.rewindHits.load();
+        room.Fire(options.shots, shotNs);
+
+        double sum = 0.0;
+        for (double ns : shotNs) {
+            sum += ns;
+        }
+        std::sort(shotNs.begin(), shotNs.end());
+        double avg = sum / shotNs.size();
+        if (rttMs == 0) {
+            baselineNs = avg;
+        }
+        double targets = (double)(stats.rewoundTargets.load() - targetsBefore) / options.shots;
+        int steps = (int)((rttMs * TickRateHz + 500) / 1000);
+        std::printf("%8d %8d %12.0f %12.0f %12.0f %14.1f %14.2f %12llu %10llu\n", rttMs, steps, avg,
+                    shotNs[shotNs.size() / 2], shotNs[std::min(shotNs.size() - 1, shotNs.size() * 99 / 100)], targets,
+                    targets > 0.0 ? (avg - baselineNs) / targets : 0.0,
+                    (unsigned long long)(stats.clampedTargets.load() - clampedBefore),
+                    (unsigned long long)(stats.rewindHits.load() - hitsBefore));
+    }
+
+    // 이동 기록 비용 - 같은 방을 지연 보상 없이/있게 구동
+    BenchRoom plain(options, 0);
+    plain.Drive(WarmupSeconds);
+    double plainMoveNs = plain.Drive(WarmupSeconds);
+    double recordedMoveNs = room.Drive(WarmupSeconds);
+    std::printf("\n%-28s %10.1f ns\n%-28s %10.1f ns (+%.1f ns per SendMove)\n", "move, lag compensation off", plainMoveNs,
+                "move, lag compensation on", recordedMoveNs, recordedMoveNs - plainMoveNs);
+
+    AsyncLog::Instance().Stop();
+    return 0;
+}
@@ -0,0 +1,128 @@
+// SendMove 핸들러 처리량 비교 벤치마크 - 로그 방식별
+// 핸들러 모형: 공용 mutex 잠금 -> 레지스트리 위치 갱신 -> 로그 한 줄
+//  - sync    : 기존 DebugLog처럼 std::to_string으로 문자열을 만들고 잠금 안에서 출력 + flush (std::endl)
+//  - async   : AsyncLog로 타입 있는 인자만 링에 기록, 포맷/출력은 writer 스레드
+//  - filtered: AsyncLog 카테고리 레벨이 꺼진 상태 (매크로가 인자 평가 전에 건너뜀)
+//  - none    : 로그 없음
+// 출력은 모두 /dev/null(NUL)로 보냅니다.
+// LoggingBenchInfo 타깃은 TANK_LOG_LEVEL=info로 빌드되어 async/filtered의 debug 로그 문장이 컴파일에서 제거됩니다.
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/AsyncLog.h"
+#include "../src/TankRegistry.h"
+
+namespace {
+
+enum class LogMode { Sync, Async, Filtered, None };
+
+const char* ModeName(LogMode mode) {
+    switch (mode) {
+    case LogMode::Sync: return "sync";
+    case LogMode::Async: return "async";
+    case LogMode::Filtered: return "filtered";
+    default: return "none";
+    }
+}
+
+FILE* OpenNullOutput() {
+#ifdef _WIN32
+    return std::fopen("NUL", "w");
+#else
+    return std::fopen("/dev/null", "w");
+#endif
+}
+
+const int TankCount = 64;
+const int CallsPerThread = 200000;
+
+// 핸들러 호출 수/초 반환
+double RunCase(LogMode mode, int threadCount, FILE* nullOutput) {
+    TankRegistry tanks;
+    for (int i = 0; i < TankCount; i++) {
+        tanks.Insert(i + 3, TankInfo(i + 3, 0.0f, 0.0f, 0.0f, 0, 100.0f));
+    }
+
+    std::mutex mutex;
+    std::mutex consoleMutex;
+    AsyncLog::Instance().SetLevel(LogCategory::Move, mode == LogMode::Async ? LogLevel::Debug : LogLevel::Off);
+
+    auto handler = [&](int remote, float posX, float posY, float direction) {
+        std::lock_guard<std::mutex> lock(mutex);
+        TankHandle handle = tanks.Find(remote);
+        if (handle.IsValid()) {
+            TankPose& pose = tanks.Pose(handle);
+            pose.posX = posX;
+            pose.posY = posY;
+            pose.direction = direction;
+            tanks.MarkPoseDirty(handle);
+        }
+
+        if (mode == LogMode::Sync) {
+            std::string message = "SendMove from client " + std::to_string(remote) + ": pos=(" + std::to_string(posX) + "," + std::to_string(posY)
+                + "), direction=" + std::to_string(direction);
+            std::lock_guard<std::mutex> consoleLock(consoleMutex);
+            std::fputs(message.c_str(), nullOutput);
+            std::fputc('\n', nullOutput);
+            std::fflush(nullOutput);
+        }
+        else if (mode != LogMode::None) {
+            TANK_LOG_DEBUG(LogCategory::Move, "SendMove from client {}: pos=({},{}), direction={}", remote, posX, posY, direction);
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < CallsPerThread; i++) {
+                int remote = 3 + (i + t) % TankCount;
+                handler(remote, (float)i * 0.01f, (float)t, (float)(i % 360));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    AsyncLog::Instance().Flush();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return seconds > 0 ? (double)CallsPerThread * threadCount / seconds : 0.0;
+}
+
+} // namespace
+
+int main() {
+    FILE* nullOutput = OpenNullOutput();
+    if (nullOutput == nullptr) {
+        std::printf("Failed to open null output\n");
+        return 1;
+    }
+    AsyncLog::Instance().SetOutput(nullOutput);
+
+    std::printf("SendMove-like handler throughput, %d calls per thread, compiled log level: %s\n",
+                CallsPerThread, LogLevelName((LogLevel)TANK_LOG_LEVEL));
+    std::printf("%-10s %8s %16s %14s %12s\n", "mode", "threads", "calls/s", "written", "dropped");
+
+    const LogMode modes[] = { LogMode::Sync, LogMode::Async, LogMode::Filtered, LogMode::None };
+    const int threadCounts[] = { 1, 4 };
+    for (int threadCount : threadCounts) {
+        for (LogMode mode : modes) {
+            uint64_t writtenBefore = AsyncLog::Instance().WrittenCount();
+            uint64_t droppedBefore = AsyncLog::Instance().DroppedCount();
+            double callsPerSecond = RunCase(mode, threadCount, nullOutput);
+            std::printf("%-10s %8d %16.0f %14llu %12llu\n", ModeName(mode), threadCount, callsPerSecond,
+                        (unsigned long long)(AsyncLog::Instance().WrittenCount() - writtenBefore),
+                        (unsigned long long)(AsyncLog::Instance().DroppedCount() - droppedBefore));
+        }
+    }
+
+    AsyncLog::Instance().Stop();
+    std::fclose(nullOutput);
+    return 0;
+}
@@ -0,0 +1,372 @@
+// 손실/지연 시뮬레이션 - 위치 스트림을 신뢰 전송과 비신뢰 전송으로 보낼 때 다른 클라이언트가 보는 위치가 얼마나 낡는지 측정
+//
+//   LossBench [--loss P] [--latency MS] [--jitter MS] [--rto MS] [--tanks N] [--seconds S]
+//     기본은 손실 0%와 5%를 차례로 실행 (단방향 지연 40ms + 0~60ms 지터, 재전송 타이머 200ms, 32대, 60초)
+//     지터가 이동/틱 간격(50ms)보다 크면 비신뢰 패킷의 순서가 바뀌어 도착합니다
+//
+// 탱크마다 20Hz로 2초 이동하고 3초 멈추기를 반복하며, 이동은 업링크로 서버(GameWorld)에, 20Hz 틱 스냅샷은 다운링크로
+// 각 클라이언트에 도착합니다. 링크는 패킷마다 독립적으로 손실되며
+//   - 신뢰: 손실되면 재전송 타이머 뒤에 다시 보내고, 순서를 지키므로 뒤 패킷도 그때까지 기다림 (TCP/신뢰 UDP의 head-of-line blocking)
+//   - 비신뢰: 손실되면 사라지고, 지터 때문에 순서가 바뀌어 도착할 수 있음
+// 모드:
+//   reliable         SendMove + 신뢰 스냅샷 (기존 방식)
+//   unreliable       순서 번호/재전송 없이 비신뢰로만 보냄 (늦은 패킷도 적용, 멈춘 탱크의 마지막 위치가 유실되면 그대로)
+//   unreliable+seq   SendMoveSequenced + 비신뢰 스냅샷, 클라이언트는 탱크별로 더 새로운 틱만 적용, 서버는 1초마다 전체 위치 재전송,
+//                    이동을 멈춘 클라이언트는 100ms 뒤 마지막 위치를 새 순서 번호로 한 번 더 신뢰 전송 (서버가 모르는 마지막 위치 복구)
+//
+// 낡은 정도(staleness): 표본 시각에 관찰자가 보여주는 위치가 주인 클라이언트의 최신 위치가 아니면,
+// 그 위치가 더 새 위치로 바뀐 시각부터 지금까지의 시간 (최신이면 0). 10ms마다 모든 (관찰자, 탱크) 쌍을 표본으로 삼습니다.
+
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/CompactMove.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+#include "../src/RmiMetrics.h"
+
+namespace {
+
+struct LinkOptions {
+    double loss = 0.05;
+    int64_t latencyNs = 40000000;
+    int64_t jitterNs = 60000000;
+    int64_t rtoNs = 200000000;
+};
+
+enum class StreamMode {
+    Reliable,
+    Unreliable,
+    UnreliableSequenced,
+};
+
+const char* StreamModeName(StreamMode mode) {
+    switch (mode) {
+    case StreamMode::Reliable: return "reliable";
+    case StreamMode::Unreliable: return "unreliable";
+    case StreamMode::UnreliableSequenced: return "unreliable+seq";
+    }
+    return "?";
+}
+
+const int FirstHostId = 3;
+const int64_t MoveIntervalNs = 50000000;      // 20Hz 이동
+const int64_t TickIntervalNs = 50000000;      // 20Hz 틱
+const int64_t SampleIntervalNs = 10000000;    // 10ms 표본
+const int MoveSteps = 40;                      // 2초 이동
+const int PauseSteps = 60;                     // 3초 정지
+const uint32_t RefreshTicks = 20;              // 서버 전체 위치 재전송 주기 (1초)
+const int64_t IdleResendNs = 100000000;       // 멈춘 뒤 마지막 위치를 신뢰 전송하기까지 (100ms)
+
+// 이동 단계 번호를 위치에 그대로 실어 관찰자가 어느 시점의 위치를 보는지 복원 (압축 양자화에서도 정확히 왕복)
+float StepToPosX(int step) {
+    return CompactMapOriginX + (float)step / CompactPositionScale;
+}
+
+int PosXToStep(float posX) {
+    return (int)std::lround((posX - CompactMapOriginX) * CompactPositionScale);
+}
+
+// 단방향 링크 하나 (신뢰 모드는 순서 유지를 위해 마지막 도착 시각을 기억)
+class Link {
+public:
+    // 도착 시각 (손실이면 -1)
+    int64_t Send(int64_t nowNs, bool reliable, const LinkOptions& options, std::mt19937& random) {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        int64_t sendNs = nowNs;
+        if (reliable) {
+            while (unit(random) < options.loss) {
+                sendNs += options.rtoNs;
+            }
+        } else if (unit(random) < options.loss) {
+            return -1;
+        }
+        int64_t arriveNs = sendNs + options.latencyNs + (int64_t)(unit(random) * (double)options.jitterNs);
+        if (reliable) {
+            arriveNs = std::max(arriveNs, lastArriveNs);
+            lastArriveNs = arriveNs;
+        }
+        return arriveNs;
+    }
+
+private:
+    int64_t lastArriveNs = 0;
+};
+
+// 도착 예정 패킷 - 업링크 이동 또는 다운링크 스냅샷
+struct InFlight {
+    int64_t arriveNs;
+    uint64_t order;                 // 같은 시각이면 보낸 순서
+    bool uplink;
+    int hostId;                     // 업링크는 보낸 탱크, 다운링크는 받는 관찰자
+    int step;                       // 업링크 이동 단계
+    uint16_t sequence;              // 업링크 순서 번호
+    uint32_t tickId;                // 다운링크 틱
+    std::shared_ptr<std::vector<uint8_t>> snapshot;
+
+    bool operator>(const InFlight& other) const {
+        return arriveNs != other.arriveNs ? arriveNs > other.arriveNs : order > other.order;
+    }
+};
+
+typedef std::priority_queue<InFlight, std::vector<InFlight>, std::greater<InFlight>> InFlightQueue;
+
+// 월드의 스냅샷을 관찰자별 다운링크로 내보내는 싱크
+class LossySink : public RecordingEventSink {
+public:
+    LossySink(InFlightQueue& queue, std::vector<Link>& downlinks, bool reliable, const LinkOptions& options, std::mt19937& random)
+        : queue(queue), downlinks(downlinks), reliable(reliable), options(options), random(random) {}
+
+    void OnTankSnapshot(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) override {
+        RecordingEventSink::OnTankSnapshot(recipients, count, tickId, data, size);
+        auto payload = std::make_shared<std::vector<uint8_t>>(data, data + size);
+        for (int i = 0; i < count; i++) {
+            int64_t arriveNs = downlinks[recipients[i] - FirstHostId].Send(nowNs, reliable, options, random);
+            if (arriveNs < 0) {
+                lost++;
+                continue;
+            }
+            queue.push(InFlight{ arriveNs, order++, false, recipients[i], 0, 0, (uint32_t)tickId, payload });
+        }
+    }
+
+    int64_t nowNs = 0;
+    uint64_t order = 0;
+    uint64_t lost = 0;
+
+private:
+    InFlightQueue& queue;
+    std::vector<Link>& downlinks;
+    bool reliable;
+    const LinkOptions& options;
+    std::mt19937& random;
+};
+
+struct TankTrack {
+    std::vector<int64_t> stepTimes;   // 단계별 생성 시각
+    uint16_t sequence = 0;
+    int64_t lastMoveNs = 0;
+    bool idleResendPending = false;   // 마지막 위치를 아직 신뢰 전송하지 않음
+};
+
+struct ViewState {
+    int step = -1;                    // 보여주는 위치의 이동 단계 (-1이면 아직 없음)
+    uint32_t tickId = 0;              // 그 위치를 실은 스냅샷 틱
+};
+
+struct LossResult {
+    LatencyHistogramSnapshot staleness;
+    uint64_t staleOver250ms = 0;
+    uint64_t regressions = 0;         // 관찰자가 이미 보던 것보다 오래된 위치를 적용한 횟수
+    uint64_t lateSnapshotsDropped = 0;
+    uint64_t outOfOrderMoves = 0;
+    uint64_t lostPackets = 0;
+};
+
+LossResult Run(StreamMode mode, int tankCount, int seconds, const LinkOptions& options) {
+    std::mt19937 random(1234);
+    bool reliable = mode == StreamMode::Reliable;
+    bool sequenced = mode == StreamMode::UnreliableSequenced;
+
+    InFlightQueue queue;
+    std::vector<Link> uplinks(tankCount);
+    std::vector<Link> reliableUplinks(tankCount);   // 비신뢰 모드에서 멈춘 뒤 재전송용 신뢰 채널
+    std::vector<Link> downlinks(tankCount);
+    LossySink sink(queue, downlinks, reliable, options, random);
+    GameWorld world(sink);
+    world.SetRandomSeed(1234);
+    if (sequenced) {
+        world.SetPositionRefreshTicks(RefreshTicks);
+    }
+
+    std::vector<TankTrack> tracks(tankCount);
+    std::vector<std::vector<ViewState>> views(tankCount, std::vector<ViewState>(tankCount));
+    for (int i = 0; i < tankCount; i++) {
+        GameCommand join;
+        join.type = SimCommandType::Join;
+        join.remote = FirstHostId + i;
+        join.enqueueNs = 0;
+        world.Apply(join);
+
+        GameCommand hello = join;
+        hello.type = SimCommandType::Hello;
+        hello.protocolRevision = TickSnapshotProtocolRevision;
+        world.Apply(hello);
+
+        // 접속 위치는 이동 단계로 해석되지 않도록 범위 밖 (음수 단계)으로 옮겨 둠
+        GameCommand move = join;
+        move.type = SimCommandType::Move;
+        move.pose = SimPoseArgs{ StepToPosX(-1000), 0.0f, 0.0f };
+        world.Apply(move);
+    }
+
+    LatencyHistogram staleness;
+    LossResult result;
+    uint32_t tickId = 0;
+    const int64_t endNs = (int64_t)seconds * 1000000000ll;
+    const int64_t stepNs = 1000000;   // 1ms 단위로 진행
+
+    for (int64_t now = 0; now < endNs; now += stepNs) {
+        sink.nowNs = now;
+
+        // 이동 생성 - 탱크마다 시작 위상을 달리 해 업링크가 고르게 퍼지도록
+        for (int i = 0; i < tankCount; i++) {
+            int64_t phaseNs = MoveIntervalNs * i / tankCount;
+            if (now < phaseNs || (now - phaseNs) % MoveIntervalNs != 0) {
+                continue;
+            }
+            TankTrack& track = tracks[i];
+            int64_t slot = (now - phaseNs) / MoveIntervalNs;
+            if (slot % (MoveSteps + PauseSteps) >= MoveSteps) {
+                // 멈춘 뒤 마지막 위치를 한 번 신뢰 전송 - 같은 위치지만 새 순서 번호라 늦은 비신뢰 이동보다 우선
+                if (track.idleResendPending && now - track.lastMoveNs >= IdleResendNs) {
+                    track.idleResendPending = false;
+                    track.sequence++;
+                    int64_t arriveNs = reliableUplinks[i].Send(now, true, options, random);
+                    queue.push(InFlight{ arriveNs, sink.order++, true, FirstHostId + i, (int)track.stepTimes.size() - 1,
+                                         track.sequence, 0, nullptr });
+                }
+                continue;
+            }
+            int step = (int)track.stepTimes.size();
+            track.stepTimes.push_back(now);
+            track.sequence++;
+            track.lastMoveNs = now;
+            track.idleResendPending = sequenced;
+
+            int64_t arriveNs = uplinks[i].Send(now, reliable, options, random);
+            if (arriveNs < 0) {
+                sink.lost++;
+                continue;
+            }
+            queue.push(InFlight{ arriveNs, sink.order++, true, FirstHostId + i, step, track.sequence, 0, nullptr });
+        }
+
+        // 도착한 패킷 처리
+        while (!queue.empty() && queue.top().arriveNs <= now) {
+            InFlight packet = queue.top();
+            queue.pop();
+            if (packet.uplink) {
+                GameCommand command;
+                command.remote = packet.hostId;
+                command.enqueueNs = 0;
+                SimPoseArgs pose{ StepToPosX(packet.step), 0.0f, 0.0f };
+                if (sequenced) {
+                    command.type = SimCommandType::MoveSequenced;
+                    command.sequencedMove = SimSequencedMoveArgs{ pose, packet.sequence };
+                } else {
+                    command.type = SimCommandType::Move;
+                    command.pose = pose;
+                }
+                world.Apply(command);
+                continue;
+            }
+
+            std::vector<ViewState>& view = views[packet.hostId - FirstHostId];
+            size_t count = TankSnapshotEntryCount(packet.snapshot->size());
+            for (size_t e = 0; e < count; e++) {
+                TankSnapshotEntry entry = ReadTankSnapshotEntry(packet.snapshot->data() + e * TankSnapshotEntrySize);
+                ViewState& state = view[entry.clientId - FirstHostId];
+                if (sequenced && packet.tickId <= state.tickId) {
+                    result.lateSnapshotsDropped++;
+                    continue;
+                }
+                int step = PosXToStep(entry.posX);
+                if (step < 0) {
+                    continue;
+                }
+                if (step < state.step) {
+                    result.regressions++;
+                }
+                state.step = step;
+                state.tickId = packet.tickId;
+            }
+        }
+
+        if (now % TickIntervalNs == 0 && now > 0) {
+            world.BroadcastSnapshot(++tickId);
+        }
+
+        // 표본 - 관찰자가 보는 위치가 최신이 아니면 더 새 위치가 나온 시각부터 낡은 것으로 봄
+        if (now % SampleIntervalNs == 0) {
+            for (int viewer = 0; viewer < tankCount; viewer++) {
+                for (int tank = 0; tank < tankCount; tank++) {
+                    const ViewState& state = views[viewer][tank];
+                    const TankTrack& track = tracks[tank];
+                    if (viewer == tank || state.step < 0) {
+                        continue;
+                    }
+                    int64_t staleNs = 0;
+                    if ((size_t)state.step + 1 < track.stepTimes.size()) {
+                        staleNs = now - track.stepTimes[state.step + 1];
+                    }
+                    staleness.Record((uint64_t)staleNs);
+                    result.staleOver250ms += staleNs > 250000000 ? 1 : 0;
+                }
+            }
+        }
+    }
+
+    result.staleness = staleness.Snapshot();
+    result.outOfOrderMoves = world.OutOfOrderMoveCount();
+    result.lostPackets = sink.lost;
+    return result;
+}
+
+void PrintResult(StreamMode mode, double loss, const LossResult& result) {
+    const LatencyHistogramSnapshot& s = result.staleness;
+    std::printf("%-15s %5.1f%% %9.1f %9.1f %9.1f %9.1f %9.1f %8.3f%% %9llu %9llu %9llu\n", StreamModeName(mode), loss * 100.0,
+                s.ValueAtQuantile(0.50) / 1e6, s.ValueAtQuantile(0.99) / 1e6, s.ValueAtQuantile(0.999) / 1e6,
+                s.maxNs / 1e6, s.AverageNs() / 1e6, s.count > 0 ? 100.0 * result.staleOver250ms / s.count : 0.0,
+                (unsigned long long)result.regressions, (unsigned long long)result.lateSnapshotsDropped,
+                (unsigned long long)result.outOfOrderMoves);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    LinkOptions options;
+    std::vector<double> losses = { 0.0, 0.05 };
+    int tankCount = 32;
+    int seconds = 60;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        double value = std::atof(argv[i + 1]);
+        if (arg == "--loss") {
+            losses = { std::min(0.9, std::max(0.0, value)) };
+        } else if (arg == "--latency") {
+            options.latencyNs = (int64_t)(value * 1e6);
+        } else if (arg == "--jitter") {
+            options.jitterNs = (int64_t)(value * 1e6);
+        } else if (arg == "--rto") {
+            options.rtoNs = (int64_t)(value * 1e6);
+        } else if (arg == "--tanks") {
+            tankCount = std::max(2, (int)value);
+        } else if (arg == "--seconds") {
+            seconds = std::max(5, (int)value);
+        }
+    }
+
+    QuietWorldLogs();
+
+    std::printf("%d tanks, %d s, one-way latency %.0f ms + 0~%.0f ms jitter, retransmit after %.0f ms\n", tankCount, seconds,
+                options.latencyNs / 1e6, options.jitterNs / 1e6, options.rtoNs / 1e6);
+    std::printf("staleness in ms (time an observer keeps showing a superseded position)\n");
+    std::printf("%-15s %6s %9s %9s %9s %9s %9s %9s %9s %9s %9s\n", "mode", "loss", "p50", "p99", "p999", "max", "avg",
+                ">250ms", "regress", "late drop", "ooo moves");
+    for (double loss : losses) {
+        options.loss = loss;
+        for (StreamMode mode : { StreamMode::Reliable, StreamMode::Unreliable, StreamMode::UnreliableSequenced }) {
+            PrintResult(mode, loss, Run(mode, tankCount, seconds, options));
+        }
+    }
+
+    AsyncLog::Instance().Stop();
+    return 0;
+}
@@ -0,0 +1,166 @@
+// 매치메이킹 - 접속 폭주(여러 스레드가 동시에 Join) 때 대기표 제출 속도, 방 배정 처리량, 대기 시간과 빈 방 정리
+//
+//   MatchmakerBench [--clients N] [--room-size N] [--workers N] [--max-producers N]
+//     기본은 클라이언트 20000명 (실력 구간 4개 x 지역 3개), 방 정원 64, 방 워커 4개, 생산자 1, 4, 16개
+//
+// ProudNet 워커 스레드를 흉내 낸 생산자들이 RoomManager::Join으로 한꺼번에 접속시키고, 매치메이커가 배치 창
+// (0, 5, 20ms)마다 모인 대기표를 키별로 방에 채웁니다. 제출 속도는 모든 Join 호출이 돌아오기까지, 배정 처리량은
+// 마지막 클라이언트가 방에 배정되기까지의 시간 기준입니다. 대기 시간은 Join부터 방 배정까지입니다.
+// 마지막에 모두 퇴장시켜 빈 방이 시간 제한(200ms) 뒤에 모두 닫히는지 확인합니다
+
+#include <atomic>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/RecordingEventSink.h"
+#include "../src/RoomManager.h"
+
+namespace {
+
+const int FirstHostId = 3;
+const int SkillBuckets = 4;
+const int Regions = 3;
+const int EmptyRoomTimeoutMs = 200;
+
+struct BenchOptions {
+    int clients = 20000;
+    int roomSize = 64;
+    int workers = 4;
+    int maxProducers = 16;
+};
+
+struct RunResult {
+    double submitSeconds = 0.0;
+    double placeSeconds = 0.0;
+    double closeSeconds = 0.0;
+    uint64_t batches = 0;
+    uint64_t roomsOpened = 0;
+    uint64_t roomsClosed = 0;
+    LatencyHistogramSnapshot queueTime;
+    double skillP99Ms[SkillBuckets] = {};
+};
+
+// 완료 조건이 만족될 때까지 대기 (최대 timeoutMs)
+template <typename Done>
+bool WaitFor(Done&& done, int timeoutMs) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (!done()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    return true;
+}
+
+RunResult Run(const BenchOptions& options, int producers, int windowMs) {
+    RoomManagerConfig config;
+    config.workers = options.workers;
+    config.roomSize = options.roomSize;
+    config.matchWindowMs = windowMs;
+    config.emptyRoomTimeoutMs = EmptyRoomTimeoutMs;
+    RoomManager manager(config, [](int) { return std::unique_ptr<GameEventSink>(new RecordingEventSink()); },
+                        [](GameWorld& world, int roomId) { world.SetRandomSeed(1234 + roomId); });
+    manager.Start();
+    const MatchmakerStats& stats = manager.MatchStats();
+
+    // 클라이언트마다 실력 구간/지역을 미리 정함 (생산자 수와 무관하게 같은 분포)
+    std::mt19937 random(42);
+    std::vector<MatchKey> keys(options.clients);
+    for (MatchKey& key : keys) {
+        key.skillBucket = (uint16_t)(random() % SkillBuckets);
+        key.region = (uint16_t)(random() % Regions);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p]() {
+            for (int i = p; i < options.clients; i += producers) {
+                manager.Join(FirstHostId + i, keys[i]);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    auto submitted = std::chrono::steady_clock::now();
+    WaitFor([&]() { return stats.placed.load() >= (uint64_t)options.clients; }, 30000);
+    auto placed = std::chrono::steady_clock::now();
+
+    RunResult result;
+    result.submitSeconds = std::chrono::duration<double>(submitted - start).count();
+    result.placeSeconds = std::chrono::duration<double>(placed - start).count();
+    result.queueTime = stats.queueTime.Snapshot();
+    for (int s = 0; s < SkillBuckets; s++) {
+        result.skillP99Ms[s] = stats.queueTimeBySkill[s].Snapshot().ValueAtQuantile(0.99) / 1e6;
+    }
+    result.batches = stats.batches.load();
+    result.roomsOpened = stats.roomsOpened.load();
+
+    // 모두 퇴장 - 빈 방이 시간 제한 뒤에 닫히고 워커가 해제할 때까지
+    auto leaveStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < options.clients; i++) {
+        manager.Leave(FirstHostId + i);
+    }
+    WaitFor([&]() { return manager.RoomCount() == 0; }, 10000);
+    result.closeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - leaveStart).count();
+    result.roomsClosed = stats.roomsClosed.load();
+
+    manager.Stop();
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        int value = std::max(1, std::atoi(argv[i + 1]));
+        if (arg == "--clients") {
+            options.clients = value;
+        } else if (arg == "--room-size") {
+            options.roomSize = value;
+        } else if (arg == "--workers") {
+            options.workers = value;
+        } else if (arg == "--max-producers") {
+            options.maxProducers = value;
+        } else {
+            std::fprintf(stderr, "usage: MatchmakerBench [--clients N] [--room-size N] [--workers N] [--max-producers N]\n");
+            return 2;
+        }
+    }
+
+    QuietWorldLogs();
+
+    std::printf("%d clients (%d skill buckets x %d regions), room size %d, %d room workers, empty room timeout %d ms, hardware threads %u\n",
+                options.clients, SkillBuckets, Regions, options.roomSize, options.workers, EmptyRoomTimeoutMs,
+                std::thread::hardware_concurrency());
+    std::printf("%9s %9s %13s %13s %8s %8s %10s %10s %10s %16s %14s\n", "window ms", "producers", "submit/s", "placed/s",
+                "batches", "rooms", "wait p50", "wait p99", "wait max", "skill p99 max ms", "closed (ms)");
+    const int windows[] = { 0, 5, 20 };
+    for (int windowMs : windows) {
+        for (int producers = 1; producers <= options.maxProducers; producers *= 4) {
+            RunResult result = Run(options, producers, windowMs);
+            double skillP99Max = 0.0;
+            for (double p99 : result.skillP99Ms) {
+                skillP99Max = std::max(skillP99Max, p99);
+            }
+            char closed[32];
+            std::snprintf(closed, sizeof(closed), "%llu (%.0f)", (unsigned long long)result.roomsClosed, result.closeSeconds * 1000.0);
+            std::printf("%9d %9d %13.0f %13.0f %8llu %8llu %10.2f %10.2f %10.2f %16.2f %14s\n", windowMs, producers,
+                        options.clients / result.submitSeconds, options.clients / result.placeSeconds,
+                        (unsigned long long)result.batches, (unsigned long long)result.roomsOpened,
+                        result.queueTime.ValueAtQuantile(0.5) / 1e6, result.queueTime.ValueAtQuantile(0.99) / 1e6,
+                        result.queueTime.maxNs / 1e6, skillP99Max, closed);
+        }
+    }
+
+    AsyncLog::Instance().Stop();
+    return 0;
+}
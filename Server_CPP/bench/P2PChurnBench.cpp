@@ -0,0 +1,131 @@
+// P2P 그룹 churn 벤치마크 - 접속/퇴장마다 그룹을 재생성하는 방식과 증분 Join/Leave 방식 비교
+// ProudNet의 P2P 그룹은 멤버 쌍마다 P2P 연결(홀펀칭)을 맺으므로,
+// 접속 한 번에 새로 맺거나 끊어야 하는 연결 쌍 수와 그룹 정보 알림 수를 재연결 비용으로 집계합니다
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/BroadcastGroup.h"
+
+namespace {
+
+struct ChurnCost {
+    uint64_t joins = 0;
+    uint64_t leaves = 0;
+    uint64_t pairSetups = 0;     // 새로 맺는 P2P 연결 쌍 (홀펀칭 발생)
+    uint64_t pairTeardowns = 0;  // 끊기는 P2P 연결 쌍
+    uint64_t groupInfoSends = 0; // P2P_GROUP_INFO 알림 수
+};
+
+uint64_t Pairs(uint64_t members) {
+    return members < 2 ? 0 : members * (members - 1) / 2;
+}
+
+// 기존 방식: Destroy 후 전체 인원으로 Create, 전원에게 알림
+void RecreateOnChange(ChurnCost& cost, size_t before, size_t after) {
+    cost.pairTeardowns += Pairs(before);
+    if (after >= 2) {
+        cost.pairSetups += Pairs(after);
+        cost.groupInfoSends += after;
+    }
+}
+
+// 증분 방식: 새 멤버는 기존 멤버 각각과 연결, 퇴장 멤버의 연결만 끊김
+void IncrementalJoin(ChurnCost& cost, size_t before, bool& groupCreated) {
+    size_t after = before + 1;
+    if (!groupCreated) {
+        if (after >= 2) {
+            groupCreated = true;
+            cost.pairSetups += Pairs(after);
+            cost.groupInfoSends += after;
+        }
+        return;
+    }
+    cost.pairSetups += before;
+    cost.groupInfoSends += 1;
+}
+
+void IncrementalLeave(ChurnCost& cost, size_t before) {
+    cost.pairTeardowns += before - 1;
+}
+
+void RunCase(size_t population, int events) {
+    std::mt19937 rng(7);
+    BroadcastGroup<int> members;
+    members.Reserve(population * 2);
+
+    ChurnCost recreate;
+    ChurnCost incremental;
+    bool groupCreated = false;
+    int nextId = 3;
+
+    // 목표 인원까지 채운 뒤 churn (접속과 퇴장을 반씩 무작위로)
+    auto join = [&]() {
+        size_t before = members.Count();
+        members.Add(nextId++);
+        recreate.joins++;
+        incremental.joins++;
+        RecreateOnChange(recreate, before, before + 1);
+        IncrementalJoin(incremental, before, groupCreated);
+    };
+    auto leave = [&]() {
+        size_t before = members.Count();
+        const std::vector<int>& list = members.Members();
+        members.Remove(list[rng() % list.size()]);
+        recreate.leaves++;
+        incremental.leaves++;
+        RecreateOnChange(recreate, before, before - 1);
+        IncrementalLeave(incremental, before);
+    };
+
+    while (members.Count() < population) {
+        join();
+    }
+    ChurnCost recreateFill = recreate;
+    ChurnCost incrementalFill = incremental;
+
+    for (int i = 0; i < events; i++) {
+        bool doJoin = members.Count() < 2 || (members.Count() < population * 2 && (rng() & 1));
+        if (doJoin) {
+            join();
+        } else {
+            leave();
+        }
+    }
+
+    uint64_t churnJoins = recreate.joins - recreateFill.joins;
+    uint64_t churnEvents = (recreate.joins + recreate.leaves) - (recreateFill.joins + recreateFill.leaves);
+
+    auto perEvent = [&](uint64_t total, uint64_t fill) {
+        return churnEvents > 0 ? (double)(total - fill) / churnEvents : 0.0;
+    };
+
+    std::printf("%10zu %8llu %16.1f %16.1f %14.1f %14.1f %12.1f %12.1f\n",
+                population, (unsigned long long)churnJoins,
+                perEvent(recreate.pairSetups, recreateFill.pairSetups),
+                perEvent(incremental.pairSetups, incrementalFill.pairSetups),
+                perEvent(recreate.pairTeardowns, recreateFill.pairTeardowns),
+                perEvent(incremental.pairTeardowns, incrementalFill.pairTeardowns),
+                perEvent(recreate.groupInfoSends, recreateFill.groupInfoSends),
+                perEvent(incremental.groupInfoSends, incrementalFill.groupInfoSends));
+}
+
+} // namespace
+
+int main() {
+    const int events = 2000;
+    std::printf("P2P group churn: %d random join/leave events after filling to population\n", events);
+    std::printf("(per join/leave event; setups = P2P pairs that must hole-punch again)\n");
+    std::printf("%10s %8s %16s %16s %14s %14s %12s %12s\n",
+                "population", "joins", "setups/recreate", "setups/incr", "teardn/recr", "teardn/incr",
+                "info/recr", "info/incr");
+
+    const size_t populations[] = { 4, 16, 64, 256 };
+    for (size_t population : populations) {
+        RunCase(population, events);
+    }
+    return 0;
+}
@@ -0,0 +1,221 @@
+// 관찰자별 우선순위 스냅샷(LOD) 비교 - 500대가 400x400 맵을 20Hz로 돌아다니고 가끔 발사할 때
+// 방 전체 압축 스냅샷, 관심 영역 스냅샷, 우선순위 스냅샷(budget별)의 클라이언트당 초당 바이트와
+// 관찰자와의 거리 구간별 실제 갱신 빈도(Hz), 틱 처리 시간을 출력합니다.
+// 바이트는 OnTankSnapshotCompact RmiID + 인자 크기 기준이며 ProudNet 헤더/암호화는 포함하지 않습니다.
+//
+//   PriorityBench [--tanks N] [--seconds S] [--tick-rate N]
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/CompactMove.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+#include "../src/RmiMetrics.h"
+
+namespace {
+
+const int FirstHostId = 3;
+const float MapSize = 400.0f;
+const float Speed = 8.0f;   // 초당 이동 거리
+
+// 거리 구간 경계 (마지막 구간은 그 이상)
+const float BucketEdges[] = { 20.0f, 50.0f, 100.0f, 150.0f };
+const int BucketCount = 5;
+
+int BucketOf(float distance) {
+    int bucket = 0;
+    while (bucket < BucketCount - 1 && distance >= BucketEdges[bucket]) {
+        bucket++;
+    }
+    return bucket;
+}
+
+float Distance(const TankPose& a, const TankPose& b) {
+    float dx = a.posX - b.posX;
+    float dy = a.posY - b.posY;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+// 압축 스냅샷 항목을 풀어 관찰자-대상 거리 구간별 전달 수를 세는 싱크 (집계 시간은 틱 처리 시간에서 뺌)
+class LodRecordingSink : public RecordingEventSink {
+public:
+    void OnTankSnapshotCompact(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) override {
+        RecordingEventSink::OnTankSnapshotCompact(recipients, count, tickId, data, size);
+        int64_t start = RmiMetrics::NowNs();
+        for (int r = 0; r < count; r++) {
+            TankHandle observer = world->Tanks().Find(recipients[r]);
+            const TankPose& observerPose = world->Tanks().Pose(observer);
+            CompactSnapshotEntry entry;
+            for (size_t offset = 0; offset < size; ) {
+                size_t read = ReadCompactSnapshotEntry(data + offset, size - offset, entry);
+                if (read == 0) {
+                    break;
+                }
+                offset += read;
+                if (entry.slot == observer.slot) {
+                    continue;   // 자기 탱크 항목은 클라이언트가 무시
+                }
+                const TankPose& target = world->Tanks().Pose(TankHandle{ entry.slot, 0 });
+                deliveries[BucketOf(Distance(observerPose, target))]++;
+            }
+        }
+        accountingNs += RmiMetrics::NowNs() - start;
+    }
+
+    const GameWorld* world = nullptr;
+    uint64_t deliveries[BucketCount] = {};
+    int64_t accountingNs = 0;
+};
+
+struct Mode {
+    const char* name;
+    float interestRadius;
+    int budget;
+};
+
+struct Walker {
+    float posX, posY, heading;
+};
+
+void Run(const Mode& mode, int tankCount, int seconds, int tickRateHz) {
+    LodRecordingSink sink;
+    GameWorld world(sink, mode.interestRadius);
+    sink.world = &world;
+    world.SetRandomSeed(1234);
+    if (mode.budget > 0) {
+        PriorityConfig config;
+        config.budget = mode.budget;
+        config.fireBoostTicks = (uint32_t)tickRateHz;
+        world.SetPriorityScheduling(config);
+    }
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<Walker> walkers(tankCount);
+    for (int i = 0; i < tankCount; i++) {
+        walkers[i] = Walker{ MapSize * unit(random), MapSize * unit(random), 6.2831853f * unit(random) };
+
+        GameCommand join;
+        join.type = SimCommandType::Join;
+        join.remote = FirstHostId + i;
+        join.enqueueNs = 0;
+        world.Apply(join);
+
+        GameCommand hello = join;
+        hello.type = SimCommandType::Hello;
+        hello.protocolRevision = CompactMoveProtocolRevision;
+        world.Apply(hello);
+    }
+    world.BroadcastSnapshot(0);
+    sink.Reset();
+    for (uint64_t& d : sink.deliveries) {
+        d = 0;
+    }
+
+    uint64_t pairTicks[BucketCount] = {};
+    LatencyHistogram tickDuration;
+    float dt = 1.0f / tickRateHz;
+    int ticks = seconds * tickRateHz;
+    for (uint32_t tickId = 1; tickId <= (uint32_t)ticks; tickId++) {
+        for (int i = 0; i < tankCount; i++) {
+            Walker& w = walkers[i];
+            w.heading += (unit(random) - 0.5f) * 0.3f;
+            w.posX += std::cos(w.heading) * Speed * dt;
+            w.posY += std::sin(w.heading) * Speed * dt;
+            if (w.posX < 0.0f || w.posX > MapSize || w.posY < 0.0f || w.posY > MapSize) {
+                w.heading += 3.14159265f;
+                w.posX = std::min(std::max(w.posX, 0.0f), MapSize);
+                w.posY = std::min(std::max(w.posY, 0.0f), MapSize);
+            }
+
+            GameCommand move;
+            move.type = SimCommandType::Move;
+            move.remote = FirstHostId + i;
+            move.enqueueNs = 0;
+            move.pose = SimPoseArgs{ w.posX, w.posY, std::fmod(w.heading * 57.29578f + 3600.0f, 360.0f) };
+            world.Apply(move);
+
+            // 탱크마다 평균 3초에 한 번 발사
+            if (unit(random) < 1.0f / (3.0f * tickRateHz)) {
+                GameCommand fire;
+                fire.type = SimCommandType::Fire;
+                fire.remote = FirstHostId + i;
+                fire.enqueueNs = 0;
+                fire.fire = SimFireArgs{ FirstHostId + i, move.pose.direction, 25.0f, w.posX, 1.0f, w.posY };
+                world.Apply(fire);
+            }
+        }
+
+        int64_t start = RmiMetrics::NowNs();
+        int64_t accountingStart = sink.accountingNs;
+        world.BroadcastSnapshot(tickId);
+        tickDuration.Record((uint64_t)(RmiMetrics::NowNs() - start - (sink.accountingNs - accountingStart)));
+
+        // 이번 틱의 관찰자-대상 쌍을 거리 구간별로 집계 (구간별 Hz의 분모)
+        const TankRegistry& tanks = world.Tanks();
+        for (size_t a = 0; a < tanks.Size(); a++) {
+            for (size_t b = 0; b < tanks.Size(); b++) {
+                if (a != b) {
+                    pairTicks[BucketOf(Distance(tanks.PoseAt(a), tanks.PoseAt(b)))]++;
+                }
+            }
+        }
+    }
+
+    const GameEventCounters& snapshots = sink.Counters(GameEventType::TankSnapshotCompact);
+    LatencyHistogramSnapshot tick = tickDuration.Snapshot();
+    std::printf("%-16s %12.0f %10.1f", mode.name, (double)snapshots.bytes / seconds / tankCount,
+                (double)tick.AverageNs() / 1e6);
+    for (int b = 0; b < BucketCount; b++) {
+        double hz = pairTicks[b] > 0 ? (double)sink.deliveries[b] / pairTicks[b] * tickRateHz : 0.0;
+        std::printf(" %9.2f", hz);
+    }
+    std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int tankCount = 500;
+    int seconds = 20;
+    int tickRateHz = 20;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        int value = std::max(1, std::atoi(argv[i + 1]));
+        if (arg == "--tanks") {
+            tankCount = value;
+        } else if (arg == "--seconds") {
+            seconds = value;
+        } else if (arg == "--tick-rate") {
+            tickRateHz = value;
+        }
+    }
+
+    QuietWorldLogs();
+
+    std::printf("%d tanks on %.0fx%.0f, moves and snapshot ticks %d Hz, %d s, compact clients\n", tankCount, MapSize,
+                MapSize, tickRateHz, seconds);
+    std::printf("%-16s %12s %10s %9s %9s %9s %9s %9s\n", "mode", "B/client/s", "tick ms", "<20 Hz", "<50 Hz",
+                "<100 Hz", "<150 Hz", ">=150 Hz");
+    const Mode modes[] = {
+        { "broadcast", 0.0f, 0 },
+        { "interest r=60", 60.0f, 0 },
+        { "lod budget=16", 0.0f, 16 },
+        { "lod budget=32", 0.0f, 32 },
+        { "lod budget=64", 0.0f, 64 },
+        { "lod budget=96", 0.0f, 96 },
+        { "lod 32 + r=150", 150.0f, 32 },
+    };
+    for (const Mode& mode : modes) {
+        Run(mode, tankCount, seconds, tickRateHz);
+    }
+
+    AsyncLog::Instance().Stop();
+    return 0;
+}
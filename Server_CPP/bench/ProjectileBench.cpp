@@ -0,0 +1,230 @@
+// 서버 판정 포탄 - 날아가는 포탄 10000발과 탱크 1000대의 틱당 적분/충돌 시간 (스칼라 vs AVX2)
+//
+//   ProjectileBench [--tanks N] [--projectiles N] [--map M] [--ticks N]
+//     기본은 탱크 1000대가 300 x 300 맵에 흩어져 있고 포탄 10000발을 유지, 20Hz 틱 400번 측정 (앞의 60틱은 예열)
+//
+// 틱마다 땅에 닿거나 맞아서 사라진 만큼 임의의 탱크에서 임의의 방향으로 새로 쏴 포탄 수를 유지하므로
+// 포탄의 비행 시간이 고르게 섞인 상태를 잽니다. 두 경로는 같은 시드로 돌려 명중 수가 같은지도 확인합니다.
+// 마지막 줄은 같은 부하를 GameWorld(명중마다 체력/파괴 이벤트 전송 포함)로 돌린 틱 시간입니다
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/GameWorld.h"
+#include "../src/ProjectileSystem.h"
+#include "../src/RecordingEventSink.h"
+
+namespace {
+
+const int FirstHostId = 3;
+const int TickRateHz = 20;
+const int WarmupTicks = 60;
+
+struct BenchOptions {
+    int tanks = 1000;
+    int projectiles = 10000;
+    float mapSize = 300.0f;
+    int ticks = 400;
+};
+
+struct RunResult {
+    double avgMs = 0.0;
+    double p99Ms = 0.0;
+    uint64_t pairTests = 0;
+    uint64_t hits = 0;
+    double avgLive = 0.0;
+};
+
+RunResult Summarize(std::vector<double>& tickMs, uint64_t pairTests, uint64_t hits, double liveSum) {
+    RunResult result;
+    double sum = 0.0;
+    for (double ms : tickMs) {
+        sum += ms;
+    }
+    std::sort(tickMs.begin(), tickMs.end());
+    result.avgMs = sum / tickMs.size();
+    result.p99Ms = tickMs[std::min(tickMs.size() - 1, tickMs.size() * 99 / 100)];
+    result.pairTests = pairTests;
+    result.hits = hits;
+    result.avgLive = liveSum / tickMs.size();
+    return result;
+}
+
+// 포탄 풀만 - 탱크 위치는 고정
+RunResult RunSystem(const BenchOptions& options, bool avx2) {
+    ProjectileConfig config;
+    config.tickSeconds = 1.0f / TickRateHz;
+    ProjectileSystem system;
+    system.SetConfig(config);
+    system.SetUseAvx2(avx2);
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(0.0f, options.mapSize);
+    std::uniform_real_distribution<float> direction(0.0f, 360.0f);
+    std::uniform_real_distribution<float> force(config.minLaunchForce, config.maxLaunchForce);
+    std::vector<float> tankX(options.tanks), tankZ(options.tanks);
+    ProjectileTargets targets;
+    for (int i = 0; i < options.tanks; i++) {
+        tankX[i] = position(random);
+        tankZ[i] = position(random);
+        targets.Add(FirstHostId + i, tankX[i], tankZ[i]);
+    }
+    targets.Pad();
+
+    std::vector<ProjectileHit> hits;
+    std::vector<double> tickMs;
+    uint64_t testsBefore = 0, hitsBefore = 0;
+    double liveSum = 0.0;
+    for (int tick = 0; tick < WarmupTicks + options.ticks; tick++) {
+        // 사라진 만큼 다시 발사 (예열 중에는 틱마다 나눠 쏴 비행 시간을 섞음)
+        size_t goal = tick < WarmupTicks ? (size_t)options.projectiles * (tick + 1) / WarmupTicks : (size_t)options.projectiles;
+        while (system.Count() < goal) {
+            int shooter = (int)(random() % options.tanks);
+            system.Spawn(FirstHostId + shooter, tankX[shooter], tankZ[shooter], 1.0f, direction(random), force(random));
+        }
+        if (tick == WarmupTicks) {
+            testsBefore = system.Stats().pairTests.load();
+            hitsBefore = system.Stats().hits.load();
+        }
+
+        hits.clear();
+        auto start = std::chrono::steady_clock::now();
+        system.Step(targets, hits);
+        auto end = std::chrono::steady_clock::now();
+        DoNotOptimize(hits.size());
+        if (tick >= WarmupTicks) {
+            tickMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+            liveSum += (double)goal;
+        }
+    }
+    return Summarize(tickMs, system.Stats().pairTests.load() - testsBefore, system.Stats().hits.load() - hitsBefore, liveSum);
+}
+
+// 같은 부하를 GameWorld로 - 발사는 SendFire 명령, 명중은 체력/파괴 이벤트, 파괴된 탱크는 바로 다시 생성
+RunResult RunWorld(const BenchOptions& options) {
+    RecordingEventSink sink;
+    GameWorld world(sink);
+    world.SetRandomSeed(1234);
+    ProjectileConfig config;
+    config.tickSeconds = 1.0f / TickRateHz;
+    world.SetProjectiles(config);
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(0.0f, options.mapSize);
+    std::uniform_real_distribution<float> direction(0.0f, 360.0f);
+    std::uniform_real_distribution<float> force(config.minLaunchForce, config.maxLaunchForce);
+    for (int i = 0; i < options.tanks; i++) {
+        GameCommand join;
+        join.type = SimCommandType::Join;
+        join.remote = FirstHostId + i;
+        join.enqueueNs = 0;
+        world.Apply(join);
+
+        GameCommand hello = join;
+        hello.type = SimCommandType::Hello;
+        hello.protocolRevision = TickSnapshotProtocolRevision;
+        world.Apply(hello);
+
+        GameCommand spawn;
+        spawn.type = SimCommandType::Spawned;
+        spawn.remote = FirstHostId + i;
+        spawn.enqueueNs = 0;
+        spawn.spawn = SimSpawnArgs{ position(random), position(random), 0.0f, 0, 100.0f };
+        world.Apply(spawn);
+    }
+
+    const ProjectileStats& stats = world.ProjectileStatsRef();
+    std::vector<double> tickMs;
+    uint64_t testsBefore = 0, hitsBefore = 0;
+    double liveSum = 0.0;
+    for (uint32_t tick = 0; tick < (uint32_t)(WarmupTicks + options.ticks); tick++) {
+        int goal = tick < WarmupTicks ? options.projectiles * ((int)tick + 1) / WarmupTicks : options.projectiles;
+        for (int live = stats.live.load(); live < goal; live++) {
+            int shooter = FirstHostId + (int)(random() % options.tanks);
+            TankHandle handle = world.Tanks().Find(shooter);
+            const TankPose& pose = world.Tanks().Pose(handle);
+            if (world.Tanks().Status(handle).isDestroyed) {
+                GameCommand respawn;
+                respawn.type = SimCommandType::Respawn;
+                respawn.remote = 0;
+                respawn.enqueueNs = 0;
+                respawn.console = SimConsoleArgs{ shooter, 0.0f, pose.posX, pose.posY };
+                world.Apply(respawn);
+            }
+            GameCommand fire;
+            fire.type = SimCommandType::Fire;
+            fire.remote = shooter;
+            fire.enqueueNs = 0;
+            fire.fire = SimFireArgs{ shooter, direction(random), force(random), pose.posX, 1.0f, pose.posY };
+            world.Apply(fire);
+        }
+        if (tick == WarmupTicks) {
+            testsBefore = stats.pairTests.load();
+            hitsBefore = stats.hits.load();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        world.BroadcastSnapshot(tick + 1);
+        auto end = std::chrono::steady_clock::now();
+        if (tick >= WarmupTicks) {
+            tickMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+            liveSum += (double)goal;
+        }
+    }
+    return Summarize(tickMs, stats.pairTests.load() - testsBefore, stats.hits.load() - hitsBefore, liveSum);
+}
+
+void PrintResult(const char* name, const BenchOptions& options, const RunResult& result) {
+    double seconds = result.avgMs * options.ticks / 1000.0;
+    std::printf("%-22s %10.0f %12.3f %12.3f %14.1f %12.2f\n", name, result.avgLive, result.avgMs, result.p99Ms,
+                seconds > 0.0 ? result.pairTests / seconds / 1e6 : 0.0, (double)result.hits / options.ticks);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        int value = std::max(1, std::atoi(argv[i + 1]));
+        if (arg == "--tanks") {
+            options.tanks = value;
+        } else if (arg == "--projectiles") {
+            options.projectiles = value;
+        } else if (arg == "--map") {
+            options.mapSize = (float)value;
+        } else if (arg == "--ticks") {
+            options.ticks = value;
+        } else {
+            std::fprintf(stderr, "usage: ProjectileBench [--tanks N] [--projectiles N] [--map M] [--ticks N]\n");
+            return 2;
+        }
+    }
+
+    QuietWorldLogs();
+
+    bool hasAvx2 = false;
+#ifdef TANK_PROJECTILE_AVX2
+    hasAvx2 = CpuSupportsAvx2();
+#endif
+    std::printf("%d tanks on a %.0f x %.0f map, %d live projectiles, %d Hz, %d ticks, AVX2 %s\n", options.tanks,
+                options.mapSize, options.mapSize, options.projectiles, TickRateHz, options.ticks,
+                hasAvx2 ? "available" : "not available (both rows use the scalar path)");
+    std::printf("%-22s %10s %12s %12s %14s %12s\n", "path", "live", "tick avg ms", "tick p99 ms", "M pairs/s", "hits/tick");
+    RunResult scalar = RunSystem(options, false);
+    PrintResult("scalar", options, scalar);
+    RunResult avx2 = RunSystem(options, true);
+    PrintResult("avx2", options, avx2);
+    std::printf("%-22s %s (%llu vs %llu hits), speedup %.2fx\n", "", scalar.hits == avx2.hits ? "results match" : "RESULTS DIFFER",
+                (unsigned long long)scalar.hits, (unsigned long long)avx2.hits, avx2.avgMs > 0.0 ? scalar.avgMs / avx2.avgMs : 0.0);
+    RunResult world = RunWorld(options);
+    PrintResult(hasAvx2 ? "GameWorld tick (avx2)" : "GameWorld tick", options, world);
+
+    AsyncLog::Instance().Stop();
+    return 0;
+}
@@ -0,0 +1,287 @@
+// RMI 캡처 재생 도구 - 서버가 --capture로 기록한 수신 RMI/접속/퇴장을 실제 게임 로직(GameWorld)에 다시 적용합니다
+// 네트워크 대신 RecordingEventSink를 붙여, 같은 캡처를 반복 가능한 성능 회귀 테스트로 쓸 수 있습니다.
+//
+//   RmiReplay <capture> [--paced] [--tick-rate N] [--interest-radius R] [--from S] [--to S] [--host H]
+//     기본은 최대 속도로 재생하고, --paced면 캡처된 도착 간격을 그대로 지킵니다.
+//     스냅샷 틱은 두 모드 모두 캡처 시각 기준으로 tick-rate마다 실행하므로 틱 수와 송신 결과는 같습니다.
+//     --from/--to(초)는 블록 시간 인덱스로 바로 찾아가 그 구간만, --host는 HostID 인덱스의 블록만 읽어 그 클라이언트만 재생합니다.
+//   RmiReplay --info <capture>
+//     파일을 매핑해 인덱스만 읽고 여는 데 걸린 시간, 블록 수, 시간 범위, HostID별 레코드 수를 출력
+//   RmiReplay --synthesize <capture> [--tanks N] [--seconds S]
+//     실제 캡처가 없을 때 쓸 합성 매치 캡처 생성 (이동 20Hz, 발사 1Hz, 가끔 체력 갱신)
+//
+// 출력: 명령 처리량, 틱 처리 시간 분포, 이벤트 종류별 송신 호출/전달/예상 바이트
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/GameWorld.h"
+#include "../src/RecordingEventSink.h"
+#include "../src/RmiCapture.h"
+#include "../src/RmiMetrics.h"
+
+namespace {
+
+struct ReplayOptions {
+    std::string capturePath;
+    bool paced = false;
+    int tickRateHz = 20;
+    float interestRadius = 0.0f;
+    bool synthesize = false;
+    bool info = false;
+    double fromSeconds = 0.0;
+    double toSeconds = -1.0;
+    int hostId = 0;
+    int tanks = 32;
+    int seconds = 60;
+};
+
+bool ParseOptions(int argc, char* argv[], ReplayOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value = i + 1 < argc ? argv[i + 1] : "";
+        if (arg == "--paced") {
+            options.paced = true;
+        } else if (arg == "--synthesize") {
+            options.synthesize = true;
+        } else if (arg == "--info") {
+            options.info = true;
+        } else if (arg == "--from" && !value.empty()) {
+            options.fromSeconds = std::max(0.0, std::atof(value.c_str()));
+            i++;
+        } else if (arg == "--to" && !value.empty()) {
+            options.toSeconds = std::atof(value.c_str());
+            i++;
+        } else if (arg == "--host" && !value.empty()) {
+            options.hostId = std::atoi(value.c_str());
+            i++;
+        } else if (arg == "--tick-rate" && !value.empty()) {
+            options.tickRateHz = std::max(1, std::atoi(value.c_str()));
+            i++;
+        } else if (arg == "--interest-radius" && !value.empty()) {
+            options.interestRadius = (float)std::atof(value.c_str());
+            i++;
+        } else if (arg == "--tanks" && !value.empty()) {
+            options.tanks = std::max(1, std::atoi(value.c_str()));
+            i++;
+        } else if (arg == "--seconds" && !value.empty()) {
+            options.seconds = std::max(1, std::atoi(value.c_str()));
+            i++;
+        } else if (arg.compare(0, 2, "--") != 0 && options.capturePath.empty()) {
+            options.capturePath = arg;
+        } else {
+            return false;
+        }
+    }
+    return !options.capturePath.empty();
+}
+
+// 합성 캡처 - 탱크들이 차례로 접속해 원을 그리며 이동/발사하고 마지막에 퇴장
+template <typename... Args>
+void AppendRmi(RmiCaptureWriter& writer, uint16_t rmiId, int hostId, uint64_t timestampNs, Args... args) {
+    uint8_t payload[64];
+    uint32_t size = 0;
+    const uint8_t* parts[] = { (const uint8_t*)&args... };
+    const uint32_t sizes[] = { (uint32_t)sizeof(args)... };
+    for (size_t i = 0; i < sizeof...(Args); i++) {
+        std::memcpy(payload + size, parts[i], sizes[i]);
+        size += sizes[i];
+    }
+    writer.AppendAt(CaptureRecordKind::Rmi, rmiId, hostId, timestampNs, payload, size);
+}
+
+int Synthesize(const ReplayOptions& options) {
+    RmiCaptureWriter writer;
+    if (!writer.Open(options.capturePath, 1234)) {
+        std::fprintf(stderr, "cannot create %s\n", options.capturePath.c_str());
+        return 1;
+    }
+
+    const uint64_t MoveIntervalNs = 50000000;   // 20Hz
+    const int FirstHostId = 3;
+    uint64_t endNs = (uint64_t)options.seconds * 1000000000ull;
+
+    // 접속은 처음 1초 동안 고르게, 접속 직후 틱 스냅샷을 지원한다고 알림
+    for (int i = 0; i < options.tanks; i++) {
+        uint64_t joinNs = 1000000000ull * i / options.tanks;
+        writer.AppendAt(CaptureRecordKind::Join, 0, FirstHostId + i, joinNs, nullptr, 0);
+        AppendRmi(writer, CaptureRmiId::SendHello, FirstHostId + i, joinNs + 1, TickSnapshotProtocolRevision);
+    }
+
+    uint32_t step = 0;
+    for (uint64_t t = 1000000000ull; t < endNs; t += MoveIntervalNs, step++) {
+        for (int i = 0; i < options.tanks; i++) {
+            int hostId = FirstHostId + i;
+            uint64_t at = t + MoveIntervalNs * i / options.tanks;
+            float angle = (float)step * 0.02f + (float)i;
+            float posX = 50.0f + 40.0f * std::cos(angle);
+            float posY = 50.0f + 40.0f * std::sin(angle);
+            float direction = std::fmod(angle * 57.3f, 360.0f);
+            AppendRmi(writer, CaptureRmiId::SendMove, hostId, at, posX, posY, direction);
+
+            if ((step + i) % 20 == 0) {
+                AppendRmi(writer, CaptureRmiId::SendFire, hostId, at + 1000, hostId, direction, 25.0f, posX, 1.0f, posY);
+            }
+            if ((step + i) % 200 == 100) {
+                AppendRmi(writer, CaptureRmiId::SendTankHealthUpdated, hostId, at + 2000, 75.0f, 100.0f);
+            }
+        }
+    }
+
+    for (int i = 0; i < options.tanks; i++) {
+        writer.AppendAt(CaptureRecordKind::Leave, 0, FirstHostId + i, endNs + i, nullptr, 0);
+    }
+    uint64_t records = writer.RecordCount();
+    writer.Close();
+    uint64_t bytes = writer.ByteCount();
+
+    std::printf("wrote %s: %d tanks, %d s, %llu records, %llu bytes\n", options.capturePath.c_str(), options.tanks,
+                options.seconds, (unsigned long long)records, (unsigned long long)bytes);
+    return 0;
+}
+
+int Info(const ReplayOptions& options) {
+    auto start = std::chrono::steady_clock::now();
+    RmiCaptureReader reader;
+    std::string error;
+    if (!reader.Open(options.capturePath, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    double openMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    const RmiCaptureHeader& header = reader.Header();
+    std::printf("capture: %s (version %u, seed %u, started at unix ms %llu)\n", options.capturePath.c_str(),
+                header.version, header.worldSeed, (unsigned long long)header.startUnixMs);
+    std::printf("opened in %.3f ms%s\n", openMs, reader.Recovered() ? " (no footer, index rebuilt from block headers)" : "");
+    std::printf("blocks %u x %u bytes, records %llu, time %.3f .. %.3f s\n", reader.BlockCount(), header.blockSize,
+                (unsigned long long)reader.RecordCount(),
+                reader.BlockCount() > 0 ? reader.Block(0).firstTimestampNs / 1e9 : 0.0, reader.EndTimestampNs() / 1e9);
+
+    if (reader.HostCount() > 0) {
+        std::printf("%10s %12s %8s\n", "host", "records", "blocks");
+        for (uint32_t i = 0; i < reader.HostCount(); i++) {
+            CaptureHostInfo host = reader.Host(i);
+            std::printf("%10d %12u %8u\n", host.hostId, host.recordCount, host.blockCount);
+        }
+    }
+    return 0;
+}
+
+int Replay(const ReplayOptions& options) {
+    RmiCaptureReader reader;
+    std::string error;
+    if (!reader.Open(options.capturePath, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    CaptureFilter filter;
+    filter.fromNs = (uint64_t)(options.fromSeconds * 1e9);
+    if (options.toSeconds >= 0.0) {
+        filter.toNs = (uint64_t)(options.toSeconds * 1e9);
+    }
+    filter.hostId = options.hostId;
+
+    RecordingEventSink sink;
+    GameWorld world(sink, options.interestRadius);
+    world.SetRandomSeed(reader.Header().worldSeed);
+
+    const uint64_t tickIntervalNs = 1000000000ull / (uint64_t)options.tickRateHz;
+    uint64_t nextTickNs = (filter.fromNs / tickIntervalNs + 1) * tickIntervalNs;
+    uint32_t tickId = 0;
+    LatencyHistogram tickDuration;
+
+    uint64_t recordCount = 0;
+    uint64_t appliedCount = 0;
+    uint64_t skippedCount = 0;
+    uint64_t captureEndNs = 0;
+    std::string message;
+
+    auto runTick = [&]() {
+        int64_t tickStart = RmiMetrics::NowNs();
+        world.BroadcastSnapshot(++tickId);
+        tickDuration.Record((uint64_t)(RmiMetrics::NowNs() - tickStart));
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    CaptureCursor cursor = reader.Query(filter);
+    CaptureRecord record;
+    while (cursor.Next(record)) {
+        recordCount++;
+        captureEndNs = record.timestampNs;
+
+        // 캡처 시각 기준으로 지나간 틱을 먼저 실행
+        while (record.timestampNs >= nextTickNs) {
+            runTick();
+            nextTickNs += tickIntervalNs;
+        }
+
+        if (options.paced) {
+            std::this_thread::sleep_until(start + std::chrono::nanoseconds(record.timestampNs - filter.fromNs));
+        }
+
+        GameCommand command;
+        if (!DecodeCaptureRecord(record, command, message)) {
+            skippedCount++;
+            continue;
+        }
+        world.Apply(command);
+        appliedCount++;
+    }
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    LatencyHistogramSnapshot ticks = tickDuration.Snapshot();
+    double replayedSeconds = captureEndNs > filter.fromNs ? (captureEndNs - filter.fromNs) / 1e9 : 0.0;
+    std::printf("capture: %s (seed %u, %.1f s of traffic)\n", options.capturePath.c_str(),
+                reader.Header().worldSeed, replayedSeconds);
+    if (filter.fromNs > 0 || options.toSeconds >= 0.0 || filter.hostId != 0) {
+        std::printf("filter: from %.3f s, to %.3f s, host %d\n", filter.fromNs / 1e9,
+                    options.toSeconds >= 0.0 ? options.toSeconds : reader.EndTimestampNs() / 1e9, filter.hostId);
+    }
+    std::printf("mode: %s, tick rate %d Hz, interest radius %.1f\n", options.paced ? "paced" : "max speed",
+                options.tickRateHz, options.interestRadius);
+    std::printf("records %llu, applied %llu, skipped %llu, wall %.3f s, %.0f commands/s (%.1fx real time)\n",
+                (unsigned long long)recordCount, (unsigned long long)appliedCount, (unsigned long long)skippedCount,
+                seconds, seconds > 0 ? appliedCount / seconds : 0.0, seconds > 0 ? replayedSeconds / seconds : 0.0);
+    std::printf("ticks %u, duration us p50 %.2f, p99 %.2f, p999 %.2f, max %.2f, avg %.2f\n", tickId,
+                ticks.ValueAtQuantile(0.50) / 1000.0, ticks.ValueAtQuantile(0.99) / 1000.0,
+                ticks.ValueAtQuantile(0.999) / 1000.0, ticks.maxNs / 1000.0, ticks.AverageNs() / 1000.0);
+
+    std::printf("%-22s %12s %14s %14s\n", "outbound", "calls", "deliveries", "bytes");
+    for (int i = 0; i < (int)GameEventType::Count; i++) {
+        const GameEventCounters& c = sink.Counters((GameEventType)i);
+        if (c.calls == 0) {
+            continue;
+        }
+        std::printf("%-22s %12llu %14llu %14llu\n", GameEventTypeName((GameEventType)i), (unsigned long long)c.calls,
+                    (unsigned long long)c.deliveries, (unsigned long long)c.bytes);
+    }
+    GameEventCounters total = sink.Total();
+    std::printf("%-22s %12llu %14llu %14llu\n", "total", (unsigned long long)total.calls,
+                (unsigned long long)total.deliveries, (unsigned long long)total.bytes);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    ReplayOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "usage: RmiReplay <capture> [--paced] [--tick-rate N] [--interest-radius R]\n"
+                             "                  [--from S] [--to S] [--host H]\n"
+                             "       RmiReplay --info <capture>\n"
+                             "       RmiReplay --synthesize <capture> [--tanks N] [--seconds S]\n");
+        return 2;
+    }
+
+    QuietWorldLogs();
+    int result = options.synthesize ? Synthesize(options) : options.info ? Info(options) : Replay(options);
+    AsyncLog::Instance().Stop();
+    return result;
+}
@@ -0,0 +1,199 @@
+// 방 단위 샤딩 확장성 - 방 32개 x 64대를 워커 1~32개로 나눠 처리할 때 명령 적용 처리량과 방별 틱 처리 시간
+//
+//   RoomBench [--rooms N] [--room-size N] [--moves N] [--max-workers N] [--tick-rate N]
+//     기본은 방 32개 x 64대, 탱크마다 이동 2000번 (60번에 한 번은 발사), 워커 1, 2, 4, 8, 16, 32개, 20Hz
+//
+// ProudNet 워커 스레드를 흉내 낸 생산자(워커 수만큼)가 RoomManager::Dispatch로 SendMove/SendFire 명령을 보내고,
+// 방 워커는 actor 모드로 틱 사이에 자기 방들의 명령을 적용하며 20Hz로 방마다 float 스냅샷을 보냅니다.
+// 이벤트 싱크는 방마다 따로 두고, 스냅샷은 수신자별 송신 버퍼에 복사해 ProudNet 송신 큐 복사 비용을 흉내 냅니다.
+// 처리량은 모든 명령을 넣기 시작해 모든 방이 적용을 마칠 때까지의 시간 기준입니다.
+// 워커가 코어 수보다 많으면 스레드가 코어를 나눠 쓰므로 속도가 늘지 않습니다 (출력 첫 줄의 하드웨어 스레드 수 참고)
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "../src/RecordingEventSink.h"
+#include "../src/RoomManager.h"
+
+namespace {
+
+const int FirstHostId = 3;
+const int FireEvery = 60;
+
+struct BenchOptions {
+    int rooms = 32;
+    int roomSize = 64;
+    int movesPerTank = 2000;
+    int maxWorkers = 32;
+    int tickRateHz = 20;
+};
+
+// 스냅샷을 수신자별 송신 버퍼에 복사하는 싱크 (방의 워커 스레드만 호출)
+class FanoutSink : public RecordingEventSink {
+public:
+    void OnTankSnapshot(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) override {
+        RecordingEventSink::OnTankSnapshot(recipients, count, tickId, data, size);
+        if (sendBuffer.size() < size) {
+            sendBuffer.resize(size);
+        }
+        for (int r = 0; r < count; r++) {
+            std::memcpy(sendBuffer.data(), data, size);
+            DoNotOptimize(sendBuffer[size - 1]);
+        }
+    }
+
+private:
+    std::vector<uint8_t> sendBuffer;
+};
+
+struct RunResult {
+    double seconds = 0.0;
+    uint64_t commands = 0;
+    double tickAvgUs = 0.0;
+    double tickP99Us = 0.0;
+    uint64_t overruns = 0;
+};
+
+// 모든 방이 적용한 명령 수 (종류 무관)
+uint64_t AppliedCommands(RoomManager& manager, SimCommandType type) {
+    uint64_t total = 0;
+    manager.ForEachRoom([&](Room& room) {
+        total += room.Stats().commands[(size_t)type].load(std::memory_order_relaxed);
+    });
+    return total;
+}
+
+RunResult Run(const BenchOptions& options, int workers) {
+    RoomManagerConfig config;
+    config.workers = workers;
+    config.roomSize = options.roomSize;
+    config.tickRateHz = options.tickRateHz;
+    config.useActor = true;
+    RoomManager manager(config, [](int) { return std::unique_ptr<GameEventSink>(new FanoutSink()); },
+                        [](GameWorld& world, int roomId) { world.SetRandomSeed(1234 + roomId); });
+    manager.Start();
+
+    int tankCount = options.rooms * options.roomSize;
+    for (int i = 0; i < tankCount; i++) {
+        manager.Join(FirstHostId + i);
+        GameCommand hello;
+        hello.type = SimCommandType::Hello;
+        hello.remote = FirstHostId + i;
+        hello.protocolRevision = TickSnapshotProtocolRevision;
+        manager.Dispatch(hello);
+    }
+    while (AppliedCommands(manager, SimCommandType::Hello) < (uint64_t)tankCount) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // 생산자마다 맡은 탱크들을 돌아가며 이동 (탱크 하나의 명령은 생산자 하나가 보내므로 순서 유지)
+    int producers = workers;
+    std::atomic<uint64_t> fires{ 0 };
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p]() {
+            uint64_t fired = 0;
+            for (int move = 0; move < options.movesPerTank; move++) {
+                for (int i = p; i < tankCount; i += producers) {
+                    GameCommand command;
+                    command.type = SimCommandType::Move;
+                    command.remote = FirstHostId + i;
+                    float x = (float)(i % 100) + move * 0.1f;
+                    command.pose = SimPoseArgs{ x, (float)(i / 100), (float)(move % 360) };
+                    manager.Dispatch(command);
+
+                    if ((move + i) % FireEvery == 0) {
+                        GameCommand fire;
+                        fire.type = SimCommandType::Fire;
+                        fire.remote = FirstHostId + i;
+                        fire.fire = SimFireArgs{ FirstHostId + i, 0.0f, 25.0f, x, 1.0f, 0.0f };
+                        manager.Dispatch(fire);
+                        fired++;
+                    }
+                }
+            }
+            fires.fetch_add(fired, std::memory_order_relaxed);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    uint64_t moves = (uint64_t)tankCount * options.movesPerTank;
+    while (AppliedCommands(manager, SimCommandType::Move) < moves
+           || AppliedCommands(manager, SimCommandType::Fire) < fires.load()) {
+        std::this_thread::yield();
+    }
+    auto end = std::chrono::steady_clock::now();
+    manager.Stop();
+
+    RunResult result;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.commands = moves + fires.load();
+    uint64_t tickCount = 0;
+    double tickSumUs = 0.0;
+    double p99Max = 0.0;
+    manager.ForEachRoom([&](Room& room) {
+        LatencyHistogramSnapshot tick = room.Stats().tickDuration.Snapshot();
+        tickCount += tick.count;
+        tickSumUs += tick.sumNs / 1000.0;
+        p99Max = std::max(p99Max, tick.ValueAtQuantile(0.99) / 1000.0);
+    });
+    result.tickAvgUs = tickCount > 0 ? tickSumUs / tickCount : 0.0;
+    result.tickP99Us = p99Max;
+    for (size_t i = 0; i < manager.WorkerCount(); i++) {
+        result.overruns += manager.WorkerAt(i).Loop().Totals().overrunCount;
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        int value = std::max(1, std::atoi(argv[i + 1]));
+        if (arg == "--rooms") {
+            options.rooms = value;
+        } else if (arg == "--room-size") {
+            options.roomSize = value;
+        } else if (arg == "--moves") {
+            options.movesPerTank = value;
+        } else if (arg == "--max-workers") {
+            options.maxWorkers = value;
+        } else if (arg == "--tick-rate") {
+            options.tickRateHz = value;
+        } else {
+            std::fprintf(stderr, "usage: RoomBench [--rooms N] [--room-size N] [--moves N] [--max-workers N] [--tick-rate N]\n");
+            return 2;
+        }
+    }
+
+    QuietWorldLogs();
+
+    std::printf("%d rooms x %d tanks, %d moves per tank (fire every %d), snapshot ticks %d Hz, hardware threads %u\n",
+                options.rooms, options.roomSize, options.movesPerTank, FireEvery, options.tickRateHz,
+                std::thread::hardware_concurrency());
+    std::printf("%8s %10s %14s %14s %14s %10s %9s\n", "workers", "seconds", "commands/s", "tick avg us", "tick p99 us",
+                "overruns", "speedup");
+    double baseline = 0.0;
+    for (int workers = 1; workers <= options.maxWorkers; workers *= 2) {
+        RunResult result = Run(options, workers);
+        double rate = result.seconds > 0.0 ? result.commands / result.seconds : 0.0;
+        if (workers == 1) {
+            baseline = rate;
+        }
+        std::printf("%8d %10.2f %14.0f %14.1f %14.1f %10llu %8.2fx\n", workers, result.seconds, rate, result.tickAvgUs,
+                    result.tickP99Us, (unsigned long long)result.overruns, baseline > 0.0 ? rate / baseline : 0.0);
+    }
+
+    AsyncLog::Instance().Stop();
+    return 0;
+}
@@ -0,0 +1,115 @@
+// TankRegistry(slot-map) vs std::map<HostID, TankInfo> 비교 벤치마크
+// 접속/퇴장, 조회, 전체 순회를 16/256/4096 탱크 규모에서 측정합니다
+
+#include <map>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "BenchCommon.h"
+#include "../src/TankRegistry.h"
+
+namespace {
+
+// HostID는 서버에서 발급되는 연속된 값이므로 비슷하게 생성
+std::vector<int> MakeHostIds(size_t count) {
+    std::vector<int> ids(count);
+    for (size_t i = 0; i < count; i++) {
+        ids[i] = (int)(i + 3); // HostID_Server(1) 이후부터 발급
+    }
+    return ids;
+}
+
+void RunCase(size_t count) {
+    std::vector<int> ids = MakeHostIds(count);
+    std::vector<int> shuffled = ids;
+    std::mt19937 rng(12345);
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+    const int rounds = (int)std::max<size_t>(1, 200000 / count);
+
+    // 접속 + 퇴장 (전체 채우고 무작위 순서로 비우기)
+    double mapChurn = MeasureNs(rounds, [&]() {
+        std::map<int, TankInfo> tanks;
+        for (int id : ids) {
+            tanks[id] = TankInfo(id, 1.0f, 2.0f, 0.0f, 0, 100.0f);
+        }
+        for (int id : shuffled) {
+            tanks.erase(id);
+        }
+        DoNotOptimize(tanks.size());
+    }) / (double)(count * 2);
+
+    TankRegistry churnRegistry;
+    churnRegistry.Reserve(count);
+    double registryChurn = MeasureNs(rounds, [&]() {
+        for (int id : ids) {
+            churnRegistry.Insert(id, TankInfo(id, 1.0f, 2.0f, 0.0f, 0, 100.0f));
+        }
+        for (int id : shuffled) {
+            churnRegistry.Erase(id);
+        }
+        DoNotOptimize(churnRegistry.Size());
+    }) / (double)(count * 2);
+
+    PrintRow("join+leave", count, mapChurn, registryChurn);
+
+    // 조회 (SendMove 경로: 조회 후 위치 갱신)
+    std::map<int, TankInfo> mapTanks;
+    TankRegistry registry;
+    for (int id : ids) {
+        mapTanks[id] = TankInfo(id, 1.0f, 2.0f, 0.0f, 0, 100.0f);
+        registry.Insert(id, TankInfo(id, 1.0f, 2.0f, 0.0f, 0, 100.0f));
+    }
+
+    double mapLookup = MeasureNs(rounds, [&]() {
+        for (int id : shuffled) {
+            auto it = mapTanks.find(id);
+            if (it != mapTanks.end()) {
+                it->second.posX += 1.0f;
+            }
+        }
+    }) / (double)count;
+
+    double registryLookup = MeasureNs(rounds, [&]() {
+        for (int id : shuffled) {
+            TankHandle handle = registry.Find(id);
+            if (handle.IsValid()) {
+                registry.Pose(handle).posX += 1.0f;
+            }
+        }
+    }) / (double)count;
+
+    PrintRow("lookup+update", count, mapLookup, registryLookup);
+
+    // 전체 순회 (브로드캐스트 경로: 위치만 읽기)
+    double mapIterate = MeasureNs(rounds, [&]() {
+        float sum = 0.0f;
+        for (const auto& tank : mapTanks) {
+            sum += tank.second.posX + tank.second.posY;
+        }
+        DoNotOptimize(sum);
+    }) / (double)count;
+
+    double registryIterate = MeasureNs(rounds, [&]() {
+        float sum = 0.0f;
+        for (size_t i = 0; i < registry.Size(); i++) {
+            const TankPose& pose = registry.PoseAt(i);
+            sum += pose.posX + pose.posY;
+        }
+        DoNotOptimize(sum);
+    }) / (double)count;
+
+    PrintRow("iterate", count, mapIterate, registryIterate);
+}
+
+} // namespace
+
+int main() {
+    PrintHeader("std::map ns/op", "registry ns/op");
+    const size_t sizes[] = { 16, 256, 4096 };
+    for (size_t count : sizes) {
+        RunCase(count);
+    }
+    return 0;
+}
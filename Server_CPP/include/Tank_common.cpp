@@ -36,9 +36,29 @@ namespace Tank {
 		Rmi_OnSpawnBullet,
                
 		Rmi_P2PMessage,
+               
+		Rmi_OnTankSnapshot,
+               
+		Rmi_SendHello,
+               
+		Rmi_OnTanksOutOfRange,
+               
+		Rmi_OnWorldSnapshot,
+               
+		Rmi_SendMoveCompact,
+               
+		Rmi_OnRoomSlots,
+               
+		Rmi_OnTankSnapshotCompact,
+               
+		Rmi_OnTankDeltaSnapshot,
+               
+		Rmi_SendSnapshotAck,
+               
+		Rmi_SendMoveSequenced,
 	};
 
-	int g_RmiIDListCount = 14;
+	int g_RmiIDListCount = 24;
 
 }
 
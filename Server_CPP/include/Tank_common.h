@@ -32,6 +32,26 @@ namespace Tank {
     static const ::Proud::RmiID Rmi_OnSpawnBullet = (::Proud::RmiID)(2000+13);
                
     static const ::Proud::RmiID Rmi_P2PMessage = (::Proud::RmiID)(2000+14);
+               
+    static const ::Proud::RmiID Rmi_OnTankSnapshot = (::Proud::RmiID)(2000+15);
+               
+    static const ::Proud::RmiID Rmi_SendHello = (::Proud::RmiID)(2000+16);
+               
+    static const ::Proud::RmiID Rmi_OnTanksOutOfRange = (::Proud::RmiID)(2000+17);
+               
+    static const ::Proud::RmiID Rmi_OnWorldSnapshot = (::Proud::RmiID)(2000+18);
+               
+    static const ::Proud::RmiID Rmi_SendMoveCompact = (::Proud::RmiID)(2000+19);
+               
+    static const ::Proud::RmiID Rmi_OnRoomSlots = (::Proud::RmiID)(2000+20);
+               
+    static const ::Proud::RmiID Rmi_OnTankSnapshotCompact = (::Proud::RmiID)(2000+21);
+               
+    static const ::Proud::RmiID Rmi_OnTankDeltaSnapshot = (::Proud::RmiID)(2000+22);
+               
+    static const ::Proud::RmiID Rmi_SendSnapshotAck = (::Proud::RmiID)(2000+23);
+               
+    static const ::Proud::RmiID Rmi_SendMoveSequenced = (::Proud::RmiID)(2000+24);
 
 	// List that has RMI ID.
 	extern ::Proud::RmiID g_RmiIDList[];
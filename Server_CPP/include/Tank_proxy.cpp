@@ -472,6 +472,308 @@ __msg << message;
 		return RmiSend(remotes,remoteCount,rmiContext,__msg,
 			RmiName_P2PMessage, (::Proud::RmiID)Rmi_P2PMessage);
 	}
+        
+	bool Proxy::OnTankSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnTankSnapshot;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << snapshot;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_OnTankSnapshot, (::Proud::RmiID)Rmi_OnTankSnapshot);
+	}
+
+	bool Proxy::OnTankSnapshot ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const Proud::ByteArray & snapshot)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnTankSnapshot;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << snapshot;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_OnTankSnapshot, (::Proud::RmiID)Rmi_OnTankSnapshot);
+	}
+        
+	bool Proxy::SendHello ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & protocolRevision)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_SendHello;
+__msg.Write(__msgid); 
+	
+__msg << protocolRevision;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_SendHello, (::Proud::RmiID)Rmi_SendHello);
+	}
+
+	bool Proxy::SendHello ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & protocolRevision)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_SendHello;
+__msg.Write(__msgid); 
+	
+__msg << protocolRevision;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_SendHello, (::Proud::RmiID)Rmi_SendHello);
+	}
+        
+	bool Proxy::OnTanksOutOfRange ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & clientIds)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnTanksOutOfRange;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << clientIds;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_OnTanksOutOfRange, (::Proud::RmiID)Rmi_OnTanksOutOfRange);
+	}
+
+	bool Proxy::OnTanksOutOfRange ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const Proud::ByteArray & clientIds)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnTanksOutOfRange;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << clientIds;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_OnTanksOutOfRange, (::Proud::RmiID)Rmi_OnTanksOutOfRange);
+	}
+        
+	bool Proxy::OnWorldSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & world)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnWorldSnapshot;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << world;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_OnWorldSnapshot, (::Proud::RmiID)Rmi_OnWorldSnapshot);
+	}
+
+	bool Proxy::OnWorldSnapshot ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const Proud::ByteArray & world)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnWorldSnapshot;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << world;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_OnWorldSnapshot, (::Proud::RmiID)Rmi_OnWorldSnapshot);
+	}
+        
+	bool Proxy::SendMoveCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int16_t & posX, const int16_t & posY, const uint8_t & direction)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_SendMoveCompact;
+__msg.Write(__msgid); 
+	
+__msg << posX;
+__msg << posY;
+__msg << direction;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_SendMoveCompact, (::Proud::RmiID)Rmi_SendMoveCompact);
+	}
+
+	bool Proxy::SendMoveCompact ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int16_t & posX, const int16_t & posY, const uint8_t & direction)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_SendMoveCompact;
+__msg.Write(__msgid); 
+	
+__msg << posX;
+__msg << posY;
+__msg << direction;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_SendMoveCompact, (::Proud::RmiID)Rmi_SendMoveCompact);
+	}
+        
+	bool Proxy::OnRoomSlots ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::ByteArray & slots)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnRoomSlots;
+__msg.Write(__msgid); 
+	
+__msg << slots;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_OnRoomSlots, (::Proud::RmiID)Rmi_OnRoomSlots);
+	}
+
+	bool Proxy::OnRoomSlots ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const Proud::ByteArray & slots)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnRoomSlots;
+__msg.Write(__msgid); 
+	
+__msg << slots;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_OnRoomSlots, (::Proud::RmiID)Rmi_OnRoomSlots);
+	}
+        
+	bool Proxy::OnTankSnapshotCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnTankSnapshotCompact;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << snapshot;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_OnTankSnapshotCompact, (::Proud::RmiID)Rmi_OnTankSnapshotCompact);
+	}
+
+	bool Proxy::OnTankSnapshotCompact ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const Proud::ByteArray & snapshot)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnTankSnapshotCompact;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << snapshot;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_OnTankSnapshotCompact, (::Proud::RmiID)Rmi_OnTankSnapshotCompact);
+	}
+        
+	bool Proxy::OnTankDeltaSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const int & baselineTickId, const Proud::ByteArray & delta)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnTankDeltaSnapshot;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << baselineTickId;
+__msg << delta;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_OnTankDeltaSnapshot, (::Proud::RmiID)Rmi_OnTankDeltaSnapshot);
+	}
+
+	bool Proxy::OnTankDeltaSnapshot ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const int & baselineTickId, const Proud::ByteArray & delta)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_OnTankDeltaSnapshot;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+__msg << baselineTickId;
+__msg << delta;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_OnTankDeltaSnapshot, (::Proud::RmiID)Rmi_OnTankDeltaSnapshot);
+	}
+        
+	bool Proxy::SendSnapshotAck ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_SendSnapshotAck;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_SendSnapshotAck, (::Proud::RmiID)Rmi_SendSnapshotAck);
+	}
+
+	bool Proxy::SendSnapshotAck ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_SendSnapshotAck;
+__msg.Write(__msgid); 
+	
+__msg << tickId;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_SendSnapshotAck, (::Proud::RmiID)Rmi_SendSnapshotAck);
+	}
+        
+	bool Proxy::SendMoveSequenced ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const uint16_t & sequence, const int16_t & posX, const int16_t & posY, const uint8_t & direction)	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_SendMoveSequenced;
+__msg.Write(__msgid); 
+	
+__msg << sequence;
+__msg << posX;
+__msg << posY;
+__msg << direction;
+		
+		return RmiSend(&remote,1,rmiContext,__msg,
+			RmiName_SendMoveSequenced, (::Proud::RmiID)Rmi_SendMoveSequenced);
+	}
+
+	bool Proxy::SendMoveSequenced ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const uint16_t & sequence, const int16_t & posX, const int16_t & posY, const uint8_t & direction)  	{
+		::Proud::CMessage __msg;
+__msg.UseInternalBuffer();
+__msg.SetSimplePacketMode(m_core->IsSimplePacketMode());
+
+::Proud::RmiID __msgid=(::Proud::RmiID)Rmi_SendMoveSequenced;
+__msg.Write(__msgid); 
+	
+__msg << sequence;
+__msg << posX;
+__msg << posY;
+__msg << direction;
+		
+		return RmiSend(remotes,remoteCount,rmiContext,__msg,
+			RmiName_SendMoveSequenced, (::Proud::RmiID)Rmi_SendMoveSequenced);
+	}
 #ifdef USE_RMI_NAME_STRING
 const PNTCHAR* Proxy::RmiName_SendMove =_PNT("SendMove");
 #else
@@ -542,6 +844,56 @@ const PNTCHAR* Proxy::RmiName_P2PMessage =_PNT("P2PMessage");
 #else
 const PNTCHAR* Proxy::RmiName_P2PMessage =_PNT("");
 #endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_OnTankSnapshot =_PNT("OnTankSnapshot");
+#else
+const PNTCHAR* Proxy::RmiName_OnTankSnapshot =_PNT("");
+#endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_SendHello =_PNT("SendHello");
+#else
+const PNTCHAR* Proxy::RmiName_SendHello =_PNT("");
+#endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_OnTanksOutOfRange =_PNT("OnTanksOutOfRange");
+#else
+const PNTCHAR* Proxy::RmiName_OnTanksOutOfRange =_PNT("");
+#endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_OnWorldSnapshot =_PNT("OnWorldSnapshot");
+#else
+const PNTCHAR* Proxy::RmiName_OnWorldSnapshot =_PNT("");
+#endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_SendMoveCompact =_PNT("SendMoveCompact");
+#else
+const PNTCHAR* Proxy::RmiName_SendMoveCompact =_PNT("");
+#endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_OnRoomSlots =_PNT("OnRoomSlots");
+#else
+const PNTCHAR* Proxy::RmiName_OnRoomSlots =_PNT("");
+#endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_OnTankSnapshotCompact =_PNT("OnTankSnapshotCompact");
+#else
+const PNTCHAR* Proxy::RmiName_OnTankSnapshotCompact =_PNT("");
+#endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_OnTankDeltaSnapshot =_PNT("OnTankDeltaSnapshot");
+#else
+const PNTCHAR* Proxy::RmiName_OnTankDeltaSnapshot =_PNT("");
+#endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_SendSnapshotAck =_PNT("SendSnapshotAck");
+#else
+const PNTCHAR* Proxy::RmiName_SendSnapshotAck =_PNT("");
+#endif
+#ifdef USE_RMI_NAME_STRING
+const PNTCHAR* Proxy::RmiName_SendMoveSequenced =_PNT("SendMoveSequenced");
+#else
+const PNTCHAR* Proxy::RmiName_SendMoveSequenced =_PNT("");
+#endif
 const PNTCHAR* Proxy::RmiName_First = RmiName_SendMove;
 
 }
@@ -45,6 +45,26 @@ namespace Tank {
 	virtual bool OnSpawnBullet ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & clientId, const int & shooterId, const float & posX, const float & posY, const float & direction, const float & launchForce, const float & fireX, const float & fireY, const float & fireZ)   PN_SEALED;  
 	virtual bool P2PMessage ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::String & message) PN_SEALED; 
 	virtual bool P2PMessage ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const Proud::String & message)   PN_SEALED;  
+	virtual bool OnTankSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot) PN_SEALED; 
+	virtual bool OnTankSnapshot ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const Proud::ByteArray & snapshot)   PN_SEALED;  
+	virtual bool SendHello ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & protocolRevision) PN_SEALED; 
+	virtual bool SendHello ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & protocolRevision)   PN_SEALED;  
+	virtual bool OnTanksOutOfRange ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & clientIds) PN_SEALED; 
+	virtual bool OnTanksOutOfRange ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const Proud::ByteArray & clientIds)   PN_SEALED;  
+	virtual bool OnWorldSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & world) PN_SEALED; 
+	virtual bool OnWorldSnapshot ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const Proud::ByteArray & world)   PN_SEALED;  
+	virtual bool SendMoveCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int16_t & posX, const int16_t & posY, const uint8_t & direction) PN_SEALED; 
+	virtual bool SendMoveCompact ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int16_t & posX, const int16_t & posY, const uint8_t & direction)   PN_SEALED;  
+	virtual bool OnRoomSlots ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::ByteArray & slots) PN_SEALED; 
+	virtual bool OnRoomSlots ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const Proud::ByteArray & slots)   PN_SEALED;  
+	virtual bool OnTankSnapshotCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot) PN_SEALED; 
+	virtual bool OnTankSnapshotCompact ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const Proud::ByteArray & snapshot)   PN_SEALED;  
+	virtual bool OnTankDeltaSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const int & baselineTickId, const Proud::ByteArray & delta) PN_SEALED; 
+	virtual bool OnTankDeltaSnapshot ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId, const int & baselineTickId, const Proud::ByteArray & delta)   PN_SEALED;  
+	virtual bool SendSnapshotAck ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId) PN_SEALED; 
+	virtual bool SendSnapshotAck ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const int & tickId)   PN_SEALED;  
+	virtual bool SendMoveSequenced ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const uint16_t & sequence, const int16_t & posX, const int16_t & posY, const uint8_t & direction) PN_SEALED; 
+	virtual bool SendMoveSequenced ( ::Proud::HostID *remotes, int remoteCount, ::Proud::RmiContext &rmiContext, const uint16_t & sequence, const int16_t & posX, const int16_t & posY, const uint8_t & direction)   PN_SEALED;  
 static const PNTCHAR* RmiName_SendMove;
 static const PNTCHAR* RmiName_SendFire;
 static const PNTCHAR* RmiName_SendTankType;
@@ -59,6 +79,16 @@ static const PNTCHAR* RmiName_OnTankDestroyed;
 static const PNTCHAR* RmiName_OnTankSpawned;
 static const PNTCHAR* RmiName_OnSpawnBullet;
 static const PNTCHAR* RmiName_P2PMessage;
+static const PNTCHAR* RmiName_OnTankSnapshot;
+static const PNTCHAR* RmiName_SendHello;
+static const PNTCHAR* RmiName_OnTanksOutOfRange;
+static const PNTCHAR* RmiName_OnWorldSnapshot;
+static const PNTCHAR* RmiName_SendMoveCompact;
+static const PNTCHAR* RmiName_OnRoomSlots;
+static const PNTCHAR* RmiName_OnTankSnapshotCompact;
+static const PNTCHAR* RmiName_OnTankDeltaSnapshot;
+static const PNTCHAR* RmiName_SendSnapshotAck;
+static const PNTCHAR* RmiName_SendMoveSequenced;
 static const PNTCHAR* RmiName_First;
 		Proxy()
 		{
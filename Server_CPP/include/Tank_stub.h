@@ -160,6 +160,106 @@ namespace Tank {
 #define DEFRMI_Tank_P2PMessage(DerivedClass) bool DerivedClass::P2PMessage ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::String & message)
 #define CALL_Tank_P2PMessage P2PMessage ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::String & message)
 #define PARAM_Tank_P2PMessage ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::String & message)
+               
+		virtual bool OnTankSnapshot ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const Proud::ByteArray & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_OnTankSnapshot bool OnTankSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot) PN_OVERRIDE
+
+#define DEFRMI_Tank_OnTankSnapshot(DerivedClass) bool DerivedClass::OnTankSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot)
+#define CALL_Tank_OnTankSnapshot OnTankSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot)
+#define PARAM_Tank_OnTankSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot)
+               
+		virtual bool SendHello ( ::Proud::HostID, ::Proud::RmiContext& , const int & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_SendHello bool SendHello ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & protocolRevision) PN_OVERRIDE
+
+#define DEFRMI_Tank_SendHello(DerivedClass) bool DerivedClass::SendHello ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & protocolRevision)
+#define CALL_Tank_SendHello SendHello ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & protocolRevision)
+#define PARAM_Tank_SendHello ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & protocolRevision)
+               
+		virtual bool OnTanksOutOfRange ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const Proud::ByteArray & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_OnTanksOutOfRange bool OnTanksOutOfRange ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & clientIds) PN_OVERRIDE
+
+#define DEFRMI_Tank_OnTanksOutOfRange(DerivedClass) bool DerivedClass::OnTanksOutOfRange ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & clientIds)
+#define CALL_Tank_OnTanksOutOfRange OnTanksOutOfRange ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & clientIds)
+#define PARAM_Tank_OnTanksOutOfRange ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & clientIds)
+               
+		virtual bool OnWorldSnapshot ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const Proud::ByteArray & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_OnWorldSnapshot bool OnWorldSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & world) PN_OVERRIDE
+
+#define DEFRMI_Tank_OnWorldSnapshot(DerivedClass) bool DerivedClass::OnWorldSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & world)
+#define CALL_Tank_OnWorldSnapshot OnWorldSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & world)
+#define PARAM_Tank_OnWorldSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & world)
+               
+		virtual bool SendMoveCompact ( ::Proud::HostID, ::Proud::RmiContext& , const int16_t & , const int16_t & , const uint8_t & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_SendMoveCompact bool SendMoveCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int16_t & posX, const int16_t & posY, const uint8_t & direction) PN_OVERRIDE
+
+#define DEFRMI_Tank_SendMoveCompact(DerivedClass) bool DerivedClass::SendMoveCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int16_t & posX, const int16_t & posY, const uint8_t & direction)
+#define CALL_Tank_SendMoveCompact SendMoveCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int16_t & posX, const int16_t & posY, const uint8_t & direction)
+#define PARAM_Tank_SendMoveCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int16_t & posX, const int16_t & posY, const uint8_t & direction)
+               
+		virtual bool OnRoomSlots ( ::Proud::HostID, ::Proud::RmiContext& , const Proud::ByteArray & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_OnRoomSlots bool OnRoomSlots ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::ByteArray & slots) PN_OVERRIDE
+
+#define DEFRMI_Tank_OnRoomSlots(DerivedClass) bool DerivedClass::OnRoomSlots ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::ByteArray & slots)
+#define CALL_Tank_OnRoomSlots OnRoomSlots ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::ByteArray & slots)
+#define PARAM_Tank_OnRoomSlots ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::ByteArray & slots)
+               
+		virtual bool OnTankSnapshotCompact ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const Proud::ByteArray & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_OnTankSnapshotCompact bool OnTankSnapshotCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot) PN_OVERRIDE
+
+#define DEFRMI_Tank_OnTankSnapshotCompact(DerivedClass) bool DerivedClass::OnTankSnapshotCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot)
+#define CALL_Tank_OnTankSnapshotCompact OnTankSnapshotCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot)
+#define PARAM_Tank_OnTankSnapshotCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot)
+               
+		virtual bool OnTankDeltaSnapshot ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const int & , const Proud::ByteArray & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_OnTankDeltaSnapshot bool OnTankDeltaSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const int & baselineTickId, const Proud::ByteArray & delta) PN_OVERRIDE
+
+#define DEFRMI_Tank_OnTankDeltaSnapshot(DerivedClass) bool DerivedClass::OnTankDeltaSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const int & baselineTickId, const Proud::ByteArray & delta)
+#define CALL_Tank_OnTankDeltaSnapshot OnTankDeltaSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const int & baselineTickId, const Proud::ByteArray & delta)
+#define PARAM_Tank_OnTankDeltaSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const int & baselineTickId, const Proud::ByteArray & delta)
+               
+		virtual bool SendSnapshotAck ( ::Proud::HostID, ::Proud::RmiContext& , const int & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_SendSnapshotAck bool SendSnapshotAck ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId) PN_OVERRIDE
+
+#define DEFRMI_Tank_SendSnapshotAck(DerivedClass) bool DerivedClass::SendSnapshotAck ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId)
+#define CALL_Tank_SendSnapshotAck SendSnapshotAck ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId)
+#define PARAM_Tank_SendSnapshotAck ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId)
+               
+		virtual bool SendMoveSequenced ( ::Proud::HostID, ::Proud::RmiContext& , const uint16_t & , const int16_t & , const int16_t & , const uint8_t & )		{ 
+			return false;
+		} 
+
+#define DECRMI_Tank_SendMoveSequenced bool SendMoveSequenced ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const uint16_t & sequence, const int16_t & posX, const int16_t & posY, const uint8_t & direction) PN_OVERRIDE
+
+#define DEFRMI_Tank_SendMoveSequenced(DerivedClass) bool DerivedClass::SendMoveSequenced ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const uint16_t & sequence, const int16_t & posX, const int16_t & posY, const uint8_t & direction)
+#define CALL_Tank_SendMoveSequenced SendMoveSequenced ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const uint16_t & sequence, const int16_t & posX, const int16_t & posY, const uint8_t & direction)
+#define PARAM_Tank_SendMoveSequenced ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const uint16_t & sequence, const int16_t & posX, const int16_t & posY, const uint8_t & direction)
  
 		virtual bool ProcessReceivedMessage(::Proud::CReceivedMessage &pa, void* hostTag) PN_OVERRIDE;
 		static const PNTCHAR* RmiName_SendMove;
@@ -176,6 +276,16 @@ namespace Tank {
 		static const PNTCHAR* RmiName_OnTankSpawned;
 		static const PNTCHAR* RmiName_OnSpawnBullet;
 		static const PNTCHAR* RmiName_P2PMessage;
+		static const PNTCHAR* RmiName_OnTankSnapshot;
+		static const PNTCHAR* RmiName_SendHello;
+		static const PNTCHAR* RmiName_OnTanksOutOfRange;
+		static const PNTCHAR* RmiName_OnWorldSnapshot;
+		static const PNTCHAR* RmiName_SendMoveCompact;
+		static const PNTCHAR* RmiName_OnRoomSlots;
+		static const PNTCHAR* RmiName_OnTankSnapshotCompact;
+		static const PNTCHAR* RmiName_OnTankDeltaSnapshot;
+		static const PNTCHAR* RmiName_SendSnapshotAck;
+		static const PNTCHAR* RmiName_SendMoveSequenced;
 		static const PNTCHAR* RmiName_First;
 		virtual ::Proud::RmiID* GetRmiIDList() PN_OVERRIDE { return g_RmiIDList; }
 		virtual int GetRmiIDListCount() PN_OVERRIDE { return g_RmiIDListCount; }
@@ -312,6 +422,96 @@ namespace Tank {
 			return P2PMessage_Function(remote,rmiContext, message); 
 		}
 
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const Proud::ByteArray & ) > OnTankSnapshot_Function;
+		virtual bool OnTankSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot) 
+		{ 
+			if (OnTankSnapshot_Function==nullptr) 
+				return true; 
+			return OnTankSnapshot_Function(remote,rmiContext, tickId, snapshot); 
+		}
+
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const int & ) > SendHello_Function;
+		virtual bool SendHello ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & protocolRevision) 
+		{ 
+			if (SendHello_Function==nullptr) 
+				return true; 
+			return SendHello_Function(remote,rmiContext, protocolRevision); 
+		}
+
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const Proud::ByteArray & ) > OnTanksOutOfRange_Function;
+		virtual bool OnTanksOutOfRange ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & clientIds) 
+		{ 
+			if (OnTanksOutOfRange_Function==nullptr) 
+				return true; 
+			return OnTanksOutOfRange_Function(remote,rmiContext, tickId, clientIds); 
+		}
+
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const Proud::ByteArray & ) > OnWorldSnapshot_Function;
+		virtual bool OnWorldSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & world) 
+		{ 
+			if (OnWorldSnapshot_Function==nullptr) 
+				return true; 
+			return OnWorldSnapshot_Function(remote,rmiContext, tickId, world); 
+		}
+
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const int16_t & , const int16_t & , const uint8_t & ) > SendMoveCompact_Function;
+		virtual bool SendMoveCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int16_t & posX, const int16_t & posY, const uint8_t & direction) 
+		{ 
+			if (SendMoveCompact_Function==nullptr) 
+				return true; 
+			return SendMoveCompact_Function(remote,rmiContext, posX, posY, direction); 
+		}
+
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const Proud::ByteArray & ) > OnRoomSlots_Function;
+		virtual bool OnRoomSlots ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const Proud::ByteArray & slots) 
+		{ 
+			if (OnRoomSlots_Function==nullptr) 
+				return true; 
+			return OnRoomSlots_Function(remote,rmiContext, slots); 
+		}
+
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const Proud::ByteArray & ) > OnTankSnapshotCompact_Function;
+		virtual bool OnTankSnapshotCompact ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const Proud::ByteArray & snapshot) 
+		{ 
+			if (OnTankSnapshotCompact_Function==nullptr) 
+				return true; 
+			return OnTankSnapshotCompact_Function(remote,rmiContext, tickId, snapshot); 
+		}
+
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const int & , const int & , const Proud::ByteArray & ) > OnTankDeltaSnapshot_Function;
+		virtual bool OnTankDeltaSnapshot ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId, const int & baselineTickId, const Proud::ByteArray & delta) 
+		{ 
+			if (OnTankDeltaSnapshot_Function==nullptr) 
+				return true; 
+			return OnTankDeltaSnapshot_Function(remote,rmiContext, tickId, baselineTickId, delta); 
+		}
+
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const int & ) > SendSnapshotAck_Function;
+		virtual bool SendSnapshotAck ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const int & tickId) 
+		{ 
+			if (SendSnapshotAck_Function==nullptr) 
+				return true; 
+			return SendSnapshotAck_Function(remote,rmiContext, tickId); 
+		}
+
+               
+		std::function< bool ( ::Proud::HostID, ::Proud::RmiContext& , const uint16_t & , const int16_t & , const int16_t & , const uint8_t & ) > SendMoveSequenced_Function;
+		virtual bool SendMoveSequenced ( ::Proud::HostID remote, ::Proud::RmiContext& rmiContext , const uint16_t & sequence, const int16_t & posX, const int16_t & posY, const uint8_t & direction) 
+		{ 
+			if (SendMoveSequenced_Function==nullptr) 
+				return true; 
+			return SendMoveSequenced_Function(remote,rmiContext, sequence, posX, posY, direction); 
+		}
+
 	};
 #endif
 
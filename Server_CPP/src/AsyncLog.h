@@ -0,0 +1,472 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// AsyncLog - 게임 스레드에서 콘솔 I/O를 분리하기 위한 비동기 로그
+//  - 스레드마다 lock-free SPSC 링 버퍼를 하나씩 가짐 (첫 로그 시 등록)
+//  - 로그 호출은 포맷 문자열 포인터와 타입이 있는 인자만 링에 복사 (문자열 변환은 writer 스레드에서)
+//  - 링이 가득 차면 기다리지 않고 버리며 버린 개수를 센다
+//  - 카테고리별 최소 레벨로 필터링 - 걸러진 로그는 인자 평가도 하지 않음 (TANK_LOG 매크로)
+// 포맷 문자열은 "{}" 자리에 인자를 순서대로 넣으며, 정적 수명의 문자열 리터럴이어야 합니다.
+// 출력 순서는 같은 스레드 안에서만 보장됩니다.
+
+enum class LogLevel : uint8_t {
+    Trace = 0,
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Off
+};
+
+enum class LogCategory : uint8_t {
+    General = 0, // 서버 시작/종료, 콘솔 명령
+    Net,         // 접속/퇴장
+    Move,        // 이동
+    Fire,        // 발사
+    Combat,      // 체력/파괴/리스폰/타입
+    P2P,         // P2P 그룹과 릴레이
+    Tick,        // 틱 루프
+    Count
+};
+
+inline const char* LogLevelName(LogLevel level) {
+    static const char* names[] = { "trace", "debug", "info", "warn", "error", "off" };
+    return names[(int)level];
+}
+
+inline const char* LogCategoryName(LogCategory category) {
+    static const char* names[] = { "general", "net", "move", "fire", "combat", "p2p", "tick" };
+    return names[(int)category];
+}
+
+// 이름으로 레벨/카테고리 찾기 (콘솔 명령용), 실패 시 false
+inline bool ParseLogLevel(const std::string& name, LogLevel& out) {
+    for (int i = 0; i <= (int)LogLevel::Off; i++) {
+        if (name == LogLevelName((LogLevel)i)) {
+            out = (LogLevel)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool ParseLogCategory(const std::string& name, LogCategory& out) {
+    for (int i = 0; i < (int)LogCategory::Count; i++) {
+        if (name == LogCategoryName((LogCategory)i)) {
+            out = (LogCategory)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static const int LogMaxArgs = 8;
+static const size_t LogInlineStringSize = 46;
+
+// 타입이 있는 로그 인자
+// 짧은 문자열은 고정 크기 버퍼에 복사하고 (할당 없음), 긴 문자열만 힙에 복사해 writer가 해제합니다
+struct LogArg {
+    enum Type : uint8_t { Int, UInt, Double, Bool, Str, HeapStr };
+
+    Type type;
+    uint8_t length;
+    union {
+        int64_t i;
+        uint64_t u;
+        double d;
+        char s[LogInlineStringSize];
+        struct {
+            char* data;
+            size_t length;
+        } heap;
+    };
+};
+
+struct LogRecord {
+    const char* format;
+    int64_t timestampNs;
+    LogLevel level;
+    LogCategory category;
+    uint8_t argCount;
+    LogArg args[LogMaxArgs];
+};
+
+// 생산자 스레드 하나, 소비자(writer) 하나인 링 버퍼
+class LogRing {
+public:
+    explicit LogRing(size_t capacityPow2) : records(new LogRecord[capacityPow2]), mask(capacityPow2 - 1) {}
+
+    // 기록할 자리 확보 - 가득 차면 nullptr
+    LogRecord* TryBegin() {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) > mask) {
+            return nullptr;
+        }
+        return &records[h & mask];
+    }
+
+    void Commit() {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // writer 스레드에서 쌓인 레코드를 모두 처리
+    template <typename Func>
+    size_t Drain(Func&& func) {
+        uint64_t t = tail.load(std::memory_order_relaxed);
+        uint64_t h = head.load(std::memory_order_acquire);
+        size_t count = 0;
+        for (; t != h; t++, count++) {
+            func(records[t & mask]);
+            tail.store(t + 1, std::memory_order_release);
+        }
+        return count;
+    }
+
+    bool IsEmpty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::unique_ptr<LogRecord[]> records;
+    uint64_t mask;
+    alignas(64) std::atomic<uint64_t> head{ 0 };
+    alignas(64) std::atomic<uint64_t> tail{ 0 };
+};
+
+class AsyncLog {
+public:
+    static AsyncLog& Instance() {
+        static AsyncLog instance;
+        return instance;
+    }
+
+    ~AsyncLog() { Stop(); }
+
+    bool IsEnabled(LogCategory category, LogLevel level) const {
+        return (uint8_t)level >= minLevels[(int)category].load(std::memory_order_relaxed);
+    }
+
+    void SetLevel(LogCategory category, LogLevel level) {
+        minLevels[(int)category].store((uint8_t)level, std::memory_order_relaxed);
+    }
+
+    void SetAllLevels(LogLevel level) {
+        for (int i = 0; i < (int)LogCategory::Count; i++) {
+            SetLevel((LogCategory)i, level);
+        }
+    }
+
+    LogLevel GetLevel(LogCategory category) const {
+        return (LogLevel)minLevels[(int)category].load(std::memory_order_relaxed);
+    }
+
+    // 출력 대상 변경 (기본 stdout) - 벤치마크에서 /dev/null 등으로 바꿀 때 사용
+    void SetOutput(FILE* file) {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        output = file;
+    }
+
+    template <typename... Args>
+    void Write(LogLevel level, LogCategory category, const char* format, const Args&... args) {
+        static_assert(sizeof...(Args) <= LogMaxArgs, "too many log arguments");
+
+        LogRing& ring = ThreadRing();
+        LogRecord* record = ring.TryBegin();
+        if (record == nullptr) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        record->format = format;
+        record->timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        record->level = level;
+        record->category = category;
+        record->argCount = 0;
+        StoreArgs(*record, args...);
+        ring.Commit();
+    }
+
+    // 현재까지 쌓인 로그를 모두 출력할 때까지 대기
+    void Flush() {
+        while (true) {
+            bool empty = true;
+            {
+                std::lock_guard<std::mutex> lock(ringsMutex);
+                for (const auto& ring : rings) {
+                    if (!ring->IsEmpty()) {
+                        empty = false;
+                        break;
+                    }
+                }
+            }
+            if (empty) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        std::lock_guard<std::mutex> lock(writeMutex);
+        fflush(output);
+    }
+
+    void Stop() {
+        if (!running.exchange(false)) {
+            return;
+        }
+        if (writer.joinable()) {
+            writer.join();
+        }
+        DrainAll();
+        fflush(output);
+    }
+
+    uint64_t DroppedCount() const { return droppedCount.load(std::memory_order_relaxed); }
+    uint64_t WrittenCount() const { return writtenCount.load(std::memory_order_relaxed); }
+
+private:
+    AsyncLog() {
+        for (int i = 0; i < (int)LogCategory::Count; i++) {
+            minLevels[i].store((uint8_t)LogLevel::Info, std::memory_order_relaxed);
+        }
+        running = true;
+        writer = std::thread([this]() { Run(); });
+    }
+
+    AsyncLog(const AsyncLog&) = delete;
+    AsyncLog& operator=(const AsyncLog&) = delete;
+
+    static const size_t RingCapacity = 4096;
+
+    LogRing& ThreadRing() {
+        thread_local LogRing* ring = nullptr;
+        if (ring == nullptr) {
+            // 스레드 종료 후에도 남은 로그를 출력할 수 있도록 링은 로거가 소유
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            rings.emplace_back(new LogRing(RingCapacity));
+            ring = rings.back().get();
+        }
+        return *ring;
+    }
+
+    // 인자 저장 - 정수/실수/bool/문자열만 지원
+    static void StoreArgs(LogRecord&) {}
+
+    template <typename T, typename... Rest>
+    static void StoreArgs(LogRecord& record, const T& value, const Rest&... rest) {
+        StoreArg(record, record.args[record.argCount++], value);
+        StoreArgs(record, rest...);
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type
+    StoreArg(LogRecord&, LogArg& arg, const T& value) {
+        if (std::is_signed<T>::value) {
+            arg.type = LogArg::Int;
+            arg.i = (int64_t)value;
+        } else {
+            arg.type = LogArg::UInt;
+            arg.u = (uint64_t)value;
+        }
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_enum<T>::value>::type
+    StoreArg(LogRecord&, LogArg& arg, const T& value) {
+        arg.type = LogArg::Int;
+        arg.i = (int64_t)value;
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_floating_point<T>::value>::type
+    StoreArg(LogRecord&, LogArg& arg, const T& value) {
+        arg.type = LogArg::Double;
+        arg.d = (double)value;
+    }
+
+    static void StoreArg(LogRecord&, LogArg& arg, const bool& value) {
+        arg.type = LogArg::Bool;
+        arg.u = value ? 1 : 0;
+    }
+
+    static void StoreString(LogArg& arg, const char* text, size_t length) {
+        if (length <= LogInlineStringSize) {
+            arg.type = LogArg::Str;
+            std::memcpy(arg.s, text, length);
+            arg.length = (uint8_t)length;
+        } else {
+            arg.type = LogArg::HeapStr;
+            arg.heap.data = new char[length];
+            arg.heap.length = length;
+            std::memcpy(arg.heap.data, text, length);
+        }
+    }
+
+    static void StoreArg(LogRecord&, LogArg& arg, const std::string& value) {
+        StoreString(arg, value.data(), value.size());
+    }
+
+    static void StoreArg(LogRecord&, LogArg& arg, const char* const& value) {
+        StoreString(arg, value, std::strlen(value));
+    }
+
+    // writer 스레드 - 모든 링을 돌며 포맷 후 출력
+    void Run() {
+        while (running.load(std::memory_order_relaxed)) {
+            if (DrainAll() == 0) {
+                std::lock_guard<std::mutex> lock(writeMutex);
+                fflush(output);
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+    }
+
+    size_t DrainAll() {
+        std::vector<LogRing*> snapshot;
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            for (const auto& ring : rings) {
+                snapshot.push_back(ring.get());
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(writeMutex);
+        size_t total = 0;
+        for (LogRing* ring : snapshot) {
+            total += ring->Drain([this](const LogRecord& record) {
+                FormatRecord(record);
+                fwrite(line.data(), 1, line.size(), output);
+            });
+        }
+        writtenCount.fetch_add(total, std::memory_order_relaxed);
+        return total;
+    }
+
+    void FormatRecord(const LogRecord& record) {
+        line.clear();
+        if (record.level >= LogLevel::Warn) {
+            line += record.level == LogLevel::Warn ? "[WARN] " : "[ERROR] ";
+        }
+
+        char number[64];
+        int argIndex = 0;
+        for (const char* p = record.format; *p != '\0'; p++) {
+            if (p[0] == '{' && p[1] == '}' && argIndex < record.argCount) {
+                const LogArg& arg = record.args[argIndex++];
+                switch (arg.type) {
+                case LogArg::Int:
+                    snprintf(number, sizeof(number), "%lld", (long long)arg.i);
+                    line += number;
+                    break;
+                case LogArg::UInt:
+                    snprintf(number, sizeof(number), "%llu", (unsigned long long)arg.u);
+                    line += number;
+                    break;
+                case LogArg::Double:
+                    // std::to_string과 같은 형식
+                    snprintf(number, sizeof(number), "%f", arg.d);
+                    line += number;
+                    break;
+                case LogArg::Bool:
+                    line += arg.u ? "true" : "false";
+                    break;
+                case LogArg::Str:
+                    line.append(arg.s, arg.length);
+                    break;
+                case LogArg::HeapStr:
+                    line.append(arg.heap.data, arg.heap.length);
+                    break;
+                }
+                p++;
+            } else {
+                line += *p;
+            }
+        }
+        line += '\n';
+
+        // 긴 문자열 인자의 힙 버퍼 해제
+        for (int i = 0; i < record.argCount; i++) {
+            if (record.args[i].type == LogArg::HeapStr) {
+                delete[] record.args[i].heap.data;
+            }
+        }
+    }
+
+    std::atomic<uint8_t> minLevels[(int)LogCategory::Count];
+
+    std::mutex ringsMutex;
+    std::vector<std::unique_ptr<LogRing>> rings;
+
+    std::mutex writeMutex;
+    FILE* output = stdout;
+    std::string line;
+
+    std::atomic<bool> running{ false };
+    std::thread writer;
+
+    std::atomic<uint64_t> droppedCount{ 0 };
+    std::atomic<uint64_t> writtenCount{ 0 };
+};
+
+// 컴파일 타임 최소 로그 레벨 (LogLevel 값: 0=trace ... 5=off)
+// CMake의 TANK_LOG_LEVEL 옵션으로 지정하며, 이보다 낮은 레벨의 로그 문장은 인자 계산까지 바이너리에서 제거됩니다
+#ifndef TANK_LOG_LEVEL
+#define TANK_LOG_LEVEL 0
+#endif
+
+// 레벨이 꺼져 있으면 인자를 평가하지 않는 로그 매크로
+#define TANK_LOG(level, category, ...) \
+    do { \
+        if (AsyncLog::Instance().IsEnabled(category, level)) { \
+            AsyncLog::Instance().Write(level, category, __VA_ARGS__); \
+        } \
+    } while (0)
+
+// 컴파일에서 제외된 레벨 - 인자는 평가하지 않고 문장만 남김
+#define TANK_LOG_DISABLED(category, ...) do { } while (0)
+
+#if TANK_LOG_LEVEL <= 0
+#define TANK_LOG_TRACE(category, ...) TANK_LOG(LogLevel::Trace, category, __VA_ARGS__)
+#else
+#define TANK_LOG_TRACE(category, ...) TANK_LOG_DISABLED(category, __VA_ARGS__)
+#endif
+
+#if TANK_LOG_LEVEL <= 1
+#define TANK_LOG_DEBUG(category, ...) TANK_LOG(LogLevel::Debug, category, __VA_ARGS__)
+#else
+#define TANK_LOG_DEBUG(category, ...) TANK_LOG_DISABLED(category, __VA_ARGS__)
+#endif
+
+#if TANK_LOG_LEVEL <= 2
+#define TANK_LOG_INFO(category, ...)  TANK_LOG(LogLevel::Info, category, __VA_ARGS__)
+#else
+#define TANK_LOG_INFO(category, ...)  TANK_LOG_DISABLED(category, __VA_ARGS__)
+#endif
+
+#if TANK_LOG_LEVEL <= 3
+#define TANK_LOG_WARN(category, ...)  TANK_LOG(LogLevel::Warn, category, __VA_ARGS__)
+#else
+#define TANK_LOG_WARN(category, ...)  TANK_LOG_DISABLED(category, __VA_ARGS__)
+#endif
+
+#if TANK_LOG_LEVEL <= 4
+#define TANK_LOG_ERROR(category, ...) TANK_LOG(LogLevel::Error, category, __VA_ARGS__)
+#else
+#define TANK_LOG_ERROR(category, ...) TANK_LOG_DISABLED(category, __VA_ARGS__)
+#endif
+
+// 디버그 출력 함수 - general 카테고리 info 로그 (콘솔 명령 등 드문 경로용)
+// 핸들러 같은 자주 호출되는 경로는 TANK_LOG_* 매크로에 타입 있는 인자를 넘겨 문자열 생성을 writer 스레드로 미룹니다
+inline void DebugLog(const std::string& message) {
+    TANK_LOG_INFO(LogCategory::General, "{}", message);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+// BroadcastGroup - 방(room) 단위로 유지하는 멀티캐스트 수신자 배열
+//  - 수신자 배열을 접속/퇴장 때만 갱신하고 브로드캐스트마다 다시 만들지 않습니다
+//  - 보낸 사람 제외는 해당 원소를 배열 끝으로 옮기고 개수를 하나 줄여 복사 없이 처리
+//  - 생성된 Proxy의 (HostID* remotes, int remoteCount, ...) 오버로드에 그대로 넘길 수 있습니다
+// HostIdT는 ProudNet의 HostID 또는 벤치마크용 int
+template <typename HostIdT>
+class BroadcastGroup {
+public:
+    void Reserve(size_t count) {
+        members.reserve(count);
+        indexOf.reserve(count);
+    }
+
+    bool Add(HostIdT id) {
+        if (indexOf.find(id) != indexOf.end()) {
+            return false;
+        }
+        indexOf[id] = members.size();
+        members.push_back(id);
+        return true;
+    }
+
+    bool Remove(HostIdT id) {
+        auto it = indexOf.find(id);
+        if (it == indexOf.end()) {
+            return false;
+        }
+        size_t index = it->second;
+        indexOf.erase(it);
+
+        HostIdT last = members.back();
+        members.pop_back();
+        if (index < members.size()) {
+            members[index] = last;
+            indexOf[last] = index;
+        }
+        return true;
+    }
+
+    bool Contains(HostIdT id) const { return indexOf.find(id) != indexOf.end(); }
+    size_t Count() const { return members.size(); }
+    bool Empty() const { return members.empty(); }
+
+    void Clear() {
+        members.clear();
+        indexOf.clear();
+    }
+
+    // 전체 수신자
+    HostIdT* All(int& count) {
+        count = static_cast<int>(members.size());
+        return members.data();
+    }
+
+    // exclude를 제외한 수신자 - exclude를 배열 끝으로 옮긴 뒤 그 앞까지만 반환
+    // (반환된 포인터는 다음 Add/Remove/AllExcept 호출 전까지만 유효)
+    HostIdT* AllExcept(HostIdT exclude, int& count) {
+        auto it = indexOf.find(exclude);
+        if (it == indexOf.end()) {
+            return All(count);
+        }
+
+        size_t index = it->second;
+        size_t last = members.size() - 1;
+        if (index != last) {
+            HostIdT moved = members[last];
+            members[last] = exclude;
+            members[index] = moved;
+            indexOf[moved] = index;
+            it->second = last;
+        }
+        count = static_cast<int>(last);
+        return members.data();
+    }
+
+    const std::vector<HostIdT>& Members() const { return members; }
+
+private:
+    std::vector<HostIdT> members;
+    std::unordered_map<HostIdT, size_t> indexOf;
+};
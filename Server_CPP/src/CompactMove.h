@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "TankSnapshot.h"
+
+// 압축 이동 프로토콜 (SendMoveCompact / OnTankSnapshotCompact / OnRoomSlots)
+// 위치는 맵 기준점에서의 고정 소수점 int16 (1/64 단위, 기준점 +-512 범위), 방향은 1바이트 (360/256도 단위),
+// 탱크는 HostID 대신 방 안의 작은 슬롯 번호를 varint로 보냅니다.
+// SendHello로 CompactMoveProtocolRevision 이상을 알린 클라이언트에게만 사용하고, 나머지는 float 스냅샷(리비전 1)이나 탱크별 이전 RMI(Hello 없음)를 그대로 받습니다.
+// 범위 밖의 위치는 클라이언트가 float SendMove로 보내고, 서버는 범위 밖 이동을 세고 경고합니다 (압축 스냅샷에서는 가장자리로 고정됨).
+
+// 압축 이동을 지원하는 최소 프로토콜 리비전 (Common/Vars의 g_ProtocolRevision과 비교)
+static const int CompactMoveProtocolRevision = 2;
+
+// 맵 기준점 (스폰 범위 0~100의 중앙) - 양자화 값 0이 이 위치
+static const float CompactMapOriginX = 50.0f;
+static const float CompactMapOriginY = 50.0f;
+
+// 1 단위당 양자화 단계 수 - 오차는 최대 1/128 단위, 범위는 기준점 +-512 단위
+static const float CompactPositionScale = 64.0f;
+
+// 방향 1바이트 한 단계의 각도
+static const float CompactDirectionStep = 360.0f / 256.0f;
+
+// 범위를 벗어난 위치는 가장자리로 고정
+inline int16_t QuantizePosition(float value, float origin) {
+    float scaled = std::round((value - origin) * CompactPositionScale);
+    if (scaled > 32767.0f) {
+        scaled = 32767.0f;
+    } else if (scaled < -32768.0f) {
+        scaled = -32768.0f;
+    }
+    return (int16_t)scaled;
+}
+
+// 양자화해도 가장자리로 고정되지 않는 위치인지
+inline bool CompactPositionInRange(float posX, float posY) {
+    float scaledX = std::round((posX - CompactMapOriginX) * CompactPositionScale);
+    float scaledY = std::round((posY - CompactMapOriginY) * CompactPositionScale);
+    return scaledX >= -32768.0f && scaledX <= 32767.0f && scaledY >= -32768.0f && scaledY <= 32767.0f;
+}
+
+inline float DequantizePosition(int16_t value, float origin) {
+    return origin + (float)value / CompactPositionScale;
+}
+
+// 각도(도)를 0~255로 (음수/360도 이상도 한 바퀴 안으로 정규화)
+inline uint8_t QuantizeDirection(float degrees) {
+    float turns = degrees / 360.0f;
+    turns -= std::floor(turns);
+    return (uint8_t)((int)std::round(turns * 256.0f) & 0xFF);
+}
+
+inline float DequantizeDirection(uint8_t value) {
+    return (float)value * CompactDirectionStep;
+}
+
+// 부호 없는 LEB128 varint - 127 이하 슬롯은 1바이트
+static const size_t MaxVarUIntSize = 5;
+
+inline size_t WriteVarUInt(uint8_t* dst, uint32_t value) {
+    size_t size = 0;
+    while (value >= 0x80) {
+        dst[size++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    dst[size++] = (uint8_t)value;
+    return size;
+}
+
+// 읽은 바이트 수를 반환 (잘렸거나 너무 길면 0)
+inline size_t ReadVarUInt(const uint8_t* src, size_t available, uint32_t& value) {
+    value = 0;
+    for (size_t i = 0; i < available && i < MaxVarUIntSize; i++) {
+        value |= (uint32_t)(src[i] & 0x7F) << (7 * i);
+        if ((src[i] & 0x80) == 0) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+// OnTankSnapshotCompact 항목: slot(varint), posX(int16), posY(int16), direction(uint8) - little-endian
+// 슬롯 127까지는 6바이트 (float 항목은 16바이트)
+static const size_t MaxCompactSnapshotEntrySize = MaxVarUIntSize + 5;
+
+struct CompactSnapshotEntry {
+    uint32_t slot;
+    int16_t posX;
+    int16_t posY;
+    uint8_t direction;
+};
+
+inline CompactSnapshotEntry MakeCompactSnapshotEntry(uint32_t slot, float posX, float posY, float direction) {
+    return CompactSnapshotEntry{ slot, QuantizePosition(posX, CompactMapOriginX), QuantizePosition(posY, CompactMapOriginY),
+                                 QuantizeDirection(direction) };
+}
+
+// dst 위치에 항목 하나를 기록하고 쓴 바이트 수 반환 (dst는 MaxCompactSnapshotEntrySize 이상 확보)
+inline size_t WriteCompactSnapshotEntry(uint8_t* dst, const CompactSnapshotEntry& entry) {
+    size_t size = WriteVarUInt(dst, entry.slot);
+    std::memcpy(dst + size, &entry.posX, 2);
+    std::memcpy(dst + size + 2, &entry.posY, 2);
+    dst[size + 4] = entry.direction;
+    return size + 5;
+}
+
+// src에서 항목 하나를 읽고 읽은 바이트 수 반환 (잘렸으면 0)
+inline size_t ReadCompactSnapshotEntry(const uint8_t* src, size_t available, CompactSnapshotEntry& entry) {
+    size_t size = ReadVarUInt(src, available, entry.slot);
+    if (size == 0 || available - size < 5) {
+        return 0;
+    }
+    std::memcpy(&entry.posX, src + size, 2);
+    std::memcpy(&entry.posY, src + size + 2, 2);
+    entry.direction = src[size + 4];
+    return size + 5;
+}
+
+// OnRoomSlots 항목: slot(varint), clientId(int32) - 슬롯은 퇴장 후 재사용되므로 클라이언트는 마지막 값으로 덮어씀
+static const size_t MaxRoomSlotEntrySize = MaxVarUIntSize + 4;
+
+inline size_t WriteRoomSlotEntry(uint8_t* dst, uint32_t slot, int32_t clientId) {
+    size_t size = WriteVarUInt(dst, slot);
+    std::memcpy(dst + size, &clientId, 4);
+    return size + 4;
+}
+
+inline size_t ReadRoomSlotEntry(const uint8_t* src, size_t available, uint32_t& slot, int32_t& clientId) {
+    size_t size = ReadVarUInt(src, available, slot);
+    if (size == 0 || available - size < 4) {
+        return 0;
+    }
+    std::memcpy(&clientId, src + size, 4);
+    return size + 4;
+}
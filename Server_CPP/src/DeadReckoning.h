@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+#include "TankRegistry.h"
+
+// 데드 레커닝 기반 위치 전송 억제 (OnTankSnapshot / OnTankSnapshotCompact)
+// 서버는 탱크마다 클라이언트가 보고 있는 선형 모델(마지막으로 보낸 위치/틱과 틱당 속도)을 유지하고,
+// 스냅샷 틱마다 모델을 이번 틱까지 외삽한 위치와 실제 위치(마지막 SendMove)를 비교해
+// 오차가 허용치를 넘거나 하트비트 간격이 지난 탱크만 스냅샷에 넣습니다.
+// 속도는 스냅샷으로 보낸 두 위치의 차이 / 틱 차이라서, 클라이언트도 받은 항목과 tickId만으로 같은 모델을 만듭니다
+// (프로토콜 변경 없음 - TankClient.cs의 RecordPositionSample/ExtrapolateOtherTanks).
+// 변경된 필드만 보내는 델타 스냅샷은 멈춘 위치를 다시 보내도 클라이언트가 알 수 없으므로 적용하지 않습니다.
+
+struct DeadReckoningConfig {
+    float positionThreshold = 0.0f;    // 외삽 위치와 실제 위치의 거리 허용치 (0이면 끔)
+    float directionThreshold = 5.0f;   // 방향 차이 허용치 (도, 방향은 외삽하지 않음)
+    uint32_t heartbeatTicks = 10;      // 오차가 허용치 안이어도 이 틱 수가 지나면 전송 (0이면 끔)
+
+    bool Enabled() const { return positionThreshold > 0.0f; }
+};
+
+// 클라이언트가 보고 있다고 가정하는 탱크 하나의 모델
+struct DeadReckoningModel {
+    TankPose pose;            // 마지막으로 보낸 위치/방향
+    float velocityX = 0.0f;   // 틱당 이동량
+    float velocityY = 0.0f;
+    uint32_t tickId = 0;      // 마지막으로 보낸 틱
+};
+
+// 모델을 tickId까지 외삽한 위치 (방향은 마지막 값 유지)
+inline TankPose ExtrapolateDeadReckoning(const DeadReckoningModel& model, uint32_t tickId) {
+    float elapsed = tickId > model.tickId ? (float)(tickId - model.tickId) : 0.0f;
+    return TankPose{ model.pose.posX + model.velocityX * elapsed, model.pose.posY + model.velocityY * elapsed,
+                     model.pose.direction };
+}
+
+// 두 방향의 차이 (0 ~ 180도)
+inline float DeadReckoningAngleError(float a, float b) {
+    float diff = std::fmod(std::fabs(a - b), 360.0f);
+    return diff > 180.0f ? 360.0f - diff : diff;
+}
+
+// 외삽 위치와 실제 위치의 거리
+inline float DeadReckoningPositionError(const DeadReckoningModel& model, const TankPose& pose, uint32_t tickId) {
+    TankPose predicted = ExtrapolateDeadReckoning(model, tickId);
+    float dx = pose.posX - predicted.posX;
+    float dy = pose.posY - predicted.posY;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+// 이번 틱에 실제 위치를 보내야 하는지
+// 하트비트는 모델이 움직이고 있거나 위치가 조금이라도 다를 때만 - 멈춰서 정확히 맞는 탱크는 보낼 것이 없음
+inline bool NeedsDeadReckoningUpdate(const DeadReckoningModel& model, const TankPose& pose, uint32_t tickId,
+                                     const DeadReckoningConfig& config) {
+    float positionError = DeadReckoningPositionError(model, pose, tickId);
+    if (positionError > config.positionThreshold
+        || DeadReckoningAngleError(model.pose.direction, pose.direction) > config.directionThreshold) {
+        return true;
+    }
+
+    bool settled = positionError == 0.0f && model.velocityX == 0.0f && model.velocityY == 0.0f;
+    return config.heartbeatTicks > 0 && tickId - model.tickId >= config.heartbeatTicks && !settled;
+}
+
+// 보낸 위치로 모델 갱신 - 속도는 직전에 보낸 위치와의 차이 / 틱 차이
+inline void UpdateDeadReckoningModel(DeadReckoningModel& model, const TankPose& pose, uint32_t tickId) {
+    if (tickId > model.tickId) {
+        float elapsed = (float)(tickId - model.tickId);
+        model.velocityX = (pose.posX - model.pose.posX) / elapsed;
+        model.velocityY = (pose.posY - model.pose.posY) / elapsed;
+    }
+    model.pose = pose;
+    model.tickId = tickId;
+}
+
+// 스냅샷에 넣은 위치 수와 모델 오차가 허용치 안이라 생략한 위치 수 (atomic - 메트릭 스레드에서 읽음)
+struct DeadReckoningStats {
+    std::atomic<uint64_t> forwarded{ 0 };
+    std::atomic<uint64_t> suppressed{ 0 };
+};
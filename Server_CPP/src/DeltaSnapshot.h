@@ -0,0 +1,267 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "CompactMove.h"
+#include "TankRegistry.h"
+
+// 기준 스냅샷 대비 델타 복제 (OnTankDeltaSnapshot / SendSnapshotAck)
+// 서버는 틱마다 방 전체 상태(양자화)를 기록해 두고, 클라이언트가 마지막으로 확인(ack)한 틱의 상태를 기준으로
+// 바뀐 필드만 보냅니다. 기준이 기록 범위(DeltaSnapshotHistorySize 틱)를 벗어나거나 아직 ack가 없으면
+// 빈 기준에 대한 델타, 즉 전체 스냅샷을 보냅니다 (baselineTickId = 0).
+//
+// delta 바이트 배열: 항목을 clientId 오름차순으로 나열
+//   clientId(varint), mask(uint8), 이어서 mask 비트 순서대로 필드
+//     0x01 posX      : zigzag varint (양자화 값 - 기준 양자화 값)
+//     0x02 posY      : zigzag varint
+//     0x04 direction : uint8 (양자화 값 - 기준 양자화 값, mod 256)
+//     0x08 tankType  : zigzag varint (새 값)
+//     0x10 currentHealth : float
+//     0x20 maxHealth     : float
+//     0x40 파괴 상태 반전 (값 없음)
+//     0x80 퇴장 (다른 비트 없음)
+// 기준에 없는 탱크는 모든 필드가 0인 상태를 기준으로 삼으며, mask가 0이어도 항목을 보내 생성되게 합니다.
+// 위치/방향은 CompactMove.h와 같은 양자화를 쓰므로 델타 클라이언트의 오차도 압축 이동과 같습니다.
+
+// 델타 스냅샷을 지원하는 최소 프로토콜 리비전
+static const int DeltaSnapshotProtocolRevision = 3;
+
+// 서버가 기억하는 틱 수 - 20Hz에서 1.6초, ack가 이보다 늦으면 전체 스냅샷으로 대체
+static const uint32_t DeltaSnapshotHistorySize = 32;
+
+enum DeltaFieldMask : uint8_t {
+    DeltaField_PosX = 0x01,
+    DeltaField_PosY = 0x02,
+    DeltaField_Direction = 0x04,
+    DeltaField_TankType = 0x08,
+    DeltaField_CurrentHealth = 0x10,
+    DeltaField_MaxHealth = 0x20,
+    DeltaField_DestroyedToggle = 0x40,
+    DeltaField_Removed = 0x80,
+};
+
+// 복제되는 탱크 상태 (TankInfo 필드의 양자화 사본)
+struct DeltaTankState {
+    int32_t clientId;
+    int16_t posX;
+    int16_t posY;
+    uint8_t direction;
+    bool isDestroyed;
+    int32_t tankType;
+    float currentHealth;
+    float maxHealth;
+};
+
+inline DeltaTankState MakeDeltaTankState(int clientId, const TankPose& pose, const TankStatus& status) {
+    return DeltaTankState{ clientId, QuantizePosition(pose.posX, CompactMapOriginX), QuantizePosition(pose.posY, CompactMapOriginY),
+                           QuantizeDirection(pose.direction), status.isDestroyed, status.tankType,
+                           status.currentHealth, status.maxHealth };
+}
+
+inline uint32_t ZigZagEncode(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+inline int32_t ZigZagDecode(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// 항목 하나의 최대 크기 (clientId + mask + 필드 전부)
+static const size_t MaxDeltaEntrySize = MaxVarUIntSize + 1 + MaxVarUIntSize * 2 + 1 + MaxVarUIntSize + 4 + 4;
+
+namespace DeltaSnapshotDetail {
+
+inline size_t WriteEntry(uint8_t* dst, const DeltaTankState& base, const DeltaTankState& state, bool isNew) {
+    uint8_t mask = 0;
+    if (state.posX != base.posX) mask |= DeltaField_PosX;
+    if (state.posY != base.posY) mask |= DeltaField_PosY;
+    if (state.direction != base.direction) mask |= DeltaField_Direction;
+    if (state.tankType != base.tankType) mask |= DeltaField_TankType;
+    if (std::memcmp(&state.currentHealth, &base.currentHealth, 4) != 0) mask |= DeltaField_CurrentHealth;
+    if (std::memcmp(&state.maxHealth, &base.maxHealth, 4) != 0) mask |= DeltaField_MaxHealth;
+    if (state.isDestroyed != base.isDestroyed) mask |= DeltaField_DestroyedToggle;
+    if (mask == 0 && !isNew) {
+        return 0;
+    }
+
+    size_t size = WriteVarUInt(dst, (uint32_t)state.clientId);
+    dst[size++] = mask;
+    if (mask & DeltaField_PosX) size += WriteVarUInt(dst + size, ZigZagEncode((int32_t)state.posX - base.posX));
+    if (mask & DeltaField_PosY) size += WriteVarUInt(dst + size, ZigZagEncode((int32_t)state.posY - base.posY));
+    if (mask & DeltaField_Direction) dst[size++] = (uint8_t)(state.direction - base.direction);
+    if (mask & DeltaField_TankType) size += WriteVarUInt(dst + size, ZigZagEncode(state.tankType));
+    if (mask & DeltaField_CurrentHealth) { std::memcpy(dst + size, &state.currentHealth, 4); size += 4; }
+    if (mask & DeltaField_MaxHealth) { std::memcpy(dst + size, &state.maxHealth, 4); size += 4; }
+    return size;
+}
+
+} // namespace DeltaSnapshotDetail
+
+// baseline -> current 델타를 out에 기록 (두 배열 모두 clientId 오름차순, baseline이 비어 있으면 전체 스냅샷)
+inline void EncodeDeltaSnapshot(const std::vector<DeltaTankState>& baseline, const std::vector<DeltaTankState>& current,
+                                std::vector<uint8_t>& out) {
+    static const DeltaTankState Empty = {};
+    out.resize((current.size() + baseline.size()) * MaxDeltaEntrySize);
+    uint8_t* dst = out.data();
+    size_t size = 0;
+
+    size_t b = 0;
+    for (const DeltaTankState& state : current) {
+        // 기준에만 있는 탱크는 퇴장
+        while (b < baseline.size() && baseline[b].clientId < state.clientId) {
+            size += WriteVarUInt(dst + size, (uint32_t)baseline[b].clientId);
+            dst[size++] = DeltaField_Removed;
+            b++;
+        }
+        if (b < baseline.size() && baseline[b].clientId == state.clientId) {
+            size += DeltaSnapshotDetail::WriteEntry(dst + size, baseline[b], state, false);
+            b++;
+        } else {
+            size += DeltaSnapshotDetail::WriteEntry(dst + size, Empty, state, true);
+        }
+    }
+    for (; b < baseline.size(); b++) {
+        size += WriteVarUInt(dst + size, (uint32_t)baseline[b].clientId);
+        dst[size++] = DeltaField_Removed;
+    }
+    out.resize(size);
+}
+
+// 클라이언트 쪽 복원 - baseline에 델타를 적용해 out에 새 상태 (clientId 오름차순), 형식이 잘못되면 false
+inline bool ApplyDeltaSnapshot(const std::vector<DeltaTankState>& baseline, const uint8_t* data, size_t size,
+                               std::vector<DeltaTankState>& out) {
+    out.clear();
+    size_t b = 0;
+    size_t offset = 0;
+    while (offset < size) {
+        uint32_t clientId = 0;
+        size_t read = ReadVarUInt(data + offset, size - offset, clientId);
+        if (read == 0 || offset + read >= size) {
+            return false;
+        }
+        offset += read;
+        uint8_t mask = data[offset++];
+
+        // 델타에 없는 기준 탱크는 그대로 유지
+        while (b < baseline.size() && baseline[b].clientId < (int32_t)clientId) {
+            out.push_back(baseline[b++]);
+        }
+        DeltaTankState state = {};
+        if (b < baseline.size() && baseline[b].clientId == (int32_t)clientId) {
+            state = baseline[b++];
+        }
+        state.clientId = (int32_t)clientId;
+        if (mask & DeltaField_Removed) {
+            continue;
+        }
+
+        uint32_t value = 0;
+        if (mask & DeltaField_PosX) {
+            if ((read = ReadVarUInt(data + offset, size - offset, value)) == 0) return false;
+            state.posX = (int16_t)(state.posX + ZigZagDecode(value));
+            offset += read;
+        }
+        if (mask & DeltaField_PosY) {
+            if ((read = ReadVarUInt(data + offset, size - offset, value)) == 0) return false;
+            state.posY = (int16_t)(state.posY + ZigZagDecode(value));
+            offset += read;
+        }
+        if (mask & DeltaField_Direction) {
+            if (offset >= size) return false;
+            state.direction = (uint8_t)(state.direction + data[offset++]);
+        }
+        if (mask & DeltaField_TankType) {
+            if ((read = ReadVarUInt(data + offset, size - offset, value)) == 0) return false;
+            state.tankType = ZigZagDecode(value);
+            offset += read;
+        }
+        if (mask & DeltaField_CurrentHealth) {
+            if (size - offset < 4) return false;
+            std::memcpy(&state.currentHealth, data + offset, 4);
+            offset += 4;
+        }
+        if (mask & DeltaField_MaxHealth) {
+            if (size - offset < 4) return false;
+            std::memcpy(&state.maxHealth, data + offset, 4);
+            offset += 4;
+        }
+        if (mask & DeltaField_DestroyedToggle) {
+            state.isDestroyed = !state.isDestroyed;
+        }
+        out.push_back(state);
+    }
+    while (b < baseline.size()) {
+        out.push_back(baseline[b++]);
+    }
+    return true;
+}
+
+// DeltaSnapshotHistory - 최근 DeltaSnapshotHistorySize 틱의 방 상태 링 버퍼 (틱 번호 % 크기 위치에 저장)
+class DeltaSnapshotHistory {
+public:
+    // 이번 틱 상태를 기록할 배열 (호출한 쪽이 채우고 clientId 순으로 정렬)
+    std::vector<DeltaTankState>& Begin(uint32_t tickId) {
+        Entry& entry = entries[tickId % DeltaSnapshotHistorySize];
+        entry.tickId = tickId;
+        entry.states.clear();
+        return entry.states;
+    }
+
+    // 기록이 남아 있는 틱이면 그 상태, 아니면 nullptr
+    const std::vector<DeltaTankState>* Find(uint32_t tickId) const {
+        if (tickId == 0) {
+            return nullptr;
+        }
+        const Entry& entry = entries[tickId % DeltaSnapshotHistorySize];
+        return entry.tickId == tickId ? &entry.states : nullptr;
+    }
+
+private:
+    struct Entry {
+        uint32_t tickId = 0;
+        std::vector<DeltaTankState> states;
+    };
+
+    Entry entries[DeltaSnapshotHistorySize];
+};
+
+// 스냅샷 형식
+enum class SnapshotFormat : uint8_t {
+    Float,
+    Compact,
+    Delta,
+    Legacy,     // SendHello 이전 클라이언트 - 바뀐 탱크마다 OnTankPositionUpdated
+    Count
+};
+
+inline const char* SnapshotFormatName(SnapshotFormat format) {
+    static const char* names[] = { "float", "compact", "delta", "legacy" };
+    return (size_t)format < sizeof(names) / sizeof(names[0]) ? names[(size_t)format] : "?";
+}
+
+// 형식별 스냅샷 송신 누적 값 - 틱 스레드가 기록하고 메트릭 HTTP 스레드가 읽음
+struct SnapshotFormatCounters {
+    std::atomic<uint64_t> messages{ 0 };     // 멀티캐스트 호출 수
+    std::atomic<uint64_t> deliveries{ 0 };   // 수신자 수 합계
+    std::atomic<uint64_t> bytes{ 0 };        // 스냅샷 바이트 x 수신자 수
+    std::atomic<int> clients{ 0 };           // 현재 이 형식을 받는 클라이언트 수
+
+    void Record(size_t size, int recipientCount) {
+        messages.fetch_add(1, std::memory_order_relaxed);
+        deliveries.fetch_add((uint64_t)recipientCount, std::memory_order_relaxed);
+        bytes.fetch_add((uint64_t)size * (uint64_t)recipientCount, std::memory_order_relaxed);
+    }
+};
+
+struct SnapshotStats {
+    SnapshotFormatCounters formats[(size_t)SnapshotFormat::Count];
+    std::atomic<uint64_t> fullFallbacks{ 0 };   // 기준이 없거나 오래되어 전체 스냅샷을 받은 델타 클라이언트 수 합계
+
+    SnapshotFormatCounters& Format(SnapshotFormat format) { return formats[(size_t)format]; }
+    const SnapshotFormatCounters& Format(SnapshotFormat format) const { return formats[(size_t)format]; }
+};
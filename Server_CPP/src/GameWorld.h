@@ -0,0 +1,1899 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "AsyncLog.h"
+#include "BroadcastGroup.h"
+#include "CompactMove.h"
+#include "DeadReckoning.h"
+#include "DeltaSnapshot.h"
+#include "InterestVisibility.h"
+#include "PoseHistory.h"
+#include "PriorityScheduler.h"
+#include "ProjectileSystem.h"
+#include "SendBacklog.h"
+#include "SimCommand.h"
+#include "SpatialHash.h"
+#include "TankRegistry.h"
+#include "TankSnapshot.h"
+
+// GameEventSink - 월드가 클라이언트에게 내보내는 이벤트 (전송 계층 추상화)
+// 메서드는 PIDL의 서버 -> 클라이언트 RMI와 1:1로 대응하며, recipients는 HostID 배열로 호출 동안만 유효합니다.
+// ProudNet 구현은 생성된 Proxy의 멀티캐스트 오버로드로 그대로 넘기고,
+// 벤치마크/부하 테스트는 RecordingEventSink로 네트워크 없이 같은 월드 코드를 구동합니다.
+class GameEventSink {
+public:
+    virtual ~GameEventSink() {}
+
+    virtual void OnPlayerJoined(const int* recipients, int count, int clientId, float posX, float posY, int tankType) = 0;
+    virtual void OnPlayerLeft(const int* recipients, int count, int clientId) = 0;
+    virtual void OnTankHealthUpdated(const int* recipients, int count, int clientId, float currentHealth, float maxHealth) = 0;
+    virtual void OnTankDestroyed(const int* recipients, int count, int clientId, int destroyedById) = 0;
+    virtual void OnTankSpawned(const int* recipients, int count, int clientId, float posX, float posY, float direction,
+                               int tankType, float initialHealth) = 0;
+    virtual void OnSpawnBullet(const int* recipients, int count, int clientId, int shooterId, float posX, float posY,
+                               float direction, float launchForce, float fireX, float fireY, float fireZ) = 0;
+    virtual void OnTankPositionUpdated(const int* recipients, int count, int clientId, float posX, float posY, float direction) = 0;
+    virtual void OnTankSnapshot(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) = 0;
+    virtual void OnTanksOutOfRange(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) = 0;
+    virtual void OnWorldSnapshot(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) = 0;
+    virtual void OnTankSnapshotCompact(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) = 0;
+    virtual void OnRoomSlots(const int* recipients, int count, const uint8_t* data, size_t size) = 0;
+    virtual void OnTankDeltaSnapshot(const int* recipients, int count, int tickId, int baselineTickId,
+                                     const uint8_t* data, size_t size) = 0;
+    virtual void P2PMessage(const int* recipients, int count, const std::string& message) = 0;
+
+    // P2P 그룹 관리 (그룹 ID는 전송 계층이 발급)
+    virtual int CreateP2PGroup(const int* members, int count) = 0;
+    virtual bool JoinP2PGroup(int hostId, int groupId) = 0;
+    virtual void LeaveP2PGroup(int hostId, int groupId) = 0;
+};
+
+// 월드에 적용하는 명령 - P2P 메시지는 std::string으로 넘겨 전송 계층과 무관하게 둠
+typedef SimCommand<std::string> GameCommand;
+
+// GameWorld - 탱크 게임 로직 (접속/이동/발사/체력/P2P 릴레이/스냅샷)
+// 전송 계층을 모르고 GameEventSink로만 이벤트를 내보내므로 ProudNet 없이 구동/벤치마크할 수 있습니다.
+// 스레드 안전하지 않으며, 호출하는 쪽이 접근을 직렬화해야 합니다 (actor 모드의 틱 스레드 또는 lock 모드의 뮤텍스).
+class GameWorld {
+public:
+    explicit GameWorld(GameEventSink& sink, float interestRadius = 0.0f)
+        : sink(sink), interestRadius(interestRadius), gameP2PGroupId(0), random(std::random_device()()) {
+        // 셀 크기를 관심 반경과 같게 두어 쿼리가 주변 3x3 셀만 보도록 함
+        if (UseInterestManagement()) {
+            spatialHash.SetCellSize(interestRadius);
+        }
+    }
+
+    GameWorld(const GameWorld&) = delete;
+    GameWorld& operator=(const GameWorld&) = delete;
+
+    // 접속 위치 난수 시드 고정 (벤치마크/재현용)
+    void SetRandomSeed(uint32_t seed) { random.seed(seed); }
+
+    // SendHello를 기다리는 틱 수 (접속자가 생기기 전에 설정)
+    // 그 안에 Hello가 오면 방 상태를 OnWorldSnapshot으로 보내고, 오지 않으면 이전 클라이언트로 보고
+    // 탱크마다 OnPlayerJoined/OnTankHealthUpdated/OnTankDestroyed를 보낸 뒤 위치를 OnTankPositionUpdated로 보냅니다
+    void SetHelloWaitTicks(uint32_t ticks) { helloWaitTicks = ticks; }
+
+    // 위치 스냅샷을 비신뢰로 보낼 때 ticks 틱마다 모든 탱크 위치를 다시 포함 (0이면 바뀐 탱크만)
+    // 변경분만 보내는 float/압축 스냅샷은 멈춘 탱크의 마지막 위치가 유실되면 다시 움직일 때까지 복구되지 않기 때문
+    void SetPositionRefreshTicks(uint32_t ticks) { positionRefreshTicks = ticks; }
+
+    // float/압축 스냅샷의 데드 레커닝 전송 억제 설정 (positionThreshold가 0이면 끔)
+    void SetDeadReckoning(const DeadReckoningConfig& config) {
+        deadReckoning = config;
+        deadReckoningModels.clear();
+    }
+
+    // 관찰자별 우선순위 스냅샷 설정 (budget이 0이면 끔, 접속자가 생기기 전에 설정)
+    // 켜면 위치 스냅샷을 관찰자마다 따로 만들고, 델타 스냅샷 대신 압축 형식을 씁니다
+    void SetPriorityScheduling(const PriorityConfig& config) { priorityScheduler.SetConfig(config); }
+
+    // 송신 대기열 백프레셔 설정 (highWaterBytes가 0이면 끔, 접속자가 생기기 전에 설정)
+    // 꺼도 UpdateSendQueue로 받은 대기열 크기는 status 출력용으로 기록합니다
+    void SetSendBacklog(const SendBacklogConfig& config) { sendBacklog = config; }
+
+    // 서버 판정 포탄 설정 (tickSeconds가 0이면 끔 - 명중 판정은 클라이언트 보고를 따름)
+    // 켜면 SendFire마다 포탄을 만들어 틱마다 명중을 판정하고 체력/파괴 이벤트를 보내며, 클라이언트의 체력/파괴 보고는 무시합니다
+    void SetProjectiles(const ProjectileConfig& config) {
+        projectiles.SetConfig(config);
+        projectiles.Clear();
+    }
+
+    // 포탄 지연 보상 설정 (maxRewindMs가 0이면 끔, 서버 판정 포탄을 켰을 때만 적용, 접속자가 생기기 전에 설정)
+    // 켜면 SendMove마다 받은 시각과 위치를 탱크별 링 버퍼에 기록하고, 발사한 클라이언트의 RTT만큼 되감은 위치로
+    // 새 포탄을 지금까지 따라잡게 해 클라이언트가 화면에서 맞힌 탱크를 서버도 맞은 것으로 판정합니다
+    void SetLagCompensation(const LagCompensationConfig& config) { poseHistory.SetConfig(config); }
+
+    // 접속 위치 후보 수 (1 이하면 기존처럼 무작위 한 곳, 접속자가 생기기 전에 설정)
+    // 2 이상이면 후보마다 공간 해시로 가장 가까운 탱크를 찾아 가장 먼 후보에 생성하므로, 관심 영역을 쓰지 않아도 공간 해시를 유지합니다
+    void SetSpawnCandidates(int count) {
+        spawnCandidates = std::max(count, 1);
+        if (UseSpatialIndex() && !UseInterestManagement()) {
+            spatialHash.SetCellSize(SpawnCellSize);
+        }
+    }
+
+    // 클라이언트의 최근 RTT 반영 - 전송 계층이 주기적으로 호출 (지연 보상을 쓰지 않거나 접속 중이 아니면 무시)
+    void UpdateClientRtt(int hostId, int rttMs) {
+        TankHandle handle = tanks.Find(hostId);
+        if (UseLagCompensation() && handle.IsValid()) {
+            poseHistory.SetRtt(handle.slot, rttMs);
+        }
+    }
+
+    // 클라이언트의 송신 대기열 크기 반영 - 전송 계층이 틱마다 BroadcastSnapshot 전에 클라이언트마다 한 번 호출
+    // 연결을 끊어야 하면 (한도 초과 또는 버리는 상태가 오래 이어짐) 클라이언트마다 한 번만 true
+    bool UpdateSendQueue(int hostId, uint32_t queuedBytes);
+
+    // 명령 하나를 적용 (P2P 메시지 해제는 명령을 만든 쪽 책임)
+    void Apply(const GameCommand& command) {
+        int remote = command.remote;
+        if (UseLagCompensation()) {
+            // 위치 기록과 되감기의 기준 시각은 명령을 받은 시각 (actor 모드는 틱 사이에 모아서 적용하므로)
+            commandNs = command.enqueueNs > 0 ? command.enqueueNs : SimNowNs();
+        }
+        switch (command.type) {
+        case SimCommandType::Join:
+            ApplyJoin(remote);
+            break;
+        case SimCommandType::Leave:
+            ApplyLeave(remote);
+            break;
+        case SimCommandType::Move:
+            ApplyMove(remote, command.pose);
+            break;
+        case SimCommandType::MoveSequenced:
+            ApplySequencedMove(remote, command.sequencedMove);
+            break;
+        case SimCommandType::Fire:
+            ApplyFire(remote, command.fire);
+            break;
+        case SimCommandType::TankType:
+            ApplyTankType(remote, command.tankType);
+            break;
+        case SimCommandType::HealthUpdated:
+            ApplyHealthUpdated(remote, command.health);
+            break;
+        case SimCommandType::Destroyed:
+            ApplyDestroyed(remote, command.destroyedById);
+            break;
+        case SimCommandType::Spawned:
+            ApplySpawned(remote, command.spawn);
+            break;
+        case SimCommandType::P2PMessage:
+            ApplyP2PMessage(remote, *command.message);
+            break;
+        case SimCommandType::Hello:
+            ApplyHello(remote, command.protocolRevision);
+            break;
+        case SimCommandType::SnapshotAck:
+            ApplySnapshotAck(remote, command.ackTickId);
+            break;
+        case SimCommandType::Damage:
+            DamageTank(command.console.targetId, command.console.amount);
+            break;
+        case SimCommandType::Heal:
+            HealTankBy(command.console.targetId, command.console.amount);
+            break;
+        case SimCommandType::Respawn:
+            RespawnTankAt(command.console.targetId, command.console.posX, command.console.posY);
+            break;
+        case SimCommandType::PrintStatus:
+            PrintConnectedClients();
+            break;
+        case SimCommandType::PrintHealth:
+            PrintTankHealth(command.console.targetId);
+            break;
+        }
+    }
+
+    // 명령별 적용 함수
+    void ApplyJoin(int hostId);
+    void ApplyLeave(int hostId);
+    void ApplyMove(int remote, const SimPoseArgs& args);
+    void ApplySequencedMove(int remote, const SimSequencedMoveArgs& args);
+    void ApplyFire(int remote, const SimFireArgs& args);
+    void ApplyTankType(int remote, int tankType);
+    void ApplyHealthUpdated(int remote, const SimHealthArgs& args);
+    void ApplyDestroyed(int remote, int destroyedById);
+    void ApplySpawned(int remote, const SimSpawnArgs& args);
+    void ApplyP2PMessage(int remote, const std::string& message);
+    void ApplyHello(int remote, int protocolRevision);
+    void ApplySnapshotAck(int remote, uint32_t tickId);
+
+    // 콘솔 명령
+    void DamageTank(int targetId, float damageAmount);
+    void HealTankBy(int targetId, float healAmount);
+    void RespawnTankAt(int targetId, float posX, float posY);
+    void PrintConnectedClients();
+    void PrintTankHealth(int targetId);
+
+    // 틱마다 이번 틱 접속자에게 방 전체 상태를 보내고, 변경된 탱크 위치를 모아 한 번에 전송
+    void BroadcastSnapshot(uint32_t tickId);
+
+    // 방 전체 상태를 아직 받지 못한 접속자 수
+    size_t PendingBootstrapCount() const { return pendingBootstrap.size(); }
+
+    // 압축 이동 프로토콜을 쓰는 클라이언트인지
+    bool UsesCompactMove(int hostId) const { return compactRecipients.Contains(hostId) || deltaRecipients.Contains(hostId); }
+
+    // 델타 스냅샷을 받는 클라이언트인지
+    bool UsesDeltaSnapshot(int hostId) const { return deltaRecipients.Contains(hostId); }
+
+    // 형식별 스냅샷 송신 누적 값 (atomic - 다른 스레드에서 읽어도 됨)
+    const SnapshotStats& SnapshotStatsRef() const { return snapshotStats; }
+
+    // 순서 번호가 마지막 적용 값보다 오래되어 버린 이동 수 (atomic - 다른 스레드에서 읽어도 됨)
+    uint64_t OutOfOrderMoveCount() const { return outOfOrderMoves.load(std::memory_order_relaxed); }
+
+    // 압축 위치 범위(기준점 +-512)를 벗어난 이동 수 - 압축/델타 스냅샷에서는 가장자리로 고정됨 (atomic - 다른 스레드에서 읽어도 됨)
+    uint64_t CompactOutOfRangeMoveCount() const { return compactOutOfRangeMoves.load(std::memory_order_relaxed); }
+
+    // 우선순위 스냅샷으로 보낸/다음 틱으로 미룬 항목 수 (atomic - 다른 스레드에서 읽어도 됨)
+    const PriorityStats& PriorityStatsRef() const { return priorityScheduler.Stats(); }
+
+    // 데드 레커닝으로 보낸/생략한 위치 수 (atomic - 다른 스레드에서 읽어도 됨)
+    const DeadReckoningStats& DeadReckoningStatsRef() const { return deadReckoningStats; }
+
+    // 서버 판정 포탄 누적 값과 날아가는 포탄 수 (atomic - 다른 스레드에서 읽어도 됨)
+    const ProjectileStats& ProjectileStatsRef() const { return projectiles.Stats(); }
+
+    // 지연 보상 누적 값과 위치 기록 메모리 (atomic - 다른 스레드에서 읽어도 됨)
+    const LagCompensationStats& LagCompensationStatsRef() const { return poseHistory.Stats(); }
+
+    // 탱크 하나의 위치 기록 메모리 (바이트)
+    size_t PoseHistoryBytesPerTank() const { return poseHistory.BytesPerTank(); }
+
+    // 송신 대기열 백프레셔 누적 값과 상태별 클라이언트 수 (atomic - 다른 스레드에서 읽어도 됨)
+    const SendBacklogStats& SendBacklogStatsRef() const { return sendBacklogStats; }
+
+    // 클라이언트의 송신 대기열 상태 (접속 중이 아니면 nullptr)
+    const SendBacklogState* FindSendBacklog(int hostId) const {
+        auto it = sendBacklogs.find(hostId);
+        return it != sendBacklogs.end() ? &it->second : nullptr;
+    }
+
+    // 클라이언트가 보고 있다고 가정하는 탱크의 모델 (데드 레커닝을 쓰지 않거나 아직 보낸 적이 없으면 nullptr)
+    const DeadReckoningModel* FindDeadReckoningModel(int hostId) const {
+        auto it = deadReckoningModels.find(hostId);
+        return it != deadReckoningModels.end() ? &it->second : nullptr;
+    }
+
+    size_t TankCount() const { return tanks.Size(); }
+    const TankRegistry& Tanks() const { return tanks; }
+    int P2PGroupId() const { return gameP2PGroupId; }
+    bool UseInterestManagement() const { return interestRadius > 0.0f; }
+    bool UsePriorityScheduling() const { return priorityScheduler.Config().Enabled(); }
+    bool UseServerProjectiles() const { return projectiles.Config().Enabled(); }
+    bool UseLagCompensation() const { return UseServerProjectiles() && poseHistory.Config().Enabled(); }
+    bool UseSpatialIndex() const { return UseInterestManagement() || spawnCandidates > 1; }
+
+private:
+    // Hello를 보낸 접속자들에게 방 전체 상태를 OnWorldSnapshot 한 번으로 전송 (기다린 틱이 지난 접속자는 탱크별 RMI로)
+    void SendWorldSnapshot(uint32_t tickId);
+
+    // Hello 이전 클라이언트 하나에게 기존 탱크마다 접속/체력/파괴 알림을 보내고 탱크별 위치 수신자로 등록
+    void SendLegacyBootstrap(int hostId);
+
+    // Hello 이전 클라이언트들에게 스냅샷 항목마다 OnTankPositionUpdated 전송 (움직인 클라이언트 자신 제외)
+    void SendLegacyPositions(const uint8_t* entries, size_t size);
+
+    // 스냅샷 항목들을 Hello 이전 클라이언트 하나에게 OnTankPositionUpdated로 전송 (관찰자별 경로용)
+    void SendLegacyPositions(int hostId, const uint8_t* entries, size_t size);
+
+    // SendHello로 스냅샷 형식을 정한 클라이언트인지
+    bool HasSnapshotFormat(int hostId) const {
+        return floatRecipients.Contains(hostId) || compactRecipients.Contains(hostId) || deltaRecipients.Contains(hostId);
+    }
+
+    // 관심 영역 사용 시 수신자별 스냅샷 전송
+    void BroadcastInterestSnapshot(uint32_t tickId);
+
+    // 이번 틱 상태를 기록하고 델타 클라이언트마다 마지막 ack 기준의 델타 전송
+    void SendDeltaSnapshots(uint32_t tickId);
+
+    // 관찰자마다 우선순위가 높은 탱크를 budget개까지 골라 전송
+    void BroadcastPrioritySnapshot(uint32_t tickId);
+
+    // 변경 표시를 데드 레커닝 모델 오차가 허용치를 넘은 탱크로 좁힘 (refresh면 모두 보냄)
+    void ApplyDeadReckoning(uint32_t tickId, bool refresh);
+
+    // 건너뛴 위치를 모아 정상으로 돌아왔거나 모으는 중 차례가 된 클라이언트에게 전송 (float/압축/관심 영역 경로)
+    void SendCoalescedPositions(uint32_t tickId);
+
+    // 포탄 한 틱 진행 - 살아 있는 탱크를 충돌 대상으로 복사한 뒤 명중마다 피해 적용
+    void StepProjectiles();
+
+    // 방금 만든 포탄을 쏜 클라이언트가 보던 시각부터 지금까지 틱 단위로 진행 (탱크 위치는 그때마다 되감음)
+    void RewindNewestProjectile(uint32_t shooterSlot);
+
+    // 위치 기록 - 순간 이동(생성/리스폰)이면 이전 기록을 비우고 새 위치부터
+    void RecordPoseHistory(TankHandle handle, float posX, float posY, bool teleport);
+
+    // 포탄 명중 피해 적용과 체력/파괴 이벤트 전송 (이미 파괴된 탱크면 무시)
+    void ApplyProjectileHit(const ProjectileHit& hit);
+
+    // 대기열 상태 변경과 상태별 클라이언트 수 갱신
+    void SetSendBacklogLevel(SendBacklogState& state, SendBacklogLevel level);
+
+    // 정상 상태가 아니면 그 클라이언트의 상태 (모두 정상이면 조회하지 않고 nullptr)
+    SendBacklogState* FindCongested(int hostId) {
+        if (congestedCount == 0) {
+            return nullptr;
+        }
+        auto it = sendBacklogs.find(hostId);
+        return it != sendBacklogs.end() && it->second.level != SendBacklogLevel::Normal ? &it->second : nullptr;
+    }
+
+    // 위치 스냅샷을 건너뛴 클라이언트 표시 - 나중에 모은 위치를 받음
+    void MarkPositionsSkipped(SendBacklogState& state) {
+        if (!state.stale) {
+            state.stale = true;
+            staleCount++;
+        }
+        sendBacklogStats.skipped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 정상 상태가 아닌 클라이언트를 뺀 위치 스냅샷 수신자 배열 (모두 정상이면 그대로)
+    int* ExcludeCongested(int* recipients, int& count);
+
+    // 버리는 상태인 클라이언트를 뺀 총알 수신자 배열 (없으면 그대로)
+    int* ExcludeDropping(int* recipients, int& count);
+
+    // 이번 틱에 위치를 보낼 차례인지 (모으는 중이면 보낸 틱 기록) - 스스로 기준을 맞추는 델타/우선순위 경로용
+    bool TakePositionTurn(int hostId, uint32_t tickId);
+
+    // 형식별 클라이언트 수 게이지 갱신 (접속/퇴장/Hello 때)
+    void UpdateSnapshotClientCounts();
+
+    // float 스냅샷 항목들을 압축 항목으로 변환해 compactBuffer에 기록 (관심 영역 수신자별 버퍼용)
+    void ConvertToCompactSnapshot(const std::vector<uint8_t>& entries);
+
+    // 슬롯 표 전송 - hostId가 0이면 방 전체, 아니면 그 탱크 하나
+    void SendRoomSlots(const int* recipients, int recipientCount, int hostId);
+
+    // (x, y) 위치의 이벤트를 받아야 하는 클라이언트 배열 (exclude 제외, 멀티캐스트 호출에 그대로 사용)
+    int* CollectInterestedClients(float x, float y, int exclude, int& count);
+
+    // 탱크 위치 변경을 공간 해시에 반영
+    void UpdateSpatialHash(int hostId, float x, float y) {
+        if (UseSpatialIndex()) {
+            spatialHash.Update(hostId, x, y);
+        }
+    }
+
+    // P2P 그룹에 참가자 추가 (그룹은 한 번 만들어지면 월드가 끝날 때까지 유지)
+    void JoinGameP2PGroup(int hostId);
+
+    // 새 탱크의 접속 위치 (후보가 여럿이면 가장 가까운 탱크가 가장 먼 후보)
+    void PickJoinPosition(float& posX, float& posY);
+
+    // P2P 그룹에서 참가자 제거
+    void LeaveGameP2PGroup(int hostId);
+
+    // P2P 그룹 ID를 지정한 클라이언트에게만 알림
+    void SendP2PGroupInfo(const int* recipients, int recipientCount);
+
+    // 클라이언트 ID로 HostID 찾기 (없으면 0)
+    int FindHostIDById(int clientId) const {
+        // 레지스트리 해시 인덱스로 O(1) 조회
+        return tanks.Contains(clientId) ? clientId : 0;
+    }
+
+    GameEventSink& sink;
+    float interestRadius;
+
+    // 연결된 탱크들의 정보 (HostID -> 슬롯 O(1) 조회, dense 배열 순회)
+    TankRegistry tanks;
+
+    // P2P 그룹 ID (0이면 아직 없음)
+    int gameP2PGroupId;
+
+    // 방 전체 멀티캐스트 수신자 배열 (접속/퇴장 때만 갱신)
+    BroadcastGroup<int> roomRecipients;
+
+    // SendHello로 틱 스냅샷을 지원한다고 알린 클라이언트 (float 또는 압축 스냅샷, 델타는 아래)
+    BroadcastGroup<int> floatRecipients;
+    BroadcastGroup<int> compactRecipients;
+
+    // 압축 위치 범위를 벗어난 이동 수
+    std::atomic<uint64_t> compactOutOfRangeMoves{ 0 };
+
+    // SendHello를 보내지 않아 탱크별 RMI로 방 상태를 받은 클라이언트 (위치는 OnTankPositionUpdated)
+    // 방 상태를 기다리는 접속자는 어느 형식 그룹에도 없음
+    BroadcastGroup<int> legacyRecipients;
+    std::vector<int> legacyPositionRecipients;
+
+    // 델타 스냅샷을 받는 클라이언트 (관심 영역을 쓰지 않을 때만, float/압축 스냅샷은 받지 않음)
+    BroadcastGroup<int> deltaRecipients;
+
+    // 델타 클라이언트별 마지막으로 ack한 틱과 마지막으로 보낸 틱 (0이면 없음)
+    struct DeltaClientState {
+        uint32_t ackedTick = 0;
+        uint32_t sentTick = 0;
+    };
+    std::unordered_map<int, DeltaClientState> deltaClients;
+
+    // 최근 틱의 방 상태, 같은 기준 틱끼리 묶은 (기준 틱, HostID) 목록과 델타 패킹 버퍼 (틱마다 재사용)
+    DeltaSnapshotHistory deltaHistory;
+    std::vector<std::pair<uint32_t, int>> deltaBaselines;
+    std::vector<int> deltaGroup;
+    std::vector<uint8_t> deltaBuffer;
+
+    // 형식별 스냅샷 송신 누적 값
+    SnapshotStats snapshotStats;
+
+    // 전체 위치를 다시 보내는 주기 (0이면 끔)
+    uint32_t positionRefreshTicks = 0;
+
+    // 클라이언트별 마지막으로 적용한 이동 순서 번호와 늦게 도착해 버린 이동 수
+    std::unordered_map<int, uint16_t> moveSequences;
+    std::atomic<uint64_t> outOfOrderMoves{ 0 };
+
+    // 데드 레커닝 설정, 탱크별 모델 (HostID -> 모델)과 누적 값
+    DeadReckoningConfig deadReckoning;
+    std::unordered_map<int, DeadReckoningModel> deadReckoningModels;
+    DeadReckoningStats deadReckoningStats;
+
+    // 관찰자별 우선순위 누적 값과 관찰자 하나의 패킹 버퍼 (발사 시각은 lastTickId로 기록)
+    PriorityScheduler priorityScheduler;
+    std::vector<uint8_t> priorityBuffer;
+
+    // 송신 대기열 백프레셔 설정, 클라이언트별 상태 (HostID -> 상태)와 누적 값
+    // 정상 상태가 아닌 클라이언트 수와 모은 위치를 기다리는 클라이언트 수가 0이면 스냅샷 경로는 상태를 조회하지 않음
+    SendBacklogConfig sendBacklog;
+    std::unordered_map<int, SendBacklogState> sendBacklogs;
+    SendBacklogStats sendBacklogStats;
+    int congestedCount = 0;
+    int droppingCount = 0;
+    int staleCount = 0;
+
+    // 서버 판정 포탄 풀, 충돌 대상 탱크와 이번 틱 명중 (틱마다 재사용)
+    ProjectileSystem projectiles;
+    ProjectileTargets projectileTargets;
+    std::vector<ProjectileHit> projectileHits;
+
+    // 지연 보상 - 탱크별 위치 링 버퍼와 지금 적용 중인 명령을 받은 시각
+    PoseHistory poseHistory;
+    int64_t commandNs = 0;
+
+    // 혼잡한 클라이언트를 뺀 수신자 배열과 모은 위치 패킹 버퍼 (틱마다 재사용)
+    std::vector<int> positionRecipients;
+    std::vector<uint8_t> coalescedBuffer;
+
+    // 탱크 위치 공간 해시 (관심 영역 또는 접속 위치 후보가 여럿일 때만 유지)
+    SpatialHash spatialHash;
+
+    // 접속 위치 후보 수와 후보의 최근접 탱크 쿼리 결과 (접속마다 재사용)
+    // 관심 영역 없이 공간 해시를 쓸 때의 셀 크기는 접속 영역 (0 ~ 100)을 4 x 4로 나눈 크기
+    static constexpr float SpawnAreaSize = 100.0f;
+    static constexpr float SpawnCellSize = 25.0f;
+    int spawnCandidates = 1;
+    std::vector<SpatialNeighbor> spawnNeighbors;
+
+    // 관심 영역 사용 시 관찰자별로 지난 틱에 보이던 탱크
+    InterestVisibility interestVisibility;
+
+    // 스냅샷 패킹 버퍼와 범위 밖 알림 버퍼 (관심 영역 사용 시 관찰자마다, 틱마다 재사용)
+    std::vector<uint8_t> snapshotBuffer;
+    std::vector<uint8_t> outOfRangeBuffer;
+
+    // 압축 스냅샷/슬롯 표 패킹 버퍼 (틱마다 재사용)
+    std::vector<uint8_t> compactBuffer;
+
+    // 방 전체 상태를 기다리는 접속자 (접속한 틱, Hello를 기다리는 동안 남음), Hello 대기 틱 수와 마지막 틱
+    struct PendingBootstrap {
+        int hostId;
+        uint32_t joinTick;
+    };
+    std::vector<PendingBootstrap> pendingBootstrap;
+    uint32_t helloWaitTicks = 0;
+    uint32_t lastTickId = 0;
+
+    // 이번 틱 OnWorldSnapshot 수신자와 패킹 버퍼 (틱마다 한 번 만들어 모두에게 공유)
+    std::vector<int> worldSnapshotRecipients;
+    std::vector<uint8_t> worldSnapshotBuffer;
+
+    // 이벤트 수신자 목록 (핸들러마다 재할당하지 않도록 재사용)
+    std::vector<int> eventRecipients;
+
+    // 접속 위치 난수
+    std::mt19937 random;
+};
+
+// 접속 위치 선택 - 후보가 하나면 접속 영역의 무작위 위치, 여럿이면 최근접 탱크까지의 거리가 가장 큰 후보
+// (영역 대각선 안에 탱크가 없는 후보는 바로 선택)
+inline void GameWorld::PickJoinPosition(float& posX, float& posY) {
+    // 랜덤 위치 생성 (예: 0~100 범위)
+    std::uniform_real_distribution<float> dis(0.0f, SpawnAreaSize);
+    posX = dis(random);
+    posY = dis(random);
+    if (spawnCandidates <= 1 || spatialHash.Size() == 0) {
+        return;
+    }
+
+    const float maxDistance = SpawnAreaSize * 1.5f;
+    float bestDistanceSq = -1.0f;
+    for (int i = 0; i < spawnCandidates; i++) {
+        float x = i == 0 ? posX : dis(random);
+        float y = i == 0 ? posY : dis(random);
+        float distanceSq = spatialHash.QueryNearest(x, y, 1, maxDistance, 0, spawnNeighbors) > 0
+            ? spawnNeighbors[0].distanceSq : maxDistance * maxDistance;
+        if (distanceSq > bestDistanceSq) {
+            bestDistanceSq = distanceSq;
+            posX = x;
+            posY = y;
+        }
+        if (distanceSq >= maxDistance * maxDistance) {
+            break;
+        }
+    }
+}
+
+// 클라이언트 접속 적용 - 탱크 생성 후 기존/신규 클라이언트에게 알림
+inline void GameWorld::ApplyJoin(int hostId) {
+    float posX;
+    float posY;
+    PickJoinPosition(posX, posY);
+
+    // 초기 탱크 타입은 -1로 설정 (선택 안함)
+    int defaultTankType = -1;
+
+    // 초기 체력 설정
+    float defaultMaxHealth = 100.0f;
+    float defaultHealth = defaultMaxHealth;
+
+    // 탱크 정보 저장
+    TankInfo newTank(hostId, posX, posY, 0, defaultTankType, defaultMaxHealth);
+    TankHandle handle = tanks.Insert(hostId, newTank);
+    if (UsePriorityScheduling()) {
+        priorityScheduler.ResetSlot(handle.slot);
+    }
+    RecordPoseHistory(handle, posX, posY, true);
+    if (UseLagCompensation()) {
+        poseHistory.SetRtt(handle.slot, 0);   // 슬롯의 이전 탱크 RTT를 쓰지 않도록 (다음 RTT 조회까지는 되감지 않음)
+    }
+    roomRecipients.Add(hostId);
+    sendBacklogs[hostId] = SendBacklogState();
+    UpdateSpatialHash(hostId, posX, posY);
+    if (UseInterestManagement()) {
+        interestVisibility.AddSlot(handle.slot);
+    }
+
+    TANK_LOG_INFO(LogCategory::Net, "Client connected: Host ID = {}", hostId);
+    TANK_LOG_DEBUG(LogCategory::Net, "New tank created for client {} with tank type {} and health {}/{}",
+                   hostId, defaultTankType, defaultHealth, defaultMaxHealth);
+
+    // 새 클라이언트에게 보낼 기존 탱크 정보는 Hello가 온 뒤의 틱에 OnWorldSnapshot 한 번으로 전송
+    // (탱크마다 OnPlayerJoined/OnTankHealthUpdated/OnTankDestroyed를 따로 보내면 200명 방에서 최대 600회 RMI)
+    // Hello를 보내지 않는 이전 클라이언트는 기다린 틱이 지나면 기존처럼 탱크별 RMI로 받음
+    pendingBootstrap.push_back(PendingBootstrap{ hostId, lastTickId });
+
+    // 모든 클라이언트에게 새 플레이어 참가 알림 (새로 참가한 클라이언트 자신 제외)
+    int recipientCount = 0;
+    int* recipients = roomRecipients.AllExcept(hostId, recipientCount);
+    if (recipientCount > 0) {
+        // 새 플레이어 정보 전송
+        sink.OnPlayerJoined(recipients, recipientCount, hostId, posX, posY, defaultTankType);
+
+        // 새 플레이어 체력 정보 전송
+        sink.OnTankHealthUpdated(recipients, recipientCount, hostId, defaultHealth, defaultMaxHealth);
+    }
+
+    // 압축 이동 클라이언트에게 새 탱크의 슬롯 알림 (새 클라이언트는 아직 Hello 전이라 포함되지 않음)
+    int compactCount = 0;
+    int* compactClients = compactRecipients.All(compactCount);
+    SendRoomSlots(compactClients, compactCount, hostId);
+
+    // P2P 그룹에 새 클라이언트만 추가 (기존 멤버 간 연결은 유지)
+    JoinGameP2PGroup(hostId);
+}
+
+// 클라이언트 접속 종료 적용
+inline void GameWorld::ApplyLeave(int hostId) {
+    // 탱크 정보 제거
+    TankHandle handle = tanks.Find(hostId);
+    if (handle.IsValid() && UseInterestManagement()) {
+        interestVisibility.RemoveSlot(handle.slot);
+    }
+    tanks.Erase(hostId);
+    roomRecipients.Remove(hostId);
+    floatRecipients.Remove(hostId);
+    compactRecipients.Remove(hostId);
+    legacyRecipients.Remove(hostId);
+    deltaRecipients.Remove(hostId);
+    deltaClients.erase(hostId);
+    moveSequences.erase(hostId);
+    deadReckoningModels.erase(hostId);
+    auto backlog = sendBacklogs.find(hostId);
+    if (backlog != sendBacklogs.end()) {
+        SetSendBacklogLevel(backlog->second, SendBacklogLevel::Normal);
+        if (backlog->second.stale) {
+            staleCount--;
+        }
+        sendBacklogs.erase(backlog);
+    }
+    UpdateSnapshotClientCounts();
+    if (UseSpatialIndex()) {
+        spatialHash.Remove(hostId);
+    }
+    pendingBootstrap.erase(std::remove_if(pendingBootstrap.begin(), pendingBootstrap.end(),
+                                          [hostId](const PendingBootstrap& pending) { return pending.hostId == hostId; }),
+                           pendingBootstrap.end());
+
+    // 모든 클라이언트에게 플레이어 퇴장 알림
+    int recipientCount = 0;
+    int* recipients = roomRecipients.All(recipientCount);
+    if (recipientCount > 0) {
+        sink.OnPlayerLeft(recipients, recipientCount, hostId);
+    }
+
+    // P2P 그룹에서 떠난 클라이언트만 제거
+    LeaveGameP2PGroup(hostId);
+}
+
+// P2P 그룹에 참가자 추가
+// 기존에는 접속/퇴장마다 그룹을 파괴하고 다시 만들어 모든 P2P 연결이 재협상되었으므로,
+// 그룹은 두 번째 플레이어가 들어올 때 한 번만 만들고 이후에는 JoinP2PGroup으로 새 멤버만 추가합니다
+inline void GameWorld::JoinGameP2PGroup(int hostId) {
+    if (gameP2PGroupId == 0) {
+        // 아직 그룹이 없으면 2명 이상일 때 현재 인원으로 생성
+        if (tanks.Size() < 2) {
+            TANK_LOG_DEBUG(LogCategory::P2P, "Not enough clients to create P2P group (need at least 2)");
+            return;
+        }
+
+        int clientCount = 0;
+        int* clients = roomRecipients.All(clientCount);
+
+        gameP2PGroupId = sink.CreateP2PGroup(clients, clientCount);
+        TANK_LOG_INFO(LogCategory::P2P, "P2P group created with {} members, Group ID: {}", clientCount, gameP2PGroupId);
+
+        // 그룹에 들어간 모든 클라이언트에게 P2P 그룹 ID 알림
+        SendP2PGroupInfo(clients, clientCount);
+        return;
+    }
+
+    // 기존 그룹에 새 멤버만 추가 - 기존 멤버들은 새 멤버와의 연결만 맺음
+    if (sink.JoinP2PGroup(hostId, gameP2PGroupId)) {
+        TANK_LOG_INFO(LogCategory::P2P, "Client {} joined P2P group {}", hostId, gameP2PGroupId);
+
+        // 새로 참가한 클라이언트에게만 P2P 그룹 ID 알림
+        SendP2PGroupInfo(&hostId, 1);
+    } else {
+        TANK_LOG_WARN(LogCategory::P2P, "Failed to join client {} to P2P group {}", hostId, gameP2PGroupId);
+    }
+}
+
+// P2P 그룹에서 참가자 제거
+// 그룹은 비어도 유지되며 (m_allowEmptyP2PGroup), 남은 멤버들은 P2PMemberLeave 이벤트로 퇴장을 알게 됩니다
+inline void GameWorld::LeaveGameP2PGroup(int hostId) {
+    if (gameP2PGroupId == 0) {
+        return;
+    }
+
+    // 연결이 끊긴 클라이언트는 전송 계층이 이미 그룹에서 제거했을 수 있으므로 실패는 무시
+    sink.LeaveP2PGroup(hostId, gameP2PGroupId);
+    TANK_LOG_INFO(LogCategory::P2P, "Client {} left P2P group {}", hostId, gameP2PGroupId);
+}
+
+// P2P 그룹 ID를 지정한 클라이언트에게만 알림
+inline void GameWorld::SendP2PGroupInfo(const int* recipients, int recipientCount) {
+    if (recipientCount <= 0) {
+        return;
+    }
+
+    // P2PMessage에 그룹 ID 정보 전송
+    sink.P2PMessage(recipients, recipientCount, "P2P_GROUP_INFO:" + std::to_string(gameP2PGroupId));
+}
+
+// Hello를 보낸 접속자들에게 방 전체 상태 전송
+// 버퍼는 틱당 한 번만 만들어 같은 틱의 모든 접속자에게 멀티캐스트하며, 접속자 자신의 탱크도 포함됩니다 (클라이언트가 구분)
+// Hello 없이 helloWaitTicks가 지난 접속자는 OnWorldSnapshot을 모르는 이전 클라이언트로 보고 탱크별 RMI로 보냄
+inline void GameWorld::SendWorldSnapshot(uint32_t tickId) {
+    if (pendingBootstrap.empty()) {
+        return;
+    }
+
+    worldSnapshotRecipients.clear();
+    size_t waiting = 0;
+    for (const PendingBootstrap& pending : pendingBootstrap) {
+        if (HasSnapshotFormat(pending.hostId)) {
+            worldSnapshotRecipients.push_back(pending.hostId);
+        } else if (tickId - pending.joinTick >= helloWaitTicks) {
+            SendLegacyBootstrap(pending.hostId);
+        } else {
+            pendingBootstrap[waiting++] = pending;
+        }
+    }
+    pendingBootstrap.resize(waiting);
+    if (worldSnapshotRecipients.empty()) {
+        return;
+    }
+
+    worldSnapshotBuffer.resize(tanks.Size() * TankWorldEntrySize);
+    uint8_t* dst = worldSnapshotBuffer.data();
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        const TankPose& pose = tanks.PoseAt(i);
+        const TankStatus& status = tanks.StatusAt(i);
+        TankWorldEntry entry{ tanks.HostIdAt(i), pose.posX, pose.posY, pose.direction, status.tankType,
+                              status.currentHealth, status.maxHealth, status.isDestroyed ? TankWorldFlag_Destroyed : 0u };
+        WriteTankWorldEntry(dst, entry);
+        dst += TankWorldEntrySize;
+    }
+
+    TANK_LOG_DEBUG(LogCategory::Net, "Sending world snapshot ({} tanks, {} bytes) to {} new clients",
+                   tanks.Size(), worldSnapshotBuffer.size(), worldSnapshotRecipients.size());
+    sink.OnWorldSnapshot(worldSnapshotRecipients.data(), (int)worldSnapshotRecipients.size(), (int)tickId,
+                         worldSnapshotBuffer.data(), worldSnapshotBuffer.size());
+}
+
+// Hello 이전 클라이언트의 방 상태 - 기존 ApplyJoin처럼 다른 탱크마다 접속/체력 (파괴 상태면 파괴까지) 알림
+inline void GameWorld::SendLegacyBootstrap(int hostId) {
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        int clientId = tanks.HostIdAt(i);
+        if (clientId == hostId) {
+            continue;
+        }
+        const TankPose& pose = tanks.PoseAt(i);
+        const TankStatus& status = tanks.StatusAt(i);
+        sink.OnPlayerJoined(&hostId, 1, clientId, pose.posX, pose.posY, status.tankType);
+        sink.OnTankHealthUpdated(&hostId, 1, clientId, status.currentHealth, status.maxHealth);
+        if (status.isDestroyed) {
+            sink.OnTankDestroyed(&hostId, 1, clientId, 0);   // 파괴자 ID 정보가 없으므로 0(환경)으로 설정
+        }
+    }
+
+    legacyRecipients.Add(hostId);
+    UpdateSnapshotClientCounts();
+    TANK_LOG_INFO(LogCategory::Net, "Client {} sent no hello, using per-tank position updates", hostId);
+}
+
+// 틱마다 이번 틱 접속자에게 방 전체 상태를 보내고, 변경된 탱크 위치를 모아 한 번에 전송
+inline void GameWorld::BroadcastSnapshot(uint32_t tickId) {
+    lastTickId = tickId;
+    if (UseServerProjectiles()) {
+        StepProjectiles();
+    }
+    SendWorldSnapshot(tickId);
+    SendDeltaSnapshots(tickId);
+
+    // 비신뢰 전송에서 유실된 위치 복구 - 이번 틱은 모든 탱크를 변경된 것으로 보고 전송
+    bool refresh = positionRefreshTicks > 0 && tickId % positionRefreshTicks == 0;
+    if (refresh) {
+        for (size_t i = 0; i < tanks.Size(); i++) {
+            tanks.MarkPoseDirty(tanks.HandleAt(i));
+        }
+    }
+    if (deadReckoning.Enabled()) {
+        ApplyDeadReckoning(tickId, refresh);
+    }
+
+    if (UsePriorityScheduling()) {
+        BroadcastPrioritySnapshot(tickId);
+        return;
+    }
+    SendCoalescedPositions(tickId);
+
+    if (UseInterestManagement()) {
+        BroadcastInterestSnapshot(tickId);
+        return;
+    }
+
+    if (tanks.Empty()) {
+        return;
+    }
+
+    size_t changedCount = 0;
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        if (tanks.IsPoseDirtyAt(i)) {
+            changedCount++;
+        }
+    }
+    if (changedCount == 0) {
+        return;
+    }
+
+    // 변경된 탱크만 패킹 - 받을 클라이언트가 있는 형식만 만듦 (Hello 이전 클라이언트에게는 float 항목을 하나씩 보냄)
+    bool sendFloat = !floatRecipients.Empty();
+    bool sendLegacy = !legacyRecipients.Empty();
+    bool packFloat = sendFloat || sendLegacy;
+    bool packCompact = !compactRecipients.Empty();
+    snapshotBuffer.resize(packFloat ? changedCount * TankSnapshotEntrySize : 0);
+    compactBuffer.resize(packCompact ? changedCount * MaxCompactSnapshotEntrySize : 0);
+    uint8_t* dst = snapshotBuffer.data();
+    size_t compactSize = 0;
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        if (tanks.IsPoseDirtyAt(i)) {
+            const TankPose& pose = tanks.PoseAt(i);
+            if (packFloat) {
+                WriteTankSnapshotEntry(dst, TankSnapshotEntry{ tanks.HostIdAt(i), pose.posX, pose.posY, pose.direction });
+                dst += TankSnapshotEntrySize;
+            }
+            if (packCompact) {
+                compactSize += WriteCompactSnapshotEntry(compactBuffer.data() + compactSize,
+                    MakeCompactSnapshotEntry(tanks.SlotAt(i), pose.posX, pose.posY, pose.direction));
+            }
+            tanks.ClearPoseDirtyAt(i);
+        }
+    }
+
+    // 형식별로 모든 클라이언트에게 같은 스냅샷을 한 번의 RMI로 전송 (자기 탱크 항목은 클라이언트가 무시)
+    // 송신 대기열이 밀린 클라이언트는 빼고, 나중에 모은 위치를 받음
+    int recipientCount = 0;
+    if (sendFloat) {
+        int* recipients = ExcludeCongested(floatRecipients.All(recipientCount), recipientCount);
+        sink.OnTankSnapshot(recipients, recipientCount, (int)tickId, snapshotBuffer.data(), snapshotBuffer.size());
+        snapshotStats.Format(SnapshotFormat::Float).Record(snapshotBuffer.size(), recipientCount);
+    }
+    if (packCompact) {
+        int* recipients = ExcludeCongested(compactRecipients.All(recipientCount), recipientCount);
+        sink.OnTankSnapshotCompact(recipients, recipientCount, (int)tickId, compactBuffer.data(), compactSize);
+        snapshotStats.Format(SnapshotFormat::Compact).Record(compactSize, recipientCount);
+    }
+
+    // OnTankSnapshot을 모르는 이전 클라이언트에게는 기존 RMI로
+    if (sendLegacy) {
+        SendLegacyPositions(snapshotBuffer.data(), snapshotBuffer.size());
+    }
+}
+
+// Hello 이전 클라이언트들에게 바뀐 탱크 위치 전송 - 탱크마다 한 번 멀티캐스트 (SendMove마다 중계하던 기존 방식을 틱 단위로 모음)
+inline void GameWorld::SendLegacyPositions(const uint8_t* entries, size_t size) {
+    int count = 0;
+    int* recipients = ExcludeCongested(legacyRecipients.All(count), count);
+    legacyPositionRecipients.assign(recipients, recipients + count);
+    if (legacyPositionRecipients.empty()) {
+        return;
+    }
+
+    for (size_t offset = 0; offset + TankSnapshotEntrySize <= size; offset += TankSnapshotEntrySize) {
+        TankSnapshotEntry entry = ReadTankSnapshotEntry(entries + offset);
+
+        // 움직인 클라이언트는 끝으로 옮겨 빼고 보냄 (BroadcastGroup::AllExcept와 같은 방식)
+        int recipientCount = (int)legacyPositionRecipients.size();
+        auto self = std::find(legacyPositionRecipients.begin(), legacyPositionRecipients.end(), entry.clientId);
+        if (self != legacyPositionRecipients.end()) {
+            std::iter_swap(self, legacyPositionRecipients.end() - 1);
+            recipientCount--;
+        }
+        if (recipientCount > 0) {
+            sink.OnTankPositionUpdated(legacyPositionRecipients.data(), recipientCount, entry.clientId,
+                                       entry.posX, entry.posY, entry.direction);
+            snapshotStats.Format(SnapshotFormat::Legacy).Record(TankSnapshotEntrySize, recipientCount);
+        }
+    }
+}
+
+// 스냅샷 항목들을 Hello 이전 클라이언트 하나에게 전송
+inline void GameWorld::SendLegacyPositions(int hostId, const uint8_t* entries, size_t size) {
+    for (size_t offset = 0; offset + TankSnapshotEntrySize <= size; offset += TankSnapshotEntrySize) {
+        TankSnapshotEntry entry = ReadTankSnapshotEntry(entries + offset);
+        sink.OnTankPositionUpdated(&hostId, 1, entry.clientId, entry.posX, entry.posY, entry.direction);
+        snapshotStats.Format(SnapshotFormat::Legacy).Record(TankSnapshotEntrySize, 1);
+    }
+}
+
+// 델타 스냅샷 전송
+// 이번 틱 상태를 기록한 뒤 클라이언트를 마지막 ack 틱(기준)별로 묶어, 기준마다 델타를 한 번만 만들어 멀티캐스트합니다.
+// ack가 없거나 기준이 기록 범위를 벗어난 클라이언트는 전체 스냅샷 (baselineTickId = 0)을 받습니다
+inline void GameWorld::SendDeltaSnapshots(uint32_t tickId) {
+    if (deltaRecipients.Empty()) {
+        return;
+    }
+
+    std::vector<DeltaTankState>& current = deltaHistory.Begin(tickId);
+    current.reserve(tanks.Size());
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        current.push_back(MakeDeltaTankState(tanks.HostIdAt(i), tanks.PoseAt(i), tanks.StatusAt(i)));
+    }
+    std::sort(current.begin(), current.end(),
+              [](const DeltaTankState& a, const DeltaTankState& b) { return a.clientId < b.clientId; });
+
+    // 송신 대기열이 밀린 클라이언트는 차례가 올 때만 - ack 기준의 델타라 건너뛴 틱의 변경도 다음 델타에 합쳐짐
+    deltaBaselines.clear();
+    for (int hostId : deltaRecipients.Members()) {
+        if (!TakePositionTurn(hostId, tickId)) {
+            continue;
+        }
+        uint32_t ackedTick = deltaClients[hostId].ackedTick;
+        deltaBaselines.emplace_back(deltaHistory.Find(ackedTick) != nullptr ? ackedTick : 0u, hostId);
+    }
+    std::sort(deltaBaselines.begin(), deltaBaselines.end());
+
+    static const std::vector<DeltaTankState> EmptyBaseline;
+    for (size_t begin = 0; begin < deltaBaselines.size(); ) {
+        uint32_t baselineTick = deltaBaselines[begin].first;
+        deltaGroup.clear();
+        size_t end = begin;
+        for (; end < deltaBaselines.size() && deltaBaselines[end].first == baselineTick; end++) {
+            deltaGroup.push_back(deltaBaselines[end].second);
+        }
+        begin = end;
+
+        const std::vector<DeltaTankState>* baseline = deltaHistory.Find(baselineTick);
+        EncodeDeltaSnapshot(baseline != nullptr ? *baseline : EmptyBaseline, current, deltaBuffer);
+
+        // 기준 이후 바뀐 것이 없으면 기준 틱까지만 받은 (ack 이후 보낸 것이 없는) 클라이언트는 생략
+        // 기준 뒤의 틱을 이미 받은 클라이언트는 그 사이 값이 되돌아온 것일 수 있으므로 빈 델타라도 보내고,
+        // 기준이 기록 범위의 절반보다 오래되어도 보내 ack를 새 틱으로 옮김
+        if (baselineTick != 0 && deltaBuffer.empty() && tickId - baselineTick < DeltaSnapshotHistorySize / 2) {
+            deltaGroup.erase(std::remove_if(deltaGroup.begin(), deltaGroup.end(), [&](int hostId) {
+                return deltaClients[hostId].sentTick == baselineTick;
+            }), deltaGroup.end());
+            if (deltaGroup.empty()) {
+                continue;
+            }
+        }
+
+        for (int hostId : deltaGroup) {
+            deltaClients[hostId].sentTick = tickId;
+        }
+        int groupCount = (int)deltaGroup.size();
+        sink.OnTankDeltaSnapshot(deltaGroup.data(), groupCount, (int)tickId, (int)baselineTick,
+                                 deltaBuffer.data(), deltaBuffer.size());
+        snapshotStats.Format(SnapshotFormat::Delta).Record(deltaBuffer.size(), groupCount);
+        if (baselineTick == 0) {
+            snapshotStats.fullFallbacks.fetch_add((uint64_t)groupCount, std::memory_order_relaxed);
+        }
+    }
+}
+
+// 데드 레커닝 - 탱크마다 모델을 이번 틱까지 외삽해 실제 위치와 비교하고, 보낼 탱크만 변경 표시를 남김
+// 이동이 없던 탱크도 모델이 움직이고 있으면 오차가 커지므로 변경 표시와 관계없이 모든 탱크를 확인합니다
+inline void GameWorld::ApplyDeadReckoning(uint32_t tickId, bool refresh) {
+    uint64_t forwarded = 0;
+    uint64_t suppressed = 0;
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        const TankPose& pose = tanks.PoseAt(i);
+        auto inserted = deadReckoningModels.emplace(tanks.HostIdAt(i), DeadReckoningModel());
+        DeadReckoningModel& model = inserted.first->second;
+        if (inserted.second) {
+            // 처음 보내는 위치는 속도 없이 시작
+            model.pose = pose;
+            model.tickId = tickId;
+        } else if (refresh || NeedsDeadReckoningUpdate(model, pose, tickId, deadReckoning)) {
+            UpdateDeadReckoningModel(model, pose, tickId);
+        } else {
+            if (tanks.IsPoseDirtyAt(i)) {
+                tanks.ClearPoseDirtyAt(i);
+                suppressed++;
+            }
+            continue;
+        }
+        tanks.MarkPoseDirty(tanks.HandleAt(i));
+        forwarded++;
+    }
+    deadReckoningStats.forwarded.fetch_add(forwarded, std::memory_order_relaxed);
+    deadReckoningStats.suppressed.fetch_add(suppressed, std::memory_order_relaxed);
+}
+
+// 델타 스냅샷 ack 적용 - 더 최근 틱만 기준으로 삼음 (기록 범위를 벗어난 틱은 다음 전송 때 전체 스냅샷으로 대체)
+inline void GameWorld::ApplySnapshotAck(int remote, uint32_t tickId) {
+    auto it = deltaClients.find(remote);
+    if (it == deltaClients.end() || tickId <= it->second.ackedTick || tickId > it->second.sentTick) {
+        return;
+    }
+    it->second.ackedTick = tickId;
+}
+
+// 형식별 클라이언트 수 게이지 갱신
+inline void GameWorld::UpdateSnapshotClientCounts() {
+    snapshotStats.Format(SnapshotFormat::Float).clients.store((int)floatRecipients.Count(), std::memory_order_relaxed);
+    snapshotStats.Format(SnapshotFormat::Compact).clients.store((int)compactRecipients.Count(), std::memory_order_relaxed);
+    snapshotStats.Format(SnapshotFormat::Delta).clients.store((int)deltaRecipients.Count(), std::memory_order_relaxed);
+    snapshotStats.Format(SnapshotFormat::Legacy).clients.store((int)legacyRecipients.Count(), std::memory_order_relaxed);
+}
+
+// float 스냅샷 항목들을 압축 항목으로 변환 (슬롯은 레지스트리에서 조회)
+inline void GameWorld::ConvertToCompactSnapshot(const std::vector<uint8_t>& entries) {
+    size_t count = TankSnapshotEntryCount(entries.size());
+    compactBuffer.resize(count * MaxCompactSnapshotEntrySize);
+    size_t compactSize = 0;
+    for (size_t i = 0; i < count; i++) {
+        TankSnapshotEntry entry = ReadTankSnapshotEntry(entries.data() + i * TankSnapshotEntrySize);
+        TankHandle handle = tanks.Find(entry.clientId);
+        if (handle.IsValid()) {
+            compactSize += WriteCompactSnapshotEntry(compactBuffer.data() + compactSize,
+                MakeCompactSnapshotEntry(handle.slot, entry.posX, entry.posY, entry.direction));
+        }
+    }
+    compactBuffer.resize(compactSize);
+}
+
+// 슬롯 표 전송 (압축 스냅샷은 HostID 대신 슬롯을 쓰므로 클라이언트가 슬롯 -> HostID 표를 유지)
+inline void GameWorld::SendRoomSlots(const int* recipients, int recipientCount, int hostId) {
+    if (recipientCount <= 0) {
+        return;
+    }
+
+    compactBuffer.resize(tanks.Size() * MaxRoomSlotEntrySize);
+    size_t size = 0;
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        if (hostId == 0 || tanks.HostIdAt(i) == hostId) {
+            size += WriteRoomSlotEntry(compactBuffer.data() + size, tanks.SlotAt(i), tanks.HostIdAt(i));
+        }
+    }
+    sink.OnRoomSlots(recipients, recipientCount, compactBuffer.data(), size);
+}
+
+// 관찰자별 우선순위 스냅샷 전송
+// 이번 틱에 바뀐 탱크를 스케줄러에 기록한 뒤, 관찰자마다 아직 받지 못한 변경이 있는 탱크에 거리 가중치를 누적하고
+// 누적 값이 큰 탱크를 budget개까지 골라 관찰자의 형식(float/압축)으로 한 번에 보냅니다.
+// 관심 영역 반경을 함께 쓰면 반경 밖 탱크는 보내지 않습니다
+inline void GameWorld::BroadcastPrioritySnapshot(uint32_t tickId) {
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        if (tanks.IsPoseDirtyAt(i)) {
+            priorityScheduler.MarkChanged(tanks.SlotAt(i), tickId);
+            tanks.ClearPoseDirtyAt(i);
+        }
+    }
+
+    float radiusSquared = UseInterestManagement() ? interestRadius * interestRadius : 0.0f;
+    for (size_t observer = 0; observer < tanks.Size(); observer++) {
+        int observerId = tanks.HostIdAt(observer);
+        bool compact = compactRecipients.Contains(observerId);
+        bool legacy = legacyRecipients.Contains(observerId);
+        if (!compact && !legacy && !floatRecipients.Contains(observerId)) {
+            continue;   // 방 상태를 기다리는 접속자 - 보낸 버전이 없으므로 방 상태를 받은 뒤 밀린 변경을 받음
+        }
+        if (!TakePositionTurn(observerId, tickId)) {
+            continue;   // 누적 값과 보낸 버전이 그대로라 차례가 오면 밀린 변경을 최신 위치로 받음
+        }
+        const TankPose& observerPose = tanks.PoseAt(observer);
+        priorityScheduler.BeginObserver(tanks.SlotAt(observer));
+        for (size_t target = 0; target < tanks.Size(); target++) {
+            uint32_t targetSlot = tanks.SlotAt(target);
+            if (target == observer || !priorityScheduler.HasPending(targetSlot)) {
+                continue;
+            }
+            const TankPose& pose = tanks.PoseAt(target);
+            float dx = pose.posX - observerPose.posX;
+            float dy = pose.posY - observerPose.posY;
+            float distanceSquared = dx * dx + dy * dy;
+            if (radiusSquared > 0.0f && distanceSquared > radiusSquared) {
+                continue;
+            }
+            priorityScheduler.Accumulate(targetSlot, priorityScheduler.Weight(targetSlot, distanceSquared, tickId), (uint32_t)target);
+        }
+
+        priorityBuffer.resize((size_t)priorityScheduler.Config().budget
+                              * std::max(TankSnapshotEntrySize, MaxCompactSnapshotEntrySize));
+        size_t size = 0;
+        size_t count = priorityScheduler.Select([&](uint32_t target) {
+            const TankPose& pose = tanks.PoseAt(target);
+            if (compact) {
+                size += WriteCompactSnapshotEntry(priorityBuffer.data() + size,
+                    MakeCompactSnapshotEntry(tanks.SlotAt(target), pose.posX, pose.posY, pose.direction));
+            } else {
+                WriteTankSnapshotEntry(priorityBuffer.data() + size,
+                                       TankSnapshotEntry{ tanks.HostIdAt(target), pose.posX, pose.posY, pose.direction });
+                size += TankSnapshotEntrySize;
+            }
+        });
+        if (count == 0) {
+            continue;
+        }
+
+        if (compact) {
+            sink.OnTankSnapshotCompact(&observerId, 1, (int)tickId, priorityBuffer.data(), size);
+            snapshotStats.Format(SnapshotFormat::Compact).Record(size, 1);
+        } else if (legacy) {
+            SendLegacyPositions(observerId, priorityBuffer.data(), size);
+        } else {
+            sink.OnTankSnapshot(&observerId, 1, (int)tickId, priorityBuffer.data(), size);
+            snapshotStats.Format(SnapshotFormat::Float).Record(size, 1);
+        }
+    }
+}
+
+// 관심 영역 사용 시 수신자별 스냅샷 전송
+// 관찰자마다 공간 해시로 이번 틱에 보이는 탱크를 구해 지난 틱에 보이던 탱크와 비교합니다 (InterestVisibility)
+//  - 새로 들어온 탱크는 변경이 없어도 현재 위치를, 계속 보이는 탱크는 변경된 경우에만 위치를 보냄
+//  - 범위를 벗어난 탱크는 OnTanksOutOfRange로 알림 (Hello를 보낸 클라이언트만)
+inline void GameWorld::BroadcastInterestSnapshot(uint32_t tickId) {
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        int viewerId = tanks.HostIdAt(i);
+        bool legacy = legacyRecipients.Contains(viewerId);
+        if (!legacy && !HasSnapshotFormat(viewerId)) {
+            continue;   // 방 상태를 기다리는 접속자 - 받은 뒤 첫 비교에서 방 전체가 보이던 것으로 시작
+        }
+
+        interestVisibility.BeginObserver(tanks.HandleAt(i).slot, [&](auto mark) {
+            for (size_t j = 0; j < tanks.Size(); j++) {
+                mark(tanks.HandleAt(j).slot);
+            }
+        });
+
+        const TankPose& viewer = tanks.PoseAt(i);
+        snapshotBuffer.clear();
+        spatialHash.QueryRadius(viewer.posX, viewer.posY, interestRadius, [&](int id) {
+            if (id == viewerId) {
+                return;
+            }
+            TankHandle handle = tanks.Find(id);
+            if (!interestVisibility.Enter(handle.slot) && !tanks.IsPoseDirty(handle)) {
+                return;
+            }
+            const TankPose& pose = tanks.Pose(handle);
+            size_t offset = snapshotBuffer.size();
+            snapshotBuffer.resize(offset + TankSnapshotEntrySize);
+            WriteTankSnapshotEntry(snapshotBuffer.data() + offset, TankSnapshotEntry{ id, pose.posX, pose.posY, pose.direction });
+        });
+
+        outOfRangeBuffer.clear();
+        interestVisibility.ForEachLeft([&](uint32_t slot) {
+            size_t offset = outOfRangeBuffer.size();
+            outOfRangeBuffer.resize(offset + TankOutOfRangeEntrySize);
+            WriteTankOutOfRangeEntry(outOfRangeBuffer.data() + offset, tanks.HostIdOf(TankHandle{ slot, 0 }));
+        });
+        if (snapshotBuffer.empty() && outOfRangeBuffer.empty()) {
+            interestVisibility.Commit();
+            continue;
+        }
+        // 보이던 탱크는 그대로 두어 정상으로 돌아온 틱에 들어온/나간 탱크를 다시 계산
+        if (SendBacklogState* backlog = FindCongested(viewerId)) {
+            MarkPositionsSkipped(*backlog);
+            continue;
+        }
+        interestVisibility.Commit();
+
+        if (!snapshotBuffer.empty()) {
+            if (compactRecipients.Contains(viewerId)) {
+                ConvertToCompactSnapshot(snapshotBuffer);
+                sink.OnTankSnapshotCompact(&viewerId, 1, (int)tickId, compactBuffer.data(), compactBuffer.size());
+                snapshotStats.Format(SnapshotFormat::Compact).Record(compactBuffer.size(), 1);
+            } else if (legacy) {
+                SendLegacyPositions(viewerId, snapshotBuffer.data(), snapshotBuffer.size());
+            } else {
+                sink.OnTankSnapshot(&viewerId, 1, (int)tickId, snapshotBuffer.data(), snapshotBuffer.size());
+                snapshotStats.Format(SnapshotFormat::Float).Record(snapshotBuffer.size(), 1);
+            }
+        }
+        if (!outOfRangeBuffer.empty() && !legacy) {
+            sink.OnTanksOutOfRange(&viewerId, 1, (int)tickId, outOfRangeBuffer.data(), outOfRangeBuffer.size());
+        }
+    }
+
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        tanks.ClearPoseDirtyAt(i);
+    }
+}
+
+// (x, y) 위치의 이벤트를 받아야 하는 클라이언트 배열 (exclude 제외, 멀티캐스트 호출에 그대로 사용)
+inline int* GameWorld::CollectInterestedClients(float x, float y, int exclude, int& count) {
+    // 관심 영역을 쓰지 않으면 방 전체 수신자 배열을 복사 없이 사용
+    if (!UseInterestManagement()) {
+        return roomRecipients.AllExcept(exclude, count);
+    }
+
+    eventRecipients.clear();
+    spatialHash.QueryRadius(x, y, interestRadius, [&](int id) {
+        if (id != exclude) {
+            eventRecipients.push_back(id);
+        }
+    });
+    count = (int)eventRecipients.size();
+    return eventRecipients.data();
+}
+
+// 클라이언트의 송신 대기열 크기 반영 - 상태를 바꾸고, 연결을 끊어야 하는지 판단
+inline bool GameWorld::UpdateSendQueue(int hostId, uint32_t queuedBytes) {
+    auto it = sendBacklogs.find(hostId);
+    if (it == sendBacklogs.end()) {
+        return false;
+    }
+    SendBacklogState& state = it->second;
+    state.queuedBytes = queuedBytes;
+    if (!sendBacklog.Enabled() || state.closeRequested) {
+        return false;
+    }
+
+    SendBacklogLevel next = NextSendBacklogLevel(state.level, queuedBytes, sendBacklog);
+    if (next != state.level) {
+        TANK_LOG_INFO(LogCategory::Net, "Client {} send queue {} bytes: {} -> {}", hostId, queuedBytes,
+                      SendBacklogLevelName(state.level), SendBacklogLevelName(next));
+        if (state.level == SendBacklogLevel::Normal) {
+            // 첫 모은 위치는 coalesceTicks 뒤에
+            state.lastSentTick = lastTickId;
+        }
+        SetSendBacklogLevel(state, next);
+    }
+    state.droppingTicks = next == SendBacklogLevel::Dropping ? state.droppingTicks + 1 : 0;
+
+    bool overLimit = sendBacklog.disconnectBytes > 0 && queuedBytes >= sendBacklog.disconnectBytes;
+    bool stalled = sendBacklog.dropTimeoutTicks > 0 && state.droppingTicks >= sendBacklog.dropTimeoutTicks;
+    if (!overLimit && !stalled) {
+        return false;
+    }
+    TANK_LOG_WARN(LogCategory::Net, "Disconnecting client {}: send queue {} bytes{}", hostId, queuedBytes,
+                  overLimit ? " over the limit" : ", not draining");
+    state.closeRequested = true;
+    sendBacklogStats.disconnects.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// 대기열 상태 변경과 상태별 클라이언트 수 갱신
+inline void GameWorld::SetSendBacklogLevel(SendBacklogState& state, SendBacklogLevel level) {
+    if (state.level == level) {
+        return;
+    }
+    congestedCount += (level != SendBacklogLevel::Normal ? 1 : 0) - (state.level != SendBacklogLevel::Normal ? 1 : 0);
+    droppingCount += (level == SendBacklogLevel::Dropping ? 1 : 0) - (state.level == SendBacklogLevel::Dropping ? 1 : 0);
+    state.level = level;
+    sendBacklogStats.coalescingClients.store(congestedCount - droppingCount, std::memory_order_relaxed);
+    sendBacklogStats.droppingClients.store(droppingCount, std::memory_order_relaxed);
+}
+
+// 정상 상태가 아닌 클라이언트를 뺀 위치 스냅샷 수신자 배열 (뺀 클라이언트는 모은 위치를 기다림)
+inline int* GameWorld::ExcludeCongested(int* recipients, int& count) {
+    if (congestedCount == 0) {
+        return recipients;
+    }
+
+    positionRecipients.clear();
+    for (int i = 0; i < count; i++) {
+        if (SendBacklogState* backlog = FindCongested(recipients[i])) {
+            MarkPositionsSkipped(*backlog);
+        } else {
+            positionRecipients.push_back(recipients[i]);
+        }
+    }
+    count = (int)positionRecipients.size();
+    return positionRecipients.data();
+}
+
+// 버리는 상태인 클라이언트를 뺀 총알 수신자 배열
+inline int* GameWorld::ExcludeDropping(int* recipients, int& count) {
+    if (droppingCount == 0) {
+        return recipients;
+    }
+
+    positionRecipients.clear();
+    for (int i = 0; i < count; i++) {
+        SendBacklogState* backlog = FindCongested(recipients[i]);
+        if (backlog == nullptr || backlog->level != SendBacklogLevel::Dropping) {
+            positionRecipients.push_back(recipients[i]);
+        }
+    }
+    sendBacklogStats.droppedBullets.fetch_add((uint64_t)count - positionRecipients.size(), std::memory_order_relaxed);
+    count = (int)positionRecipients.size();
+    return positionRecipients.data();
+}
+
+// 이번 틱에 위치를 보낼 차례인지 - 델타/우선순위 스냅샷은 받은 것을 기준으로 다음 내용을 만들므로 건너뛰기만 하면 됨
+inline bool GameWorld::TakePositionTurn(int hostId, uint32_t tickId) {
+    SendBacklogState* backlog = FindCongested(hostId);
+    if (backlog == nullptr) {
+        return true;
+    }
+    if (!SendBacklogDue(*backlog, tickId, sendBacklog)) {
+        sendBacklogStats.skipped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    backlog->lastSentTick = tickId;
+    sendBacklogStats.coalesced.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// 모은 위치 전송 - float/압축 스냅샷은 바뀐 탱크만 담으므로, 건너뛴 스냅샷이 있는 클라이언트에게는
+// 모든 탱크의 현재 위치(관심 영역을 쓰면 반경 안)를 그 클라이언트의 형식으로 한 번에 보냄
+inline void GameWorld::SendCoalescedPositions(uint32_t tickId) {
+    if (staleCount == 0) {
+        return;
+    }
+
+    float radiusSquared = UseInterestManagement() ? interestRadius * interestRadius : 0.0f;
+    for (auto& pair : sendBacklogs) {
+        SendBacklogState& state = pair.second;
+        if (!state.stale || !SendBacklogDue(state, tickId, sendBacklog)) {
+            continue;
+        }
+        state.stale = false;
+        staleCount--;
+        state.lastSentTick = tickId;
+
+        int hostId = pair.first;
+        const TankPose& viewer = tanks.Pose(tanks.Find(hostId));
+        bool compact = compactRecipients.Contains(hostId);
+        coalescedBuffer.resize(tanks.Size() * std::max(TankSnapshotEntrySize, MaxCompactSnapshotEntrySize));
+        size_t size = 0;
+        for (size_t i = 0; i < tanks.Size(); i++) {
+            const TankPose& pose = tanks.PoseAt(i);
+            float dx = pose.posX - viewer.posX;
+            float dy = pose.posY - viewer.posY;
+            if (tanks.HostIdAt(i) == hostId || (radiusSquared > 0.0f && dx * dx + dy * dy > radiusSquared)) {
+                continue;
+            }
+            if (compact) {
+                size += WriteCompactSnapshotEntry(coalescedBuffer.data() + size,
+                    MakeCompactSnapshotEntry(tanks.SlotAt(i), pose.posX, pose.posY, pose.direction));
+            } else {
+                WriteTankSnapshotEntry(coalescedBuffer.data() + size,
+                                       TankSnapshotEntry{ tanks.HostIdAt(i), pose.posX, pose.posY, pose.direction });
+                size += TankSnapshotEntrySize;
+            }
+        }
+        sendBacklogStats.coalesced.fetch_add(1, std::memory_order_relaxed);
+        if (size == 0) {
+            continue;
+        }
+
+        if (compact) {
+            sink.OnTankSnapshotCompact(&hostId, 1, (int)tickId, coalescedBuffer.data(), size);
+            snapshotStats.Format(SnapshotFormat::Compact).Record(size, 1);
+        } else if (legacyRecipients.Contains(hostId)) {
+            SendLegacyPositions(hostId, coalescedBuffer.data(), size);
+        } else {
+            sink.OnTankSnapshot(&hostId, 1, (int)tickId, coalescedBuffer.data(), size);
+            snapshotStats.Format(SnapshotFormat::Float).Record(size, 1);
+        }
+    }
+}
+
+// 위치 이동 적용
+inline void GameWorld::ApplyMove(int remote, const SimPoseArgs& args) {
+    TANK_LOG_DEBUG(LogCategory::Move, "SendMove from client {}: pos=({},{}), direction={}", remote, args.posX, args.posY, args.direction);
+
+    // 탱크 정보 업데이트
+    TankHandle handle = tanks.Find(remote);
+    if (handle.IsValid()) {
+        TankPose& pose = tanks.Pose(handle);
+
+        // 압축 범위 밖의 위치는 압축/델타 스냅샷에서 가장자리로 고정되므로 세고, 범위를 벗어나는 이동에서 한 번 경고
+        if (!CompactPositionInRange(args.posX, args.posY)) {
+            compactOutOfRangeMoves.fetch_add(1, std::memory_order_relaxed);
+            if (CompactPositionInRange(pose.posX, pose.posY)) {
+                TANK_LOG_WARN(LogCategory::Move, "Client {} moved outside the compact position range: pos=({},{}), "
+                              "compact snapshots clamp it to the edge", remote, args.posX, args.posY);
+            }
+        }
+
+        pose.posX = args.posX;
+        pose.posY = args.posY;
+        pose.direction = args.direction;
+
+        // 최신 위치만 기록하고, 다른 클라이언트에게는 다음 틱 스냅샷으로 전송
+        tanks.MarkPoseDirty(handle);
+        UpdateSpatialHash(remote, args.posX, args.posY);
+        RecordPoseHistory(handle, args.posX, args.posY, false);
+    }
+}
+
+// 순서 번호가 붙은 이동 적용 - 비신뢰 전송은 순서가 바뀌어 도착할 수 있으므로 마지막 적용 값보다 새로운 것만 적용
+// 순서 번호는 16비트로 순환하므로 차이를 부호 있는 값으로 비교 (3만 번 이상 건너뛴 이동은 오래된 것으로 봄)
+inline void GameWorld::ApplySequencedMove(int remote, const SimSequencedMoveArgs& args) {
+    if (!tanks.Contains(remote)) {
+        return;
+    }
+
+    auto it = moveSequences.find(remote);
+    if (it != moveSequences.end()) {
+        if ((int16_t)(uint16_t)(args.sequence - it->second) <= 0) {
+            outOfOrderMoves.fetch_add(1, std::memory_order_relaxed);
+            TANK_LOG_DEBUG(LogCategory::Move, "Dropped out-of-order move from client {}: sequence {} after {}",
+                           remote, args.sequence, it->second);
+            return;
+        }
+        it->second = args.sequence;
+    } else {
+        moveSequences.emplace(remote, args.sequence);
+    }
+
+    ApplyMove(remote, args.pose);
+}
+
+// 발사 적용
+inline void GameWorld::ApplyFire(int remote, const SimFireArgs& args) {
+    TANK_LOG_DEBUG(LogCategory::Fire, "========== SendFire Received ==========");
+    TANK_LOG_DEBUG(LogCategory::Fire, "From client {}: shooterId={}, direction={}, launchForce={}",
+                   remote, args.shooterId, args.direction, args.launchForce);
+    TANK_LOG_DEBUG(LogCategory::Fire, "Fire position: ({}, {}, {})", args.fireX, args.fireY, args.fireZ);
+
+    // 해당 클라이언트의 탱크 정보 가져오기
+    TankHandle handle = tanks.Find(remote);
+    if (handle.IsValid()) {
+        const TankPose& tank = tanks.Pose(handle);
+        if (UsePriorityScheduling()) {
+            priorityScheduler.MarkFired(handle.slot, lastTickId);
+        }
+        TANK_LOG_DEBUG(LogCategory::Fire, "Tank found: Position=({},{}), Direction={}", tank.posX, tank.posY, tank.direction);
+
+        // 발사 위치를 관심 영역에 두는 클라이언트에게 총알 발사 정보 전송 (발사한 클라이언트 제외)
+        int recipientCount = 0;
+        int* recipients = CollectInterestedClients(tank.posX, tank.posY, remote, recipientCount);
+        recipients = ExcludeDropping(recipients, recipientCount);
+        if (recipientCount > 0) {
+            sink.OnSpawnBullet(recipients, recipientCount, remote, args.shooterId,
+                               tank.posX, tank.posY, args.direction,
+                               args.launchForce, args.fireX, args.fireY, args.fireZ);
+        }
+        TANK_LOG_DEBUG(LogCategory::Fire, "OnSpawnBullet sent to {} clients", recipientCount);
+
+        // 서버 판정 포탄은 클라이언트가 보낸 발사 위치 대신 서버의 탱크 위치에서 출발 (파괴된 탱크는 쏘지 못함)
+        if (UseServerProjectiles() && !tanks.Status(handle).isDestroyed
+            && projectiles.Spawn(remote, tank.posX, tank.posY, args.fireY, args.direction, args.launchForce)
+            && UseLagCompensation()) {
+            RewindNewestProjectile(handle.slot);
+        }
+    } else {
+        TANK_LOG_WARN(LogCategory::Fire, "Error: Tank not found for client {}", remote);
+    }
+    TANK_LOG_DEBUG(LogCategory::Fire, "========== SendFire Processing Completed ==========");
+}
+
+// 포탄 한 틱 진행
+inline void GameWorld::StepProjectiles() {
+    if (projectiles.Count() == 0) {
+        return;
+    }
+
+    // 파괴되지 않은 탱크만 충돌 대상
+    projectileTargets.Clear();
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        if (!tanks.StatusAt(i).isDestroyed) {
+            const TankPose& pose = tanks.PoseAt(i);
+            projectileTargets.Add(tanks.HostIdAt(i), pose.posX, pose.posY);
+        }
+    }
+    projectileTargets.Pad();
+
+    projectileHits.clear();
+    projectiles.Step(projectileTargets, projectileHits);
+    for (const ProjectileHit& hit : projectileHits) {
+        ApplyProjectileHit(hit);
+    }
+}
+
+// 지연 보상 - 쏜 클라이언트는 RTT만큼 지난 위치를 보고 쐈으므로, 포탄을 그 시각에 만든 것으로 보고
+// 틱 간격마다 모든 탱크를 그 시각으로 되감아 판정하며 발사를 받은 시각까지 따라잡음 (이후는 다른 포탄과 같이 현재 위치로 판정)
+inline void GameWorld::RewindNewestProjectile(uint32_t shooterSlot) {
+    int64_t tickNs = (int64_t)((double)projectiles.Config().tickSeconds * 1e9);
+    int64_t rewindNs = poseHistory.RewindNs(shooterSlot);
+    int steps = (int)((rewindNs + tickNs / 2) / tickNs);
+    if (steps <= 0) {
+        return;
+    }
+    LagCompensationStats& stats = poseHistory.Stats();
+    stats.rewoundShots.fetch_add(1, std::memory_order_relaxed);
+    stats.rewindNs.fetch_add((uint64_t)rewindNs, std::memory_order_relaxed);
+
+    uint64_t rewound = 0;
+    uint64_t clamped = 0;
+    for (int step = steps - 1; step >= 0; step--) {
+        int64_t timeNs = commandNs - step * tickNs;
+        projectileTargets.Clear();
+        for (size_t i = 0; i < tanks.Size(); i++) {
+            if (tanks.StatusAt(i).isDestroyed) {
+                continue;
+            }
+            const TankPose& pose = tanks.PoseAt(i);
+            float x = pose.posX;
+            float z = pose.posY;
+            clamped += poseHistory.Sample(tanks.SlotAt(i), timeNs, x, z) ? 0 : 1;
+            projectileTargets.Add(tanks.HostIdAt(i), x, z);
+        }
+        projectileTargets.Pad();
+        rewound += projectileTargets.count;
+
+        projectileHits.clear();
+        bool flying = projectiles.StepNewest(projectileTargets, projectileHits);
+        for (const ProjectileHit& hit : projectileHits) {
+            stats.rewindHits.fetch_add(1, std::memory_order_relaxed);
+            ApplyProjectileHit(hit);
+        }
+        if (!flying) {
+            break;
+        }
+    }
+    stats.rewoundTargets.fetch_add(rewound, std::memory_order_relaxed);
+    stats.clampedTargets.fetch_add(clamped, std::memory_order_relaxed);
+}
+
+// 위치 기록 (지연 보상을 쓸 때만)
+inline void GameWorld::RecordPoseHistory(TankHandle handle, float posX, float posY, bool teleport) {
+    if (!UseLagCompensation()) {
+        return;
+    }
+    if (teleport) {
+        poseHistory.ResetSlot(handle.slot);
+    }
+    poseHistory.Record(handle.slot, commandNs, posX, posY);
+}
+
+// 포탄 명중 적용 - 방 전체에 체력을 알리고, 체력이 0이 되면 쏜 탱크를 파괴자로 알림
+inline void GameWorld::ApplyProjectileHit(const ProjectileHit& hit) {
+    TankHandle handle = tanks.Find(hit.targetId);
+    if (!handle.IsValid()) {
+        return;
+    }
+    TankStatus& status = tanks.Status(handle);
+    if (status.isDestroyed) {
+        return;   // 같은 틱에 앞선 포탄으로 이미 파괴됨
+    }
+
+    status.currentHealth = std::max(0.0f, status.currentHealth - projectiles.Config().hitDamage);
+    status.isDestroyed = status.currentHealth <= 0;
+    TANK_LOG_DEBUG(LogCategory::Combat, "Tank {} hit by tank {}: {}/{}", hit.targetId, hit.shooterId,
+                   status.currentHealth, status.maxHealth);
+
+    int recipientCount = 0;
+    int* recipients = roomRecipients.All(recipientCount);
+    if (recipientCount > 0) {
+        sink.OnTankHealthUpdated(recipients, recipientCount, hit.targetId, status.currentHealth, status.maxHealth);
+    }
+    if (status.isDestroyed) {
+        projectiles.Stats().kills.fetch_add(1, std::memory_order_relaxed);
+        TANK_LOG_INFO(LogCategory::Combat, "Tank destroyed for client {}: by tank {}", hit.targetId, hit.shooterId);
+        if (recipientCount > 0) {
+            sink.OnTankDestroyed(recipients, recipientCount, hit.targetId, hit.shooterId);
+        }
+    }
+}
+
+// 탱크 타입 적용
+inline void GameWorld::ApplyTankType(int remote, int tankType) {
+    TANK_LOG_DEBUG(LogCategory::Combat, "========== SendTankType Received ==========");
+    TANK_LOG_DEBUG(LogCategory::Combat, "From client {}: tankType={}", remote, tankType);
+
+    // 해당 클라이언트의 탱크 정보 업데이트
+    TankHandle handle = tanks.Find(remote);
+    if (handle.IsValid()) {
+        tanks.Status(handle).tankType = tankType;
+        const TankPose& pose = tanks.Pose(handle);
+
+        // 모든 다른 클라이언트에게 이 클라이언트의 탱크 타입 알림 (OnPlayerJoined 메시지로 전송)
+        int recipientCount = 0;
+        int* recipients = roomRecipients.AllExcept(remote, recipientCount);
+        if (recipientCount > 0) {
+            sink.OnPlayerJoined(recipients, recipientCount, remote, pose.posX, pose.posY, tankType);
+        }
+    } else {
+        TANK_LOG_WARN(LogCategory::Combat, "Error: Tank not found for client {}", remote);
+    }
+    TANK_LOG_DEBUG(LogCategory::Combat, "========== SendTankType Processing Completed ==========");
+}
+
+// 체력 업데이트 적용
+inline void GameWorld::ApplyHealthUpdated(int remote, const SimHealthArgs& args) {
+    TANK_LOG_DEBUG(LogCategory::Combat, "========== SendTankHealthUpdated Received ==========");
+    TANK_LOG_DEBUG(LogCategory::Combat, "From client {}: currentHealth={}, maxHealth={}", remote, args.currentHealth, args.maxHealth);
+
+    // 서버 판정 중에는 체력을 서버만 바꿈
+    if (UseServerProjectiles()) {
+        projectiles.Stats().ignoredReports.fetch_add(1, std::memory_order_relaxed);
+        TANK_LOG_DEBUG(LogCategory::Combat, "Health report from client {} ignored (server-authoritative hits)", remote);
+        return;
+    }
+
+    // 해당 클라이언트의 탱크 정보 업데이트
+    TankHandle handle = tanks.Find(remote);
+    if (handle.IsValid()) {
+        TankStatus& status = tanks.Status(handle);
+        status.currentHealth = args.currentHealth;
+        status.maxHealth = args.maxHealth;
+        status.isDestroyed = (args.currentHealth <= 0);
+
+        TANK_LOG_DEBUG(LogCategory::Combat, "Tank health updated for client {}: {}/{}", remote, args.currentHealth, args.maxHealth);
+
+        // 모든 다른 클라이언트에게 이 클라이언트의 체력 정보 전송
+        int recipientCount = 0;
+        int* recipients = roomRecipients.AllExcept(remote, recipientCount);
+        if (recipientCount > 0) {
+            sink.OnTankHealthUpdated(recipients, recipientCount, remote, args.currentHealth, args.maxHealth);
+        }
+    } else {
+        TANK_LOG_WARN(LogCategory::Combat, "Error: Tank not found for client {}", remote);
+    }
+    TANK_LOG_DEBUG(LogCategory::Combat, "========== SendTankHealthUpdated Processing Completed ==========");
+}
+
+// 탱크 파괴 적용
+inline void GameWorld::ApplyDestroyed(int remote, int destroyedById) {
+    TANK_LOG_DEBUG(LogCategory::Combat, "========== SendTankDestroyed Received ==========");
+    TANK_LOG_DEBUG(LogCategory::Combat, "From client {}: destroyedById={}", remote, destroyedById);
+
+    // 서버 판정 중에는 파괴도 서버가 명중으로만 판정
+    if (UseServerProjectiles()) {
+        projectiles.Stats().ignoredReports.fetch_add(1, std::memory_order_relaxed);
+        TANK_LOG_DEBUG(LogCategory::Combat, "Destroy report from client {} ignored (server-authoritative hits)", remote);
+        return;
+    }
+
+    // 해당 클라이언트의 탱크 정보 업데이트
+    TankHandle handle = tanks.Find(remote);
+    if (handle.IsValid()) {
+        TankStatus& status = tanks.Status(handle);
+        status.isDestroyed = true;
+        status.currentHealth = 0;
+
+        if (destroyedById > 0) {
+            TANK_LOG_INFO(LogCategory::Combat, "Tank destroyed for client {}: by tank {}", remote, destroyedById);
+        } else {
+            TANK_LOG_INFO(LogCategory::Combat, "Tank destroyed for client {}: by environment", remote);
+        }
+
+        // 모든 다른 클라이언트에게 이 클라이언트의 파괴 정보 전송
+        int recipientCount = 0;
+        int* recipients = roomRecipients.AllExcept(remote, recipientCount);
+        if (recipientCount > 0) {
+            sink.OnTankDestroyed(recipients, recipientCount, remote, destroyedById);
+        }
+    } else {
+        TANK_LOG_WARN(LogCategory::Combat, "Error: Tank not found for client {}", remote);
+    }
+    TANK_LOG_DEBUG(LogCategory::Combat, "========== SendTankDestroyed Processing Completed ==========");
+}
+
+// 탱크 생성/리스폰 적용
+inline void GameWorld::ApplySpawned(int remote, const SimSpawnArgs& args) {
+    TANK_LOG_DEBUG(LogCategory::Combat, "========== SendTankSpawned Received ==========");
+    TANK_LOG_DEBUG(LogCategory::Combat, "From client {}: position=({},{}), direction={}, tankType={}, health={}",
+                   remote, args.posX, args.posY, args.direction, args.tankType, args.initialHealth);
+
+    // 해당 클라이언트의 탱크 정보 업데이트
+    TankHandle handle = tanks.Find(remote);
+    if (handle.IsValid()) {
+        TankPose& pose = tanks.Pose(handle);
+        pose.posX = args.posX;
+        pose.posY = args.posY;
+        pose.direction = args.direction;
+
+        TankStatus& status = tanks.Status(handle);
+        status.tankType = args.tankType;
+        status.currentHealth = args.initialHealth;
+        status.maxHealth = args.initialHealth; // 최대 체력도 업데이트
+        status.isDestroyed = false;
+
+        UpdateSpatialHash(remote, args.posX, args.posY);
+        RecordPoseHistory(handle, args.posX, args.posY, true);
+
+        // 순간 이동이므로 속도 없이 다시 시작 (클라이언트도 OnTankSpawned에서 모델을 버림)
+        deadReckoningModels.erase(remote);
+
+        TANK_LOG_INFO(LogCategory::Combat, "Tank spawned for client {} at ({},{})", remote, args.posX, args.posY);
+
+        // 모든 다른 클라이언트에게 이 클라이언트의 생성/리스폰 정보 전송
+        int recipientCount = 0;
+        int* recipients = roomRecipients.AllExcept(remote, recipientCount);
+        if (recipientCount > 0) {
+            sink.OnTankSpawned(recipients, recipientCount, remote,
+                               args.posX, args.posY, args.direction, args.tankType, args.initialHealth);
+        }
+    } else {
+        TANK_LOG_WARN(LogCategory::Combat, "Error: Tank not found for client {}", remote);
+    }
+    TANK_LOG_DEBUG(LogCategory::Combat, "========== SendTankSpawned Processing Completed ==========");
+}
+
+// P2P 메시지 릴레이 적용
+inline void GameWorld::ApplyP2PMessage(int remote, const std::string& message) {
+    TANK_LOG_DEBUG(LogCategory::P2P, "P2PMessage from client {}: {}", remote, message);
+
+    // P2P 그룹이 있는 경우 해당 클라이언트 제외한 모든 멤버에게 릴레이
+    if (gameP2PGroupId != 0 && message.find("P2P_GROUP_INFO:") == std::string::npos) {
+        // 메시지 보낸 클라이언트를 제외한 모든 클라이언트에게 릴레이
+        int recipientCount = 0;
+        int* recipients = roomRecipients.AllExcept(remote, recipientCount);
+        if (recipientCount > 0) {
+            std::string relayedMessage = "RELAY_FROM_" + std::to_string(remote) + ":" + message;
+
+            sink.P2PMessage(recipients, recipientCount, relayedMessage);
+            TANK_LOG_DEBUG(LogCategory::P2P, "Relayed P2P message to {} clients: {}", recipientCount, relayedMessage);
+        }
+    }
+}
+
+// 클라이언트 프로토콜 리비전 적용 - 첫 Hello에서 스냅샷 형식을 정함 (Hello가 없으면 탱크별 이전 RMI)
+// 틱 스냅샷만 지원하면 float 형식, 압축 이동을 지원하면 압축 형식,
+// 델타 스냅샷까지 지원하고 관심 영역/우선순위 스냅샷을 쓰지 않으면 델타 형식으로 전환
+// (관심 영역/우선순위 스냅샷은 수신자마다 보이는 탱크가 달라 방 전체 기준의 델타와 맞지 않으므로 압축 형식 유지)
+// 방 상태를 탱크별 RMI로 이미 받은 뒤에 온 Hello도 받아들여 이후 위치만 새 형식으로 보냅니다
+inline void GameWorld::ApplyHello(int remote, int protocolRevision) {
+    TANK_LOG_DEBUG(LogCategory::Net, "SendHello from client {}: protocol revision {}", remote, protocolRevision);
+
+    if (!tanks.Contains(remote) || protocolRevision < TickSnapshotProtocolRevision || HasSnapshotFormat(remote)) {
+        return;
+    }
+
+    legacyRecipients.Remove(remote);
+    if (protocolRevision < CompactMoveProtocolRevision) {
+        floatRecipients.Add(remote);
+        UpdateSnapshotClientCounts();
+        TANK_LOG_INFO(LogCategory::Net, "Client {} uses float snapshots (protocol revision {})", remote, protocolRevision);
+        return;
+    }
+
+    if (protocolRevision >= DeltaSnapshotProtocolRevision && !UseInterestManagement() && !UsePriorityScheduling()) {
+        // 첫 델타는 전체 스냅샷 - 슬롯 대신 HostID를 쓰므로 슬롯 표는 필요 없음
+        deltaRecipients.Add(remote);
+        deltaClients[remote] = DeltaClientState();
+        UpdateSnapshotClientCounts();
+        TANK_LOG_INFO(LogCategory::Net, "Client {} uses delta snapshots (protocol revision {})", remote, protocolRevision);
+        return;
+    }
+
+    compactRecipients.Add(remote);
+    UpdateSnapshotClientCounts();
+    TANK_LOG_INFO(LogCategory::Net, "Client {} uses compact movement (protocol revision {})", remote, protocolRevision);
+
+    // 현재 방의 슬롯 표 전체를 한 번에 전송
+    SendRoomSlots(&remote, 1, 0);
+}
+
+// 연결된 클라이언트 정보 출력
+inline void GameWorld::PrintConnectedClients() {
+    DebugLog("========== Connected Clients ==========");
+    DebugLog("Total: " + std::to_string(tanks.Size()) + " clients");
+
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        const TankPose& pose = tanks.PoseAt(i);
+        const TankStatus& status = tanks.StatusAt(i);
+        std::string healthStatus = status.isDestroyed ? "DESTROYED" :
+                                   std::to_string(status.currentHealth) + "/" + std::to_string(status.maxHealth);
+        std::string sendQueue;
+        if (const SendBacklogState* backlog = FindSendBacklog(tanks.HostIdAt(i))) {
+            sendQueue = ", SendQueue: " + std::to_string(backlog->queuedBytes) + " bytes";
+            if (backlog->level != SendBacklogLevel::Normal) {
+                sendQueue += std::string(" (") + SendBacklogLevelName(backlog->level) + ")";
+            }
+        }
+        DebugLog("Client ID: " + std::to_string(tanks.HostIdAt(i)) + ", Position: (" + std::to_string(pose.posX) + "," + std::to_string(pose.posY)
+             + "), TankType: " + std::to_string(status.tankType) + ", Health: " + healthStatus + sendQueue);
+    }
+
+    DebugLog("=======================================");
+}
+
+// 탱크 체력 정보 출력 (-1이면 전체)
+inline void GameWorld::PrintTankHealth(int targetId) {
+    if (targetId == -1) {
+        // 모든 탱크의 체력 정보 출력
+        DebugLog("========== Tank Health Status ==========");
+        for (size_t i = 0; i < tanks.Size(); i++) {
+            const TankStatus& status = tanks.StatusAt(i);
+            std::string healthStatus = status.isDestroyed ? "DESTROYED" :
+                                       std::to_string(status.currentHealth) + "/" + std::to_string(status.maxHealth);
+            DebugLog("Tank " + std::to_string(tanks.HostIdAt(i)) + ": " + healthStatus);
+        }
+        DebugLog("=======================================");
+    } else {
+        // 특정 탱크의 체력 정보 출력
+        int targetHostId = FindHostIDById(targetId);
+
+        TankHandle handle = tanks.Find(targetHostId);
+        if (targetHostId != 0 && handle.IsValid()) {
+            const TankStatus& tank = tanks.Status(handle);
+            std::string healthStatus = tank.isDestroyed ? "DESTROYED" :
+                                       std::to_string(tank.currentHealth) + "/" + std::to_string(tank.maxHealth);
+            DebugLog("Tank " + std::to_string(targetId) + " health: " + healthStatus);
+        } else {
+            DebugLog("Tank with ID " + std::to_string(targetId) + " not found");
+        }
+    }
+}
+
+// 탱크 데미지 적용
+inline void GameWorld::DamageTank(int targetId, float damageAmount) {
+    // 적절한 HostID 찾기
+    int targetHostId = FindHostIDById(targetId);
+
+    TankHandle handle = tanks.Find(targetHostId);
+    if (targetHostId != 0 && handle.IsValid()) {
+        TankStatus& tank = tanks.Status(handle);
+
+        // 이미 파괴된 탱크라면 처리하지 않음
+        if (tank.isDestroyed) {
+            DebugLog("Tank " + std::to_string(targetId) + " is already destroyed");
+            return;
+        }
+
+        // 체력 감소
+        tank.currentHealth = std::max(0.0f, tank.currentHealth - damageAmount);
+
+        // 파괴 여부 확인
+        bool wasDestroyed = tank.currentHealth <= 0;
+        tank.isDestroyed = wasDestroyed;
+
+        // 클라이언트에게 체력 업데이트 전송
+        int recipientCount = 0;
+        int* recipients = roomRecipients.All(recipientCount);
+        if (recipientCount > 0) {
+            sink.OnTankHealthUpdated(recipients, recipientCount, targetId, tank.currentHealth, tank.maxHealth);
+
+            // 파괴된 경우 파괴 이벤트도 전송
+            if (wasDestroyed) {
+                sink.OnTankDestroyed(recipients, recipientCount, targetId, 0); // 서버에 의한 파괴는 0으로 표시
+            }
+        }
+
+        std::string result = wasDestroyed ? "DESTROYED" :
+                             std::to_string(tank.currentHealth) + "/" + std::to_string(tank.maxHealth);
+        DebugLog("Applied " + std::to_string(damageAmount) + " damage to tank " + std::to_string(targetId)
+             + ". New health: " + result);
+    } else {
+        DebugLog("Tank with ID " + std::to_string(targetId) + " not found");
+    }
+}
+
+// 탱크 치유 적용
+inline void GameWorld::HealTankBy(int targetId, float healAmount) {
+    // 적절한 HostID 찾기
+    int targetHostId = FindHostIDById(targetId);
+
+    TankHandle handle = tanks.Find(targetHostId);
+    if (targetHostId != 0 && handle.IsValid()) {
+        TankStatus& tank = tanks.Status(handle);
+
+        // 이미 파괴된 탱크라면 처리하지 않음
+        if (tank.isDestroyed) {
+            DebugLog("Tank " + std::to_string(targetId) + " is destroyed and cannot be healed");
+            return;
+        }
+
+        // 이미 최대 체력이라면 처리하지 않음
+        if (tank.currentHealth >= tank.maxHealth) {
+            DebugLog("Tank " + std::to_string(targetId) + " already has full health");
+            return;
+        }
+
+        // 체력 회복 (최대 체력 초과하지 않도록)
+        float oldHealth = tank.currentHealth;
+        tank.currentHealth = std::min(tank.maxHealth, tank.currentHealth + healAmount);
+        float actualHeal = tank.currentHealth - oldHealth;
+
+        // 클라이언트에게 체력 업데이트 전송
+        int recipientCount = 0;
+        int* recipients = roomRecipients.All(recipientCount);
+        if (recipientCount > 0) {
+            sink.OnTankHealthUpdated(recipients, recipientCount, targetId, tank.currentHealth, tank.maxHealth);
+        }
+
+        DebugLog("Healed tank " + std::to_string(targetId) + " for " + std::to_string(actualHeal)
+             + " points. New health: " + std::to_string(tank.currentHealth) + "/" + std::to_string(tank.maxHealth));
+    } else {
+        DebugLog("Tank with ID " + std::to_string(targetId) + " not found");
+    }
+}
+
+// 탱크 리스폰 적용
+inline void GameWorld::RespawnTankAt(int targetId, float posX, float posY) {
+    // 적절한 HostID 찾기
+    int targetHostId = FindHostIDById(targetId);
+
+    TankHandle handle = tanks.Find(targetHostId);
+    if (targetHostId != 0 && handle.IsValid()) {
+        TankPose& pose = tanks.Pose(handle);
+        TankStatus& tank = tanks.Status(handle);
+
+        // 탱크 정보 업데이트
+        pose.posX = posX;
+        pose.posY = posY;
+        UpdateSpatialHash(targetId, posX, posY);
+        RecordPoseHistory(handle, posX, posY, true);
+        deadReckoningModels.erase(targetId);
+        tank.currentHealth = tank.maxHealth; // 체력 회복
+        tank.isDestroyed = false; // 파괴 상태 해제
+
+        // 클라이언트에게 리스폰 정보 전송
+        int recipientCount = 0;
+        int* recipients = roomRecipients.All(recipientCount);
+        if (recipientCount > 0) {
+            sink.OnTankSpawned(recipients, recipientCount, targetId, posX, posY,
+                               pose.direction, tank.tankType, tank.maxHealth);
+        }
+
+        DebugLog("Respawned tank " + std::to_string(targetId) + " at position (" + std::to_string(posX) + "," + std::to_string(posY)
+             + ") with full health");
+    } else {
+        DebugLog("Tank with ID " + std::to_string(targetId) + " not found");
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// 관심 영역 사용 시 관찰자별로 지난 틱에 보이던 탱크 (대상 슬롯 비트셋)
+// 틱마다 관찰자의 반경 쿼리 결과를 현재 비트셋에 표시하면서 지난 틱과 비교해
+// 새로 들어온 대상과 (Enter) 범위를 벗어난 대상을 (ForEachLeft) 구합니다.
+//  - 관찰자는 접속할 때 방 상태로 모든 탱크를 받으므로 첫 비교는 방 전체가 보이던 것으로 시작
+//  - 접속한 탱크는 OnPlayerJoined로 모두에게 위치가 알려지므로 모든 관찰자에게 보이던 것으로 추가
+//  - 퇴장한 탱크는 OnPlayerLeft로 알려지므로 모든 관찰자에게서 지움 (범위 밖 알림 없음)
+// 관찰자/대상은 TankRegistry 슬롯 번호로 색인하며, 비트셋 비교는 슬롯 64개당 한 번입니다.
+class InterestVisibility {
+public:
+    // 슬롯에 새 탱크가 배정됨 - 그 슬롯의 관찰자는 방 상태를 받기 전이며, 다른 관찰자에게는 보이던 것으로 표시
+    void AddSlot(uint32_t slot) {
+        EnsureSlot(slot);
+        for (View& view : views) {
+            if (view.initialized) {
+                Set(view.visible, slot);
+            }
+        }
+        views[slot].initialized = false;
+    }
+
+    // 슬롯의 탱크가 퇴장함 - 그 관찰자의 상태를 비우고 다른 관찰자들에게서 지움
+    void RemoveSlot(uint32_t slot) {
+        if (slot >= views.size()) {
+            return;
+        }
+        views[slot].initialized = false;
+        size_t word = slot / 64;
+        uint64_t mask = ~(1ull << (slot % 64));
+        for (View& view : views) {
+            if (word < view.visible.size()) {
+                view.visible[word] &= mask;
+            }
+        }
+    }
+
+    // 관찰자 하나의 비교 시작 - 처음이면 forEachSlot(mark)로 받은 방 상태의 탱크를 모두 보이던 것으로 표시
+    template <typename Func>
+    void BeginObserver(uint32_t observerSlot, Func&& forEachSlot) {
+        current = &views[observerSlot];
+        current->visible.resize(wordCount, 0);
+        if (!current->initialized) {
+            std::fill(current->visible.begin(), current->visible.end(), 0);
+            forEachSlot([this](uint32_t slot) { Set(current->visible, slot); });
+            Clear(current->visible, observerSlot);
+            current->initialized = true;
+        }
+        next.assign(wordCount, 0);
+    }
+
+    // 이번 틱에 보이는 대상 표시 - 지난 틱에 보이지 않았으면 (새로 들어왔으면) true
+    bool Enter(uint32_t slot) {
+        Set(next, slot);
+        return (current->visible[slot / 64] & (1ull << (slot % 64))) == 0;
+    }
+
+    // 지난 틱에는 보였지만 이번 틱에 표시되지 않은 대상마다 emit(slot)
+    template <typename Func>
+    void ForEachLeft(Func&& emit) const {
+        for (size_t word = 0; word < wordCount; word++) {
+            uint64_t left = current->visible[word] & ~next[word];
+            while (left != 0) {
+                int bit = CountTrailingZeros(left);
+                emit((uint32_t)(word * 64 + bit));
+                left &= left - 1;
+            }
+        }
+    }
+
+    // 이번 틱 결과를 다음 비교 기준으로 (전송을 미룬 관찰자는 호출하지 않아 다음 틱에 다시 비교)
+    void Commit() { current->visible.swap(next); }
+
+private:
+    struct View {
+        bool initialized = false;
+        std::vector<uint64_t> visible;
+    };
+
+    void EnsureSlot(uint32_t slot) {
+        if ((size_t)slot < views.size()) {
+            return;
+        }
+        views.resize((size_t)slot + 1);
+        wordCount = (views.size() + 63) / 64;
+    }
+
+    static void Set(std::vector<uint64_t>& bits, uint32_t slot) {
+        size_t word = slot / 64;
+        if (word >= bits.size()) {
+            bits.resize(word + 1, 0);
+        }
+        bits[word] |= 1ull << (slot % 64);
+    }
+
+    static void Clear(std::vector<uint64_t>& bits, uint32_t slot) {
+        size_t word = slot / 64;
+        if (word < bits.size()) {
+            bits[word] &= ~(1ull << (slot % 64));
+        }
+    }
+
+    static int CountTrailingZeros(uint64_t value) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return (int)index;
+#else
+        return __builtin_ctzll(value);
+#endif
+    }
+
+    std::vector<View> views;
+    View* current = nullptr;
+    std::vector<uint64_t> next;
+    size_t wordCount = 0;
+};
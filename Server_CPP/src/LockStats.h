@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+// 잠금 대기 통계 - 마지막 TakeStats() 호출 이후 구간 기준
+struct LockWaitStats {
+    uint64_t acquireCount = 0;     // 잠금 획득 수
+    uint64_t contendedCount = 0;   // 바로 얻지 못하고 기다린 수
+    double avgWaitUs = 0.0;        // 기다린 경우의 평균 대기 시간
+    double maxWaitUs = 0.0;        // 최대 대기 시간
+};
+
+// 시작 이후 누적 값 (메트릭 수집용)
+struct LockWaitTotals {
+    uint64_t acquireCount = 0;
+    uint64_t contendedCount = 0;
+    double waitSumSeconds = 0.0;
+};
+
+// MeasuredMutex - 대기 시간을 기록하는 std::mutex 래퍼 (std::lock_guard와 함께 사용)
+// try_lock이 성공하면 시각을 읽지 않으므로 경합이 없을 때 비용은 std::mutex와 거의 같습니다.
+// 통계는 잠금을 잡은 상태에서 갱신하므로 쓰기끼리는 경쟁하지 않으며, 읽기는 잠금 없이 atomic으로 합니다
+// (통계를 읽으려고 게임 뮤텍스를 잡지 않도록).
+class MeasuredMutex {
+public:
+    void lock() {
+        if (mutex.try_lock()) {
+            Increment(acquireCount);
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        mutex.lock();
+        int64_t waitNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        Increment(acquireCount);
+        Increment(contendedCount);
+        waitSumNs.store(waitSumNs.load(std::memory_order_relaxed) + waitNs, std::memory_order_relaxed);
+        if (waitNs > maxWaitNs.load(std::memory_order_relaxed)) {
+            maxWaitNs.store(waitNs, std::memory_order_relaxed);
+        }
+    }
+
+    bool try_lock() {
+        if (mutex.try_lock()) {
+            Increment(acquireCount);
+            return true;
+        }
+        return false;
+    }
+
+    void unlock() { mutex.unlock(); }
+
+    // 시작 이후 누적 값
+    LockWaitTotals Totals() const {
+        LockWaitTotals totals;
+        totals.acquireCount = acquireCount.load(std::memory_order_relaxed);
+        totals.contendedCount = contendedCount.load(std::memory_order_relaxed);
+        totals.waitSumSeconds = waitSumNs.load(std::memory_order_relaxed) / 1e9;
+        return totals;
+    }
+
+    // 구간 통계를 가져오고 초기화 (한 스레드에서만 호출)
+    LockWaitStats TakeStats() {
+        uint64_t acquires = acquireCount.load(std::memory_order_relaxed);
+        uint64_t contended = contendedCount.load(std::memory_order_relaxed);
+        int64_t waitSum = waitSumNs.load(std::memory_order_relaxed);
+
+        LockWaitStats result;
+        result.acquireCount = acquires - takenAcquireCount;
+        result.contendedCount = contended - takenContendedCount;
+        result.maxWaitUs = maxWaitNs.exchange(0, std::memory_order_relaxed) / 1000.0;
+        if (result.contendedCount > 0) {
+            result.avgWaitUs = (double)(waitSum - takenWaitSumNs) / result.contendedCount / 1000.0;
+        }
+
+        takenAcquireCount = acquires;
+        takenContendedCount = contended;
+        takenWaitSumNs = waitSum;
+        return result;
+    }
+
+private:
+    static void Increment(std::atomic<uint64_t>& counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    std::mutex mutex;
+    std::atomic<uint64_t> acquireCount{ 0 };
+    std::atomic<uint64_t> contendedCount{ 0 };
+    std::atomic<int64_t> waitSumNs{ 0 };
+    std::atomic<int64_t> maxWaitNs{ 0 };
+
+    // TakeStats 구간 계산용 이전 값
+    uint64_t takenAcquireCount = 0;
+    uint64_t takenContendedCount = 0;
+    int64_t takenWaitSumNs = 0;
+};
@@ -0,0 +1,480 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "SpatialHash.h"
+
+// LooseQuadtree - 느슨한 경계를 쓰는 적응형 사분 트리 (SpatialHash와 같은 인터페이스의 broadphase 색인)
+//  - 항목은 잎 노드에만 두고, 잎이 leafCapacity를 넘으면 4개로 나누며 (maxDepth까지) 하위 항목이 절반 이하로 줄면 합칩니다
+//  - 노드의 느슨한 경계는 실제 영역의 looseness배 (중심 +- half * looseness) - 항목이 잎의 느슨한 경계 안에서 움직이면
+//    좌표만 고치므로 경계 근처에서 흔들리는 탱크도 노드를 옮기지 않습니다 (벗어날 때만 루트부터 다시 넣음, 깊이만큼의 비용)
+//    경계가 넓을수록 옮기는 일은 줄지만 쿼리가 겹치는 잎이 늘어납니다 (자식이 부모 경계 안에 있으려면 1 이상)
+//  - 밀집한 곳만 깊게 나뉘어 밀도가 고르지 않은 맵에서도 쿼리가 보는 항목 수가 일정합니다
+//  - 루트 영역 밖의 항목은 따로 모아 모든 쿼리에서 확인합니다 (맵 크기에 맞게 영역을 설정)
+// 스레드 안전하지 않습니다 (k-최근접 쿼리는 내부 작업 버퍼를 쓰므로 const 쿼리도 동시에 호출하지 않음)
+
+struct LooseQuadtreeConfig {
+    float minX = 0.0f;            // 루트 영역 (정사각형) 왼쪽 아래
+    float minY = 0.0f;
+    float size = 1024.0f;         // 루트 영역 한 변
+    int maxDepth = 8;             // 최대 깊이 (1 ~ 16)
+    uint32_t leafCapacity = 16;   // 잎 하나의 항목 수가 이보다 많으면 분할
+    float looseness = 1.25f;      // 느슨한 경계 배율 (1 ~ 2)
+};
+
+class LooseQuadtree {
+public:
+    explicit LooseQuadtree(const LooseQuadtreeConfig& config = LooseQuadtreeConfig()) { SetConfig(config); }
+
+    LooseQuadtree(const LooseQuadtree&) = delete;
+    LooseQuadtree& operator=(const LooseQuadtree&) = delete;
+
+    // 영역/깊이 변경 - 기존 항목은 새 트리에 다시 넣습니다
+    void SetConfig(const LooseQuadtreeConfig& value) {
+        Items moved;
+        for (const Node& node : nodes) {
+            moved.Append(node.items);
+        }
+        moved.Append(outside);
+
+        config = value;
+        config.maxDepth = std::min(std::max(config.maxDepth, 1), 16);
+        config.leafCapacity = std::max(config.leafCapacity, 1u);
+        config.looseness = std::min(std::max(config.looseness, 1.0f), 2.0f);
+        Clear();
+        for (size_t i = 0; i < moved.ids.size(); i++) {
+            Update(moved.ids[i], moved.xs[i], moved.ys[i]);
+        }
+    }
+
+    const LooseQuadtreeConfig& Config() const { return config; }
+    size_t Size() const { return entries.size(); }
+    size_t NodeCount() const { return nodes.size() - freeBlocks.size() * 4; }
+
+    // 위치 갱신 (없으면 추가)
+    void Update(int id, float x, float y) {
+        auto it = entries.find(id);
+        if (it != entries.end()) {
+            Entry& e = it->second;
+            if (e.node >= 0 && nodes[e.node].LooseContains(x, y)) {
+                Items& items = nodes[e.node].items;
+                items.xs[e.index] = x;
+                items.ys[e.index] = y;
+                return;
+            }
+            if (e.node < 0 && !RootContains(x, y)) {
+                outside.xs[e.index] = x;
+                outside.ys[e.index] = y;
+                return;
+            }
+            Detach(e);
+            Insert(id, x, y, e);
+            return;
+        }
+        // 분할이 id의 위치를 고칠 수 있도록 먼저 등록
+        Insert(id, x, y, entries.emplace(id, Entry{ -1, 0 }).first->second);
+    }
+
+    void Remove(int id) {
+        auto it = entries.find(id);
+        if (it == entries.end()) {
+            return;
+        }
+        Entry e = it->second;
+        entries.erase(it);
+        Detach(e);
+    }
+
+    void Clear() {
+        nodes.clear();
+        freeBlocks.clear();
+        outside.Clear();
+        entries.clear();
+        float half = config.size * 0.5f;
+        nodes.push_back(Node(config.minX + half, config.minY + half, half, half * config.looseness, -1, 0));
+    }
+
+    // 항목의 현재 위치 (없으면 false)
+    bool Find(int id, float& x, float& y) const {
+        auto it = entries.find(id);
+        if (it == entries.end()) {
+            return false;
+        }
+        const Items& items = it->second.node >= 0 ? nodes[it->second.node].items : outside;
+        x = items.xs[it->second.index];
+        y = items.ys[it->second.index];
+        return true;
+    }
+
+    // (x, y)에서 radius 이내에 있는 항목마다 visit(id) 호출
+    template <typename Visitor>
+    void QueryRadius(float x, float y, float radius, Visitor&& visit) const {
+        float radiusSq = radius * radius;
+        auto test = [&](const Items& items) {
+            const size_t count = items.ids.size();
+            for (size_t i = 0; i < count; i++) {
+                float dx = items.xs[i] - x;
+                float dy = items.ys[i] - y;
+                if (dx * dx + dy * dy <= radiusSq) {
+                    visit(items.ids[i]);
+                }
+            }
+        };
+        test(outside);
+        Descend([&](const Node& node) { return node.LooseDistanceSq(x, y) <= radiusSq; }, test);
+    }
+
+    // 결과를 out에 추가하는 편의 함수
+    void QueryRadius(float x, float y, float radius, std::vector<int>& out) const {
+        QueryRadius(x, y, radius, [&out](int id) { out.push_back(id); });
+    }
+
+    // 선분 (x0, y0) - (x1, y1)에서 radius 이내 (캡슐)에 있는 항목마다 visit(id, t) 호출 - t는 가장 가까운 지점 (0 ~ 1)
+    // 느슨한 경계를 radius만큼 넓힌 상자와 선분이 만나는 노드만 내려감
+    template <typename Visitor>
+    void QuerySegment(float x0, float y0, float x1, float y1, float radius, Visitor&& visit) const {
+        float dx = x1 - x0;
+        float dy = y1 - y0;
+        float lengthSq = dx * dx + dy * dy;
+        float invLengthSq = lengthSq > 0.0f ? 1.0f / lengthSq : 0.0f;
+        float radiusSq = radius * radius;
+        auto test = [&](const Items& items) {
+            const size_t count = items.ids.size();
+            for (size_t i = 0; i < count; i++) {
+                float t;
+                if (SegmentDistanceSq(x0, y0, dx, dy, invLengthSq, items.xs[i], items.ys[i], t) <= radiusSq) {
+                    visit(items.ids[i], t);
+                }
+            }
+        };
+        test(outside);
+        Descend([&](const Node& node) {
+            float reach = node.loose + radius;
+            return SegmentHitsBox(x0, y0, dx, dy, node.centerX - reach, node.centerY - reach,
+                                  node.centerX + reach, node.centerY + reach);
+        }, test);
+    }
+
+    // (x, y)에서 가장 가까운 항목 k개 (maxDistance 이내, exclude 제외)를 가까운 순으로 out에 채움 - 찾은 수 반환
+    // 느슨한 경계까지의 거리가 가까운 노드부터 방문하고, k번째 후보보다 먼 노드가 나오면 멈춥니다
+    size_t QueryNearest(float x, float y, size_t k, float maxDistance, int exclude, std::vector<SpatialNeighbor>& out) const {
+        out.clear();
+        if (k == 0 || entries.empty()) {
+            return 0;
+        }
+        float limitSq = maxDistance * maxDistance;
+        auto test = [&](const Items& items) {
+            for (size_t i = 0; i < items.ids.size(); i++) {
+                float dx = items.xs[i] - x;
+                float dy = items.ys[i] - y;
+                float distanceSq = dx * dx + dy * dy;
+                if (distanceSq <= limitSq && items.ids[i] != exclude) {
+                    PushNeighbor(out, k, SpatialNeighbor{ items.ids[i], distanceSq });
+                }
+            }
+        };
+        test(outside);
+
+        // (거리 제곱, 노드) 최소 힙
+        auto closer = [](const std::pair<float, int32_t>& a, const std::pair<float, int32_t>& b) { return a.first > b.first; };
+        nearestHeap.clear();
+        nearestHeap.emplace_back(nodes[0].LooseDistanceSq(x, y), 0);
+        while (!nearestHeap.empty()) {
+            std::pop_heap(nearestHeap.begin(), nearestHeap.end(), closer);
+            std::pair<float, int32_t> next = nearestHeap.back();
+            nearestHeap.pop_back();
+            if (next.first > limitSq || (out.size() == k && next.first >= out.back().distanceSq)) {
+                break;
+            }
+            const Node& node = nodes[next.second];
+            if (node.count == 0) {
+                continue;
+            }
+            if (node.firstChild < 0) {
+                test(node.items);
+                continue;
+            }
+            for (int32_t c = node.firstChild; c < node.firstChild + 4; c++) {
+                if (nodes[c].count > 0) {
+                    nearestHeap.emplace_back(nodes[c].LooseDistanceSq(x, y), c);
+                    std::push_heap(nearestHeap.begin(), nearestHeap.end(), closer);
+                }
+            }
+        }
+        return out.size();
+    }
+
+private:
+    // 노드/바깥 목록의 항목 (같은 인덱스가 항목 하나)
+    struct Items {
+        std::vector<int> ids;
+        std::vector<float> xs;
+        std::vector<float> ys;
+
+        void Add(int id, float x, float y) {
+            ids.push_back(id);
+            xs.push_back(x);
+            ys.push_back(y);
+        }
+        void Append(const Items& other) {
+            ids.insert(ids.end(), other.ids.begin(), other.ids.end());
+            xs.insert(xs.end(), other.xs.begin(), other.xs.end());
+            ys.insert(ys.end(), other.ys.begin(), other.ys.end());
+        }
+        void Clear() {
+            ids.clear();
+            xs.clear();
+            ys.clear();
+        }
+    };
+
+    struct Node {
+        float centerX;
+        float centerY;
+        float half;              // 실제 영역 한 변의 절반
+        float loose;             // 느슨한 경계 한 변의 절반 (half x looseness)
+        int32_t parent;
+        int32_t firstChild = -1; // 잎이면 -1, 아니면 자식 4개가 연속
+        uint32_t count = 0;      // 하위 트리 전체 항목 수
+        int depth;
+        Items items;             // 잎만 사용
+
+        Node(float centerX, float centerY, float half, float loose, int32_t parent, int depth)
+            : centerX(centerX), centerY(centerY), half(half), loose(loose), parent(parent), depth(depth) {}
+
+        bool LooseContains(float x, float y) const {
+            return std::fabs(x - centerX) <= loose && std::fabs(y - centerY) <= loose;
+        }
+
+        // 느슨한 경계 상자까지의 거리 제곱 (안이면 0)
+        float LooseDistanceSq(float x, float y) const {
+            float dx = std::max(std::fabs(x - centerX) - loose, 0.0f);
+            float dy = std::max(std::fabs(y - centerY) - loose, 0.0f);
+            return dx * dx + dy * dy;
+        }
+
+        // (x, y)가 속한 자식 번호 (0 ~ 3)
+        int Quadrant(float x, float y) const { return (x >= centerX ? 1 : 0) | (y >= centerY ? 2 : 0); }
+    };
+
+    // 항목 위치 - node가 -1이면 바깥 목록
+    struct Entry {
+        int32_t node;
+        uint32_t index;
+    };
+
+    bool RootContains(float x, float y) const {
+        return x >= config.minX && x < config.minX + config.size && y >= config.minY && y < config.minY + config.size;
+    }
+
+    // 선분이 축 정렬 상자와 만나는지 (slab 방식)
+    static bool SegmentHitsBox(float x0, float y0, float dx, float dy, float minX, float minY, float maxX, float maxY) {
+        float enter = 0.0f;
+        float exit = 1.0f;
+        const float origin[2] = { x0, y0 };
+        const float delta[2] = { dx, dy };
+        const float lower[2] = { minX, minY };
+        const float upper[2] = { maxX, maxY };
+        for (int axis = 0; axis < 2; axis++) {
+            if (std::fabs(delta[axis]) < 1e-12f) {
+                if (origin[axis] < lower[axis] || origin[axis] > upper[axis]) {
+                    return false;
+                }
+                continue;
+            }
+            float inv = 1.0f / delta[axis];
+            float t0 = (lower[axis] - origin[axis]) * inv;
+            float t1 = (upper[axis] - origin[axis]) * inv;
+            if (t0 > t1) {
+                std::swap(t0, t1);
+            }
+            enter = std::max(enter, t0);
+            exit = std::min(exit, t1);
+            if (enter > exit) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 항목이 있고 visitNode가 true인 노드만 내려가며 잎의 항목 목록마다 test 호출 (깊이 16이면 스택 최대 3 x 16 + 4)
+    template <typename NodeFilter, typename ItemTest>
+    void Descend(NodeFilter&& visitNode, ItemTest&& test) const {
+        int32_t stack[64];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node& node = nodes[stack[--top]];
+            if (node.count == 0 || !visitNode(node)) {
+                continue;
+            }
+            if (node.firstChild < 0) {
+                test(node.items);
+                continue;
+            }
+            for (int32_t c = node.firstChild; c < node.firstChild + 4; c++) {
+                stack[top++] = c;
+            }
+        }
+    }
+
+    // 루트부터 (x, y)가 실제 영역에 들어가는 잎까지 내려가 추가 (영역 밖이면 바깥 목록)
+    void Insert(int id, float x, float y, Entry& e) {
+        if (!RootContains(x, y)) {
+            e.node = -1;
+            e.index = (uint32_t)outside.ids.size();
+            outside.Add(id, x, y);
+            return;
+        }
+        int32_t index = 0;
+        while (nodes[index].firstChild >= 0) {
+            nodes[index].count++;
+            index = nodes[index].firstChild + nodes[index].Quadrant(x, y);
+        }
+        Node& leaf = nodes[index];
+        leaf.count++;
+        e.node = index;
+        e.index = (uint32_t)leaf.items.ids.size();
+        leaf.items.Add(id, x, y);
+        if (leaf.items.ids.size() > config.leafCapacity && leaf.depth < config.maxDepth) {
+            Split(index);
+        }
+    }
+
+    // 항목을 노드/바깥 목록에서 빼고 (마지막 항목과 교체) 조상의 수를 줄임 - 줄어든 하위 트리는 합침
+    void Detach(const Entry& e) {
+        Items& items = e.node >= 0 ? nodes[e.node].items : outside;
+        size_t last = items.ids.size() - 1;
+        if (e.index < last) {
+            int movedId = items.ids[last];
+            items.ids[e.index] = movedId;
+            items.xs[e.index] = items.xs[last];
+            items.ys[e.index] = items.ys[last];
+            entries.find(movedId)->second.index = e.index;
+        }
+        items.ids.pop_back();
+        items.xs.pop_back();
+        items.ys.pop_back();
+        if (e.node < 0) {
+            return;
+        }
+
+        // 하위 항목이 절반 이하로 줄어든 가장 위 조상을 잎으로 합침
+        int32_t collapse = -1;
+        for (int32_t index = e.node; index >= 0; index = nodes[index].parent) {
+            Node& node = nodes[index];
+            node.count--;
+            if (node.firstChild >= 0 && node.count <= config.leafCapacity / 2) {
+                collapse = index;
+            }
+        }
+        if (collapse >= 0) {
+            Collapse(collapse);
+        }
+    }
+
+    // 잎을 4개로 나눠 항목을 자식으로 옮김 - 자식의 느슨한 경계를 벗어난 항목은 루트부터 다시 넣음
+    void Split(int32_t index) {
+        int32_t first;
+        if (!freeBlocks.empty()) {
+            first = freeBlocks.back();
+            freeBlocks.pop_back();
+        } else {
+            first = (int32_t)nodes.size();
+            nodes.resize(nodes.size() + 4, Node(0.0f, 0.0f, 0.0f, 0.0f, -1, 0));
+        }
+        Node& node = nodes[index];
+        float quarter = node.half * 0.5f;
+        for (int c = 0; c < 4; c++) {
+            float cx = node.centerX + ((c & 1) ? quarter : -quarter);
+            float cy = node.centerY + ((c & 2) ? quarter : -quarter);
+            nodes[first + c] = Node(cx, cy, quarter, quarter * config.looseness, index, node.depth + 1);
+        }
+        node.firstChild = first;
+
+        Items items;
+        std::swap(items, nodes[index].items);
+        std::vector<int> stray;
+        for (size_t i = 0; i < items.ids.size(); i++) {
+            int32_t child = first + nodes[index].Quadrant(items.xs[i], items.ys[i]);
+            Node& target = nodes[child];
+            Entry& e = entries.find(items.ids[i])->second;
+            if (!target.LooseContains(items.xs[i], items.ys[i])) {
+                stray.push_back((int)i);
+                continue;
+            }
+            target.count++;
+            e.node = child;
+            e.index = (uint32_t)target.items.ids.size();
+            target.items.Add(items.ids[i], items.xs[i], items.ys[i]);
+        }
+        for (int i : stray) {
+            for (int32_t up = index; up >= 0; up = nodes[up].parent) {
+                nodes[up].count--;
+            }
+            Insert(items.ids[i], items.xs[i], items.ys[i], entries.find(items.ids[i])->second);
+        }
+        for (int c = 0; c < 4; c++) {
+            if (nodes[first + c].items.ids.size() > config.leafCapacity && nodes[first + c].depth < config.maxDepth) {
+                Split(first + c);
+            }
+        }
+    }
+
+    // 하위 트리의 항목을 모두 이 노드로 모으고 자식 블록을 반환 (하위 항목은 모두 이 노드의 느슨한 경계 안)
+    void Collapse(int32_t index) {
+        Items gathered;
+        Gather(nodes[index].firstChild, gathered);
+        Node& node = nodes[index];
+        node.firstChild = -1;
+        node.items.Clear();
+        for (size_t i = 0; i < gathered.ids.size(); i++) {
+            Entry& e = entries.find(gathered.ids[i])->second;
+            e.node = index;
+            e.index = (uint32_t)node.items.ids.size();
+            node.items.Add(gathered.ids[i], gathered.xs[i], gathered.ys[i]);
+        }
+    }
+
+    void Gather(int32_t first, Items& gathered) {
+        for (int32_t c = first; c < first + 4; c++) {
+            Node& child = nodes[c];
+            if (child.firstChild >= 0) {
+                Gather(child.firstChild, gathered);
+            }
+            gathered.Append(child.items);
+            child.items = Items();
+        }
+        freeBlocks.push_back(first);
+    }
+
+    // 가까운 순으로 정렬된 k개 후보에 추가 (k개를 넘으면 가장 먼 것을 버림)
+    static void PushNeighbor(std::vector<SpatialNeighbor>& out, size_t k, const SpatialNeighbor& neighbor) {
+        if (out.size() == k && neighbor.distanceSq >= out.back().distanceSq) {
+            return;
+        }
+        auto at = std::upper_bound(out.begin(), out.end(), neighbor.distanceSq,
+                                   [](float d, const SpatialNeighbor& n) { return d < n.distanceSq; });
+        out.insert(at, neighbor);
+        if (out.size() > k) {
+            out.pop_back();
+        }
+    }
+
+    LooseQuadtreeConfig config;
+
+    // 노드 0이 루트, 자식은 4개 블록 단위로 할당하고 합칠 때 블록을 재사용
+    std::vector<Node> nodes;
+    std::vector<int32_t> freeBlocks;
+    Items outside;
+
+    // id -> 소속 노드와 노드 안의 위치
+    std::unordered_map<int, Entry> entries;
+
+    // k-최근접 쿼리의 노드 힙 (쿼리마다 재사용)
+    mutable std::vector<std::pair<float, int32_t>> nearestHeap;
+};
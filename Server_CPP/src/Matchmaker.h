@@ -0,0 +1,267 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "AsyncLog.h"
+#include "MpscQueue.h"
+#include "RmiMetrics.h"
+#include "SimCommand.h"
+
+// 매치메이킹 - 접속한 클라이언트를 모아 방 정원과 실력 구간/지역 태그(MatchKey)별로 방에 배정
+// 핸들러 스레드는 대기표를 lock-free 큐(MpscQueue)에 넣기만 하고, 매치메이커 스레드 하나가
+// batchWindow 동안 모인 대기표를 키별로 묶어 가장 먼저 연 방부터 채우며, 자리가 없으면 새 방을 엽니다.
+// 방을 열고 닫는 일도 이 스레드만 하므로 접속 폭주 중에도 배정 상태를 잠금 하나로 직렬화하지 않습니다.
+// 빈 방은 emptyRoomTimeout 동안 아무도 들어오지 않으면 닫습니다 (바로 닫지 않아 재접속/늦은 RMI가 닫힌 방을 보지 않게 함).
+// 방 생성/배정/종료는 MatchRoomPool 인터페이스로 요청합니다
+
+// 배정 키 - 같은 키의 클라이언트끼리만 같은 방에 들어감
+struct MatchKey {
+    uint16_t skillBucket = 0;   // 실력 구간 (0 ~ MatchSkillBucketCount - 1, 구간별 대기 시간 히스토그램)
+    uint16_t region = 0;        // 지역 태그
+
+    bool operator<(const MatchKey& other) const {
+        return skillBucket != other.skillBucket ? skillBucket < other.skillBucket : region < other.region;
+    }
+    bool operator==(const MatchKey& other) const {
+        return skillBucket == other.skillBucket && region == other.region;
+    }
+};
+
+const size_t MatchSkillBucketCount = 8;
+
+// 대기표 (큐에 그대로 복사되는 고정 크기 레코드)
+struct MatchTicket {
+    int hostId;
+    MatchKey key;
+    int64_t enqueueNs;   // 대기열에 들어간 시각 (SimNowNs)
+};
+
+struct MatchmakerConfig {
+    int roomSize = 64;                  // 방 정원 (0이면 키마다 제한 없이 방 하나)
+    int batchWindowMs = 20;             // 첫 대기표부터 이만큼 모아서 배정 (0이면 꺼낸 즉시)
+    size_t maxBatch = 4096;             // 모으는 중이라도 이만큼 쌓이면 바로 배정
+    int emptyRoomTimeoutMs = 30000;     // 빈 방을 닫기까지 기다리는 시간 (0이면 닫지 않음)
+    size_t queueCapacity = 65536;
+};
+
+// 매치메이킹 누적 값 (atomic - 메트릭 스레드에서 읽음)
+struct MatchmakerStats {
+    std::atomic<uint64_t> queued{ 0 };        // 받은 대기표
+    std::atomic<uint64_t> placed{ 0 };        // 방에 배정한 클라이언트
+    std::atomic<uint64_t> cancelled{ 0 };     // 배정 전에 나간 클라이언트
+    std::atomic<uint64_t> batches{ 0 };       // 배정한 묶음 수
+    std::atomic<uint64_t> roomsOpened{ 0 };
+    std::atomic<uint64_t> roomsClosed{ 0 };
+    LatencyHistogram queueTime;                                   // 대기열에 들어간 뒤 방에 배정되기까지 (전체)
+    LatencyHistogram queueTimeBySkill[MatchSkillBucketCount];     // 실력 구간별
+
+    uint64_t Waiting() const {
+        uint64_t done = placed.load(std::memory_order_relaxed) + cancelled.load(std::memory_order_relaxed);
+        uint64_t total = queued.load(std::memory_order_relaxed);
+        return total > done ? total - done : 0;
+    }
+};
+
+// 매치메이커가 방을 다루는 인터페이스 (모든 호출은 매치메이커 스레드에서)
+class MatchRoomPool {
+public:
+    virtual ~MatchRoomPool() {}
+
+    // 키에 쓸 새 방을 열고 방 ID 반환
+    virtual int OpenRoom(const MatchKey& key) = 0;
+
+    // 클라이언트를 방에 넣음 - 이미 나간 클라이언트면 false
+    virtual bool PlaceClient(int hostId, int roomId) = 0;
+
+    // 방의 현재 인원 (다른 스레드의 퇴장으로 줄어들 수 있음, 늘리는 것은 PlaceClient뿐)
+    virtual int RoomMembers(int roomId) = 0;
+
+    // 빈 방 닫기
+    virtual void CloseRoom(int roomId) = 0;
+};
+
+class Matchmaker {
+public:
+    Matchmaker(const MatchmakerConfig& config, MatchRoomPool& pool) : config(config), pool(pool), queue(config.queueCapacity) {
+        popBuffer.resize(PopBatchSize);
+    }
+
+    Matchmaker(const Matchmaker&) = delete;
+    Matchmaker& operator=(const Matchmaker&) = delete;
+
+    ~Matchmaker() { Stop(); }
+
+    void Start() {
+        Stop();
+        running = true;
+        worker = std::thread([this]() { Run(); });
+    }
+
+    // 스레드를 멈춤 - 남은 대기표는 배정하지 않음 (서버 종료 시)
+    void Stop() {
+        running = false;
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    // 대기표 제출 (여러 핸들러 스레드에서 동시에 호출, 잠금 없음)
+    void Submit(int hostId, const MatchKey& key) {
+        MatchTicket ticket;
+        ticket.hostId = hostId;
+        ticket.key = key;
+        ticket.key.skillBucket = (uint16_t)std::min<size_t>(key.skillBucket, MatchSkillBucketCount - 1);
+        ticket.enqueueNs = SimNowNs();
+        stats.queued.fetch_add(1, std::memory_order_relaxed);
+        queue.Push(ticket);
+    }
+
+    // 배정 전에 나간 클라이언트 (대기표는 배정할 때 PlaceClient가 false를 돌려 건너뜀)
+    void NoteCancelled() { stats.cancelled.fetch_add(1, std::memory_order_relaxed); }
+
+    const MatchmakerStats& Stats() const { return stats; }
+    const MatchmakerConfig& Config() const { return config; }
+    size_t QueueDepth() const { return queue.Depth(); }
+
+private:
+    static const size_t PopBatchSize = 1024;
+
+    // 키별로 연 방 (연 순서대로)과 빈 방이 된 시각
+    struct OpenRoom {
+        int roomId;
+        int64_t emptySinceNs;   // 0이면 사람이 있음
+    };
+
+    void Run() {
+        std::chrono::nanoseconds window(std::chrono::milliseconds(config.batchWindowMs));
+        std::chrono::steady_clock::time_point batchDeadline;
+        std::chrono::steady_clock::time_point nextSweep = std::chrono::steady_clock::now() + SweepInterval;
+        while (running) {
+            size_t count = queue.PopBatch(popBuffer.data(), popBuffer.size());
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            if (count > 0) {
+                if (batch.empty()) {
+                    batchDeadline = now + window;
+                }
+                batch.insert(batch.end(), popBuffer.begin(), popBuffer.begin() + count);
+            }
+
+            if (!batch.empty() && (now >= batchDeadline || batch.size() >= config.maxBatch)) {
+                PlaceBatch();
+            }
+            if (now >= nextSweep) {
+                SweepEmptyRooms();
+                nextSweep = now + SweepInterval;
+            }
+
+            if (count == 0) {
+                std::chrono::steady_clock::time_point deadline = std::min(nextSweep, now + IdleWait);
+                if (!batch.empty()) {
+                    deadline = std::min(deadline, batchDeadline);
+                }
+                queue.WaitUntil(deadline);
+            }
+        }
+    }
+
+    // 모은 대기표를 키별로 (키 안에서는 도착 순서대로) 방에 배정
+    void PlaceBatch() {
+        std::stable_sort(batch.begin(), batch.end(),
+                         [](const MatchTicket& a, const MatchTicket& b) { return a.key < b.key; });
+
+        int64_t nowNs = SimNowNs();
+        size_t begin = 0;
+        while (begin < batch.size()) {
+            size_t end = begin + 1;
+            while (end < batch.size() && batch[end].key == batch[begin].key) {
+                end++;
+            }
+            PlaceGroup(batch[begin].key, begin, end, nowNs);
+            begin = end;
+        }
+        stats.batches.fetch_add(1, std::memory_order_relaxed);
+        batch.clear();
+    }
+
+    // 같은 키의 대기표를 먼저 연 방부터 정원까지 채우고, 모자라면 새 방을 엶
+    void PlaceGroup(const MatchKey& key, size_t begin, size_t end, int64_t nowNs) {
+        std::vector<OpenRoom>& rooms = roomsByKey[key];
+        size_t roomIndex = 0;
+        int members = rooms.empty() ? 0 : pool.RoomMembers(rooms[0].roomId);
+        for (size_t i = begin; i < end; i++) {
+            while (roomIndex < rooms.size() && config.roomSize > 0 && members >= config.roomSize) {
+                roomIndex++;
+                members = roomIndex < rooms.size() ? pool.RoomMembers(rooms[roomIndex].roomId) : 0;
+            }
+            if (roomIndex == rooms.size()) {
+                rooms.push_back(OpenRoom{ pool.OpenRoom(key), 0 });
+                stats.roomsOpened.fetch_add(1, std::memory_order_relaxed);
+                members = 0;
+            }
+
+            const MatchTicket& ticket = batch[i];
+            if (!pool.PlaceClient(ticket.hostId, rooms[roomIndex].roomId)) {
+                continue;   // 배정 전에 나감 (NoteCancelled로 이미 셈)
+            }
+            members++;
+            rooms[roomIndex].emptySinceNs = 0;
+
+            uint64_t waitedNs = (uint64_t)std::max<int64_t>(0, nowNs - ticket.enqueueNs);
+            stats.queueTime.Record(waitedNs);
+            stats.queueTimeBySkill[ticket.key.skillBucket].Record(waitedNs);
+            stats.placed.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // 비어 있는 시간이 emptyRoomTimeout을 넘은 방을 닫음
+    void SweepEmptyRooms() {
+        if (config.emptyRoomTimeoutMs <= 0) {
+            return;
+        }
+        int64_t nowNs = SimNowNs();
+        int64_t timeoutNs = (int64_t)config.emptyRoomTimeoutMs * 1000000;
+        for (auto it = roomsByKey.begin(); it != roomsByKey.end(); ) {
+            std::vector<OpenRoom>& rooms = it->second;
+            for (size_t i = 0; i < rooms.size(); ) {
+                OpenRoom& room = rooms[i];
+                if (pool.RoomMembers(room.roomId) > 0) {
+                    room.emptySinceNs = 0;
+                    i++;
+                    continue;
+                }
+                if (room.emptySinceNs == 0) {
+                    room.emptySinceNs = nowNs;
+                }
+                if (nowNs - room.emptySinceNs < timeoutNs) {
+                    i++;
+                    continue;
+                }
+                pool.CloseRoom(room.roomId);
+                stats.roomsClosed.fetch_add(1, std::memory_order_relaxed);
+                rooms.erase(rooms.begin() + i);
+            }
+            it = rooms.empty() ? roomsByKey.erase(it) : std::next(it);
+        }
+    }
+
+    static constexpr std::chrono::milliseconds SweepInterval{ 100 };
+    static constexpr std::chrono::milliseconds IdleWait{ 100 };
+
+    MatchmakerConfig config;
+    MatchRoomPool& pool;
+    MatchmakerStats stats;
+    MpscQueue<MatchTicket> queue;
+    std::atomic<bool> running{ false };
+    std::thread worker;
+
+    // 매치메이커 스레드 전용
+    std::vector<MatchTicket> popBuffer;
+    std::vector<MatchTicket> batch;
+    std::map<MatchKey, std::vector<OpenRoom>> roomsByKey;
+};
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+// MetricsHttpServer - /metrics, /healthz 용 최소 HTTP/1.0 리스너
+//  - 전용 스레드 하나가 연결을 하나씩 받아 GET 요청 한 건을 처리하고 닫음 (keep-alive 없음)
+//  - 응답 본문은 Handler가 만들며, Handler는 잠금 없이 읽을 수 있는 값만 사용해야 함 (게임 스레드와 경쟁하지 않도록)
+//  - 스크레이퍼/헬스 체크 용도라 처리량보다 단순함을 우선합니다
+class MetricsHttpServer {
+public:
+    // path를 받아 상태 코드를 반환하고 contentType/body를 채움
+    using Handler = std::function<int(const std::string& path, std::string& contentType, std::string& body)>;
+
+    ~MetricsHttpServer() { Stop(); }
+
+    // 0.0.0.0:port 에서 대기 시작, 바인드 실패 시 false
+    bool Start(int port, Handler requestHandler) {
+        Stop();
+#ifdef _WIN32
+        WSADATA wsaData;
+        if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+            return false;
+        }
+#endif
+        listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (listenSocket == InvalidSocket) {
+            return false;
+        }
+
+        int reuse = 1;
+        setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons((uint16_t)port);
+        if (bind(listenSocket, (sockaddr*)&address, sizeof(address)) != 0 || listen(listenSocket, 16) != 0) {
+            CloseSocket(listenSocket);
+            listenSocket = InvalidSocket;
+            return false;
+        }
+
+        handler = std::move(requestHandler);
+        running = true;
+        worker = std::thread([this]() { Run(); });
+        return true;
+    }
+
+    void Stop() {
+        running = false;
+        if (worker.joinable()) {
+            worker.join();
+        }
+        if (listenSocket != InvalidSocket) {
+            CloseSocket(listenSocket);
+            listenSocket = InvalidSocket;
+        }
+    }
+
+    uint64_t RequestCount() const { return requestCount.load(std::memory_order_relaxed); }
+
+private:
+#ifdef _WIN32
+    typedef SOCKET SocketHandle;
+    static constexpr SocketHandle InvalidSocket = INVALID_SOCKET;
+    static void CloseSocket(SocketHandle s) { closesocket(s); }
+#else
+    typedef int SocketHandle;
+    static constexpr SocketHandle InvalidSocket = -1;
+    static void CloseSocket(SocketHandle s) { close(s); }
+#endif
+
+    static const size_t MaxRequestSize = 4096;
+
+    void Run() {
+        while (running) {
+            // Stop()이 바로 반영되도록 짧은 타임아웃으로 대기
+            fd_set readSet;
+            FD_ZERO(&readSet);
+            FD_SET(listenSocket, &readSet);
+            timeval timeout;
+            timeout.tv_sec = 0;
+            timeout.tv_usec = 200000;
+            int ready = select((int)listenSocket + 1, &readSet, nullptr, nullptr, &timeout);
+            if (ready <= 0) {
+                continue;
+            }
+
+            SocketHandle client = accept(listenSocket, nullptr, nullptr);
+            if (client == InvalidSocket) {
+                continue;
+            }
+            HandleConnection(client);
+            CloseSocket(client);
+        }
+    }
+
+    void HandleConnection(SocketHandle client) {
+        // 느린 클라이언트가 리스너를 붙잡지 않도록 수신 타임아웃 설정
+#ifdef _WIN32
+        DWORD receiveTimeoutMs = 1000;
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, (const char*)&receiveTimeoutMs, sizeof(receiveTimeoutMs));
+#else
+        timeval receiveTimeout;
+        receiveTimeout.tv_sec = 1;
+        receiveTimeout.tv_usec = 0;
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &receiveTimeout, sizeof(receiveTimeout));
+#endif
+
+        std::string request;
+        char buffer[1024];
+        while (request.size() < MaxRequestSize && request.find("\r\n\r\n") == std::string::npos) {
+            int received = (int)recv(client, buffer, sizeof(buffer), 0);
+            if (received <= 0) {
+                break;
+            }
+            request.append(buffer, received);
+        }
+        requestCount.fetch_add(1, std::memory_order_relaxed);
+
+        // 요청 줄: "GET /path HTTP/1.1"
+        std::string method, path;
+        size_t methodEnd = request.find(' ');
+        if (methodEnd != std::string::npos) {
+            method = request.substr(0, methodEnd);
+            size_t pathEnd = request.find(' ', methodEnd + 1);
+            if (pathEnd != std::string::npos) {
+                path = request.substr(methodEnd + 1, pathEnd - methodEnd - 1);
+            }
+        }
+        size_t query = path.find('?');
+        if (query != std::string::npos) {
+            path.resize(query);
+        }
+
+        int status;
+        std::string contentType = "text/plain; charset=utf-8";
+        std::string body;
+        if (method != "GET") {
+            status = 405;
+            body = "method not allowed\n";
+        } else {
+            status = handler(path, contentType, body);
+        }
+
+        char header[256];
+        int headerLength = snprintf(header, sizeof(header),
+                                    "HTTP/1.0 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+                                    status, StatusText(status), contentType.c_str(), body.size());
+        SendAll(client, header, (size_t)headerLength);
+        SendAll(client, body.data(), body.size());
+    }
+
+    static void SendAll(SocketHandle client, const char* data, size_t length) {
+        while (length > 0) {
+            int sent = (int)send(client, data, (int)length, 0);
+            if (sent <= 0) {
+                return;
+            }
+            data += sent;
+            length -= (size_t)sent;
+        }
+    }
+
+    static const char* StatusText(int status) {
+        switch (status) {
+        case 200: return "OK";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 503: return "Service Unavailable";
+        default: return "Error";
+        }
+    }
+
+    SocketHandle listenSocket = InvalidSocket;
+    Handler handler;
+    std::atomic<bool> running{ false };
+    std::thread worker;
+    std::atomic<uint64_t> requestCount{ 0 };
+};
+
+// Prometheus text exposition 형식 작성 도우미
+// 같은 이름의 metric은 연속해서 쓰며, HELP/TYPE 줄은 이름이 바뀔 때 한 번만 출력합니다
+class PrometheusWriter {
+public:
+    void Counter(const char* name, const char* help, double value, const std::string& labels = std::string()) {
+        Write(name, help, "counter", value, labels);
+    }
+
+    void Gauge(const char* name, const char* help, double value, const std::string& labels = std::string()) {
+        Write(name, help, "gauge", value, labels);
+    }
+
+    // summary 계열 (quantile 라벨, _sum, _count) - 이름은 기본 metric 이름
+    void SummaryQuantile(const char* name, const char* help, double quantile, double value, const std::string& labels) {
+        char quantileLabel[32];
+        snprintf(quantileLabel, sizeof(quantileLabel), "quantile=\"%g\"", quantile);
+        std::string allLabels = labels.empty() ? quantileLabel : labels + "," + quantileLabel;
+        Write(name, help, "summary", value, allLabels);
+    }
+
+    void SummaryTotals(const char* name, double sum, uint64_t count, const std::string& labels) {
+        std::string suffixed = std::string(name) + "_sum";
+        Line(suffixed.c_str(), sum, labels);
+        suffixed = std::string(name) + "_count";
+        Line(suffixed.c_str(), (double)count, labels);
+    }
+
+    const std::string& Text() const { return text; }
+
+private:
+    void Write(const char* name, const char* help, const char* type, double value, const std::string& labels) {
+        if (lastName != name) {
+            lastName = name;
+            text += "# HELP ";
+            text += name;
+            text += ' ';
+            text += help;
+            text += "\n# TYPE ";
+            text += name;
+            text += ' ';
+            text += type;
+            text += '\n';
+        }
+        Line(name, value, labels);
+    }
+
+    void Line(const char* name, double value, const std::string& labels) {
+        char number[64];
+        snprintf(number, sizeof(number), "%.17g", value);
+        text += name;
+        if (!labels.empty()) {
+            text += '{';
+            text += labels;
+            text += '}';
+        }
+        text += ' ';
+        text += number;
+        text += '\n';
+    }
+
+    std::string text;
+    std::string lastName;
+};
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// 큐 통계 - 마지막 TakeStats() 호출 이후 구간 기준 (누적 값 제외)
+struct MpscQueueStats {
+    uint64_t pushedCount = 0;      // 누적 push 수
+    uint64_t poppedCount = 0;      // 누적 pop 수
+    uint64_t fullWaitCount = 0;    // 누적 - 큐가 가득 차 생산자가 양보한 횟수
+    uint64_t batchCount = 0;       // 구간 내 비어 있지 않은 PopBatch 수
+    double avgBatchSize = 0.0;     // 구간 내 배치당 평균 명령 수
+    uint64_t maxDepth = 0;         // 구간 내 배치 시작 시점의 최대 깊이
+    double avgDepth = 0.0;         // 구간 내 배치 시작 시점의 평균 깊이
+    size_t currentDepth = 0;       // 조회 시점의 대략적인 깊이
+};
+
+// MpscQueue - 고정 크기 lock-free 다중 생산자 / 단일 소비자 큐
+//  - 슬롯마다 시퀀스 번호를 두는 링 (Vyukov bounded queue), 생산자끼리는 CAS 한 번으로 슬롯을 예약
+//  - 소비자는 한 스레드만 PopBatch / WaitUntil 을 호출해야 함
+//  - 큐가 비어 소비자가 잠들어 있을 때만 생산자가 condition_variable 로 깨움 (평소 push는 잠금 없음)
+// T는 복사 가능한 고정 크기 레코드여야 합니다.
+template <typename T>
+class MpscQueue {
+public:
+    // capacity는 2의 거듭제곱으로 올림
+    explicit MpscQueue(size_t capacity = 65536) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask = size - 1;
+        cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    size_t Capacity() const { return mask + 1; }
+
+    // 가득 찼으면 false
+    bool TryPush(const T& value) {
+        Cell* cell;
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        WakeConsumer();
+        return true;
+    }
+
+    // 게임 명령은 버릴 수 없으므로 자리가 날 때까지 양보하며 재시도
+    void Push(const T& value) {
+        while (!TryPush(value)) {
+            fullWaitCount.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::yield();
+        }
+    }
+
+    // 소비자 전용 - 최대 maxCount개를 out에 꺼내고 꺼낸 개수를 반환
+    size_t PopBatch(T* out, size_t maxCount) {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        size_t depth = enqueuePos.load(std::memory_order_relaxed) - pos;
+
+        size_t count = 0;
+        while (count < maxCount) {
+            Cell& cell = cells[pos & mask];
+            if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            out[count++] = cell.value;
+            cell.sequence.store(pos + mask + 1, std::memory_order_release);
+            pos++;
+        }
+
+        if (count > 0) {
+            dequeuePos.store(pos, std::memory_order_relaxed);
+
+            std::lock_guard<std::mutex> lock(statsMutex);
+            window.batchCount++;
+            batchSizeSum += count;
+            depthSum += depth;
+            if (depth > window.maxDepth) {
+                window.maxDepth = depth;
+            }
+        }
+        return count;
+    }
+
+    // 소비자 전용 - 항목이 들어오거나 deadline이 될 때까지 대기, 항목이 있으면 true
+    template <typename Clock, typename Duration>
+    bool WaitUntil(const std::chrono::time_point<Clock, Duration>& deadline) {
+        if (HasItem()) {
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(waitMutex);
+        consumerSleeping.store(true, std::memory_order_relaxed);
+        // 생산자의 push 후 consumerSleeping 읽기와 짝을 이루는 펜스 - 둘 중 하나는 상대의 쓰기를 봄
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool ready = waitCondition.wait_until(lock, deadline, [this]() { return HasItem(); });
+        consumerSleeping.store(false, std::memory_order_relaxed);
+        return ready;
+    }
+
+    // 대략적인 깊이 (생산자/소비자가 동시에 움직이는 중에는 근사값)
+    size_t Depth() const {
+        size_t enqueued = enqueuePos.load(std::memory_order_relaxed);
+        size_t dequeued = dequeuePos.load(std::memory_order_relaxed);
+        return enqueued >= dequeued ? enqueued - dequeued : 0;
+    }
+
+    // 구간 통계를 가져오고 초기화
+    MpscQueueStats TakeStats() {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        MpscQueueStats result = window;
+        if (result.batchCount > 0) {
+            result.avgBatchSize = (double)batchSizeSum / result.batchCount;
+            result.avgDepth = (double)depthSum / result.batchCount;
+        }
+        // 링 위치가 곧 누적 push/pop 수
+        result.pushedCount = enqueuePos.load(std::memory_order_relaxed);
+        result.poppedCount = dequeuePos.load(std::memory_order_relaxed);
+        result.fullWaitCount = fullWaitCount.load(std::memory_order_relaxed);
+        result.currentDepth = Depth();
+        window = MpscQueueStats();
+        batchSizeSum = 0;
+        depthSum = 0;
+        return result;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    bool HasItem() const {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        return cells[pos & mask].sequence.load(std::memory_order_acquire) == pos + 1;
+    }
+
+    void WakeConsumer() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (consumerSleeping.load(std::memory_order_relaxed)) {
+            // 소비자가 잠금을 잡은 채 대기 진입 중일 수 있으므로 잠금 후 알림 (깨움 누락 방지)
+            std::lock_guard<std::mutex> lock(waitMutex);
+            waitCondition.notify_one();
+        }
+    }
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask = 0;
+
+    alignas(64) std::atomic<size_t> enqueuePos{ 0 };
+    alignas(64) std::atomic<size_t> dequeuePos{ 0 };
+
+    alignas(64) std::atomic<bool> consumerSleeping{ false };
+    std::mutex waitMutex;
+    std::condition_variable waitCondition;
+
+    std::atomic<uint64_t> fullWaitCount{ 0 };
+
+    // 소비자가 배치마다 갱신 (콘솔 조회와만 경쟁)
+    std::mutex statsMutex;
+    MpscQueueStats window;
+    uint64_t batchSizeSum = 0;
+    uint64_t depthSum = 0;
+};
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 지연 보상용 탱크 위치 기록
+// 탱크마다 최근 SendMove 위치를 받은 시각과 함께 고정 크기 링 버퍼에 보관하고, 서버 판정 포탄을 쏠 때
+// 쏜 클라이언트가 보고 있던 시각(발사 수신 시각 - RTT - 보간 지연)으로 다른 탱크들의 위치를 되감는 데 씁니다.
+// 클라이언트는 스냅샷이 도착하는 데 RTT의 절반, 발사가 서버에 오는 데 나머지 절반이 걸리므로 RTT 전체만큼 되감습니다.
+// 링은 슬롯(TankRegistry 슬롯 번호)마다 같은 크기의 구간을 시각/x/z 배열에 나눠 두어, 되감을 때 시각 배열만
+// 최신 쪽부터 훑고 (되감는 시간은 보통 기록 몇 개 분량) 찾은 두 기록의 위치만 읽어 보간합니다.
+// 탱크 하나의 메모리는 historySamples로 고정되며 BytesPerTank()로 확인할 수 있습니다.
+
+struct LagCompensationConfig {
+    int maxRewindMs = 0;            // 되감기 상한 (0이면 끔 - 포탄은 서버의 현재 위치로만 판정)
+    uint32_t historySamples = 32;   // 탱크마다 보관하는 위치 수 (2의 거듭제곱으로 올림)
+    int interpolationDelayMs = 0;   // 클라이언트가 다른 탱크를 보간해 늦게 그리는 시간 (콘솔 클라이언트는 최신 스냅샷을 그대로 그림)
+
+    bool Enabled() const { return maxRewindMs > 0 && historySamples > 0; }
+};
+
+// 지연 보상 누적 값 (atomic - 메트릭 스레드에서 읽음, 쓰기는 월드에 접근하는 스레드 하나만)
+struct LagCompensationStats {
+    std::atomic<uint64_t> rewoundShots{ 0 };       // 되감아 따라잡은 포탄
+    std::atomic<uint64_t> rewoundTargets{ 0 };     // 되감은 탱크 위치 (포탄 x 따라잡은 틱 x 탱크)
+    std::atomic<uint64_t> clampedTargets{ 0 };     // 기록보다 오래 전이라 가장 오래된 기록을 쓴 위치
+    std::atomic<uint64_t> rewindHits{ 0 };         // 따라잡는 중에 맞은 포탄
+    std::atomic<uint64_t> rewindNs{ 0 };           // 되감은 시간의 합 (평균 = rewindNs / rewoundShots)
+    std::atomic<uint64_t> historyBytes{ 0 };       // 링 버퍼 메모리 (슬롯 수 x BytesPerTank)
+};
+
+// PoseHistory - 방 하나의 탱크별 위치 링 버퍼
+// 스레드 안전하지 않으며 월드와 같은 스레드에서만 호출합니다
+class PoseHistory {
+public:
+    void SetConfig(const LagCompensationConfig& value) {
+        config = value;
+        samples = 1;
+        while (samples < config.historySamples) {
+            samples <<= 1;
+        }
+        times.clear();
+        xs.clear();
+        zs.clear();
+        heads.clear();
+        counts.clear();
+        viewLags.clear();
+        stats.historyBytes.store(0, std::memory_order_relaxed);
+    }
+
+    const LagCompensationConfig& Config() const { return config; }
+    const LagCompensationStats& Stats() const { return stats; }
+    LagCompensationStats& Stats() { return stats; }
+
+    // 탱크 하나가 차지하는 메모리 (링 + 머리/개수/지연)
+    size_t BytesPerTank() const {
+        return samples * (sizeof(int64_t) + 2 * sizeof(float)) + 2 * sizeof(uint32_t) + sizeof(int64_t);
+    }
+
+    // 슬롯이 새 탱크에 배정되거나 탱크가 순간 이동함 (생성/리스폰) - 이전 기록과 보간하지 않도록 비움
+    void ResetSlot(uint32_t slot) {
+        EnsureSlot(slot);
+        heads[slot] = 0;
+        counts[slot] = 0;
+    }
+
+    // 클라이언트의 최근 RTT (전송 계층이 주기적으로 알려 줌)
+    void SetRtt(uint32_t slot, int rttMs) {
+        EnsureSlot(slot);
+        viewLags[slot] = (int64_t)std::max(0, rttMs + config.interpolationDelayMs) * 1000000;
+    }
+
+    // 쏜 클라이언트가 보던 시각까지 되감을 시간 (maxRewindMs로 제한)
+    int64_t RewindNs(uint32_t slot) const {
+        int64_t lag = slot < viewLags.size() ? viewLags[slot] : 0;
+        return std::min(lag, (int64_t)config.maxRewindMs * 1000000);
+    }
+
+    // 위치 기록 (가장 오래된 기록을 덮어씀) - 시각이 거꾸로 오면 마지막 기록 시각으로 맞춤
+    void Record(uint32_t slot, int64_t timeNs, float x, float z) {
+        EnsureSlot(slot);
+        size_t base = (size_t)slot * samples;
+        uint32_t count = counts[slot];
+        if (count > 0) {
+            timeNs = std::max(timeNs, times[base + ((heads[slot] - 1) & (samples - 1))]);
+        }
+        uint32_t head = heads[slot];
+        times[base + head] = timeNs;
+        xs[base + head] = x;
+        zs[base + head] = z;
+        heads[slot] = (head + 1) & (samples - 1);
+        counts[slot] = std::min(count + 1, samples);
+    }
+
+    // timeNs 시각의 위치 - 앞뒤 기록을 선형 보간하고, 최신 기록보다 뒤면 최신 위치
+    // 기록보다 오래 전이면 가장 오래된 위치를 쓰고 false (기록이 없으면 x, z를 그대로 둠)
+    bool Sample(uint32_t slot, int64_t timeNs, float& x, float& z) const {
+        if (slot >= counts.size() || counts[slot] == 0) {
+            return true;
+        }
+        size_t base = (size_t)slot * samples;
+        uint32_t mask = samples - 1;
+        uint32_t newer = (heads[slot] - 1) & mask;
+        if (times[base + newer] <= timeNs) {
+            x = xs[base + newer];
+            z = zs[base + newer];
+            return true;
+        }
+        for (uint32_t k = 1; k < counts[slot]; k++) {
+            uint32_t older = (newer - 1) & mask;
+            int64_t olderTime = times[base + older];
+            if (olderTime <= timeNs) {
+                int64_t span = times[base + newer] - olderTime;
+                float t = span > 0 ? (float)(timeNs - olderTime) / (float)span : 1.0f;
+                x = xs[base + older] + (xs[base + newer] - xs[base + older]) * t;
+                z = zs[base + older] + (zs[base + newer] - zs[base + older]) * t;
+                return true;
+            }
+            newer = older;
+        }
+        x = xs[base + newer];
+        z = zs[base + newer];
+        return false;
+    }
+
+private:
+    // 슬롯 수만큼 링 구간 확장
+    void EnsureSlot(uint32_t slot) {
+        size_t wanted = (size_t)slot + 1;
+        if (wanted <= counts.size()) {
+            return;
+        }
+        times.resize(wanted * samples, 0);
+        xs.resize(wanted * samples, 0.0f);
+        zs.resize(wanted * samples, 0.0f);
+        heads.resize(wanted, 0);
+        counts.resize(wanted, 0);
+        viewLags.resize(wanted, 0);
+        stats.historyBytes.store(wanted * BytesPerTank(), std::memory_order_relaxed);
+    }
+
+    LagCompensationConfig config;
+    LagCompensationStats stats;
+    uint32_t samples = 1;
+
+    // 슬롯 s의 기록은 [s * samples, (s + 1) * samples) 구간, heads는 다음에 쓸 위치
+    std::vector<int64_t> times;
+    std::vector<float> xs;
+    std::vector<float> zs;
+    std::vector<uint32_t> heads;
+    std::vector<uint32_t> counts;
+    std::vector<int64_t> viewLags;
+};
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 관찰자별 우선순위 누적 스케줄러 (거리 기반 LOD)
+// 대상 탱크마다 위치가 마지막으로 바뀐 틱(버전)을 두고, 관찰자마다 대상별 누적 우선순위와 마지막으로 보낸 버전을 둡니다.
+// 틱마다 관찰자가 아직 받지 못한 변경이 있는 대상의 누적 값에 가중치를 더하고
+// (nearDistance까지 1, 그 뒤로 거리에 반비례해 minWeight까지 감소, 최근 발사한 탱크는 fireBoost배),
+// 1 이상이 된 대상 중 누적 값이 큰 순서로 budget개까지 보낸 뒤 0으로 되돌립니다.
+// budget이 남으면 가까운 탱크는 매 틱, 가중치 0.1인 먼 탱크는 10틱에 한 번 (20Hz에서 2Hz) 나가고,
+// budget이 모자라면 빈도가 가중치에 비례해 함께 줄어듭니다. 밀린 대상은 누적 값이 계속 커지므로 굶지 않습니다.
+// 관찰자/대상은 TankRegistry 슬롯 번호로 색인하며, 슬롯이 새 탱크에 배정되면 ResetSlot으로 비웁니다.
+
+struct PriorityConfig {
+    int budget = 0;                  // 관찰자당 틱마다 보낼 최대 탱크 수 (0이면 끔)
+    float nearDistance = 20.0f;      // 이 거리까지 가중치 1, 그 뒤로는 nearDistance / 거리
+    float minWeight = 0.1f;          // 가장 낮은 가중치 (기본 값이면 거리 200부터)
+    float fireBoost = 2.0f;          // 최근 발사한 탱크의 가중치 배수
+    uint32_t fireBoostTicks = 20;    // 발사 후 가중치를 올리는 틱 수
+
+    bool Enabled() const { return budget > 0; }
+};
+
+// 보낸 항목 수와 budget을 넘어 다음 틱으로 미룬 항목 수 (atomic - 메트릭 스레드에서 읽음)
+struct PriorityStats {
+    std::atomic<uint64_t> sent{ 0 };
+    std::atomic<uint64_t> deferred{ 0 };
+};
+
+class PriorityScheduler {
+public:
+    void SetConfig(const PriorityConfig& value) { config = value; }
+    const PriorityConfig& Config() const { return config; }
+    const PriorityStats& Stats() const { return stats; }
+
+    // 슬롯이 새 탱크에 배정됨 - 그 슬롯의 관찰자 행을 비우고, 다른 관찰자들의 누적 값도 0으로
+    // 새 관찰자는 접속 직후 OnWorldSnapshot으로 방 전체를 받으므로 현재 버전까지는 받은 것으로 둡니다
+    void ResetSlot(uint32_t slot) {
+        EnsureSlot(slot);
+        versions[slot] = 0;
+        firedTicks[slot] = 0;
+        for (Row& row : rows) {
+            row.priority[slot] = 0.0f;
+            row.sent[slot] = 0;
+        }
+        Row& row = rows[slot];
+        std::fill(row.priority.begin(), row.priority.end(), 0.0f);
+        row.sent = versions;
+    }
+
+    // 대상의 위치가 이번 틱에 바뀜
+    void MarkChanged(uint32_t slot, uint32_t tickId) {
+        EnsureSlot(slot);
+        versions[slot] = tickId;
+    }
+
+    // 대상이 발사함 - fireBoostTicks 동안 가중치를 올림
+    void MarkFired(uint32_t slot, uint32_t tickId) {
+        EnsureSlot(slot);
+        firedTicks[slot] = tickId == 0 ? 1 : tickId;
+    }
+
+    // 관찰자와의 거리 제곱과 최근 발사 여부로 정한 이번 틱 가중치 (가까운 대상은 제곱근 계산 생략)
+    float Weight(uint32_t targetSlot, float distanceSquared, uint32_t tickId) const {
+        float weight = distanceSquared > config.nearDistance * config.nearDistance
+            ? std::max(config.nearDistance / std::sqrt(distanceSquared), config.minWeight) : 1.0f;
+        uint32_t firedTick = firedTicks[targetSlot];
+        if (firedTick != 0 && tickId - firedTick < config.fireBoostTicks) {
+            weight *= config.fireBoost;
+        }
+        return weight;
+    }
+
+    // 관찰자 하나의 이번 틱 선택 시작
+    void BeginObserver(uint32_t observerSlot) {
+        current = &rows[observerSlot];
+        candidates.clear();
+    }
+
+    // 관찰자가 아직 받지 못한 변경이 있는지 (없으면 거리 계산도 건너뜀)
+    bool HasPending(uint32_t targetSlot) const { return current->sent[targetSlot] != versions[targetSlot]; }
+
+    // 대상의 누적 값에 가중치를 더하고, 1 이상이면 이번 틱 후보 (index는 선택될 때 emit에 그대로 넘김)
+    void Accumulate(uint32_t targetSlot, float weight, uint32_t index) {
+        float& priority = current->priority[targetSlot];
+        priority += weight;
+        if (priority >= 1.0f) {
+            candidates.push_back(Candidate{ priority, targetSlot, index });
+        }
+    }
+
+    // 후보 중 누적 값이 큰 budget개를 골라 emit(index)하고 누적 값을 비움 - 보낸 수 반환
+    template <typename Func>
+    size_t Select(Func&& emit) {
+        size_t count = std::min(candidates.size(), (size_t)config.budget);
+        if (candidates.size() > count) {
+            std::nth_element(candidates.begin(), candidates.begin() + count, candidates.end(),
+                             [](const Candidate& a, const Candidate& b) { return a.priority > b.priority; });
+        }
+        for (size_t i = 0; i < count; i++) {
+            uint32_t slot = candidates[i].slot;
+            current->priority[slot] = 0.0f;
+            current->sent[slot] = versions[slot];
+            emit(candidates[i].index);
+        }
+        stats.sent.fetch_add(count, std::memory_order_relaxed);
+        stats.deferred.fetch_add(candidates.size() - count, std::memory_order_relaxed);
+        return count;
+    }
+
+private:
+    struct Row {
+        std::vector<float> priority;
+        std::vector<uint32_t> sent;
+    };
+
+    struct Candidate {
+        float priority;
+        uint32_t slot;
+        uint32_t index;
+    };
+
+    // 슬롯 수만큼 행/열 확장
+    void EnsureSlot(uint32_t slot) {
+        size_t wanted = (size_t)slot + 1;
+        if (wanted <= versions.size()) {
+            return;
+        }
+        versions.resize(wanted, 0);
+        firedTicks.resize(wanted, 0);
+        rows.resize(wanted);
+        for (Row& row : rows) {
+            row.priority.resize(wanted, 0.0f);
+            row.sent.resize(wanted, 0);
+        }
+    }
+
+    PriorityConfig config;
+    PriorityStats stats;
+
+    // 대상 슬롯별 마지막 변경 틱과 마지막 발사 틱 (0이면 없음)
+    std::vector<uint32_t> versions;
+    std::vector<uint32_t> firedTicks;
+
+    // 관찰자 슬롯별 행
+    std::vector<Row> rows;
+
+    // 현재 관찰자와 이번 틱 후보 (틱마다 재사용)
+    Row* current = nullptr;
+    std::vector<Candidate> candidates;
+};
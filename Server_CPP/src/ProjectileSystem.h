@@ -0,0 +1,342 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define TANK_PROJECTILE_AVX2 1
+#define TANK_PROJECTILE_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#define TANK_PROJECTILE_AVX2 1
+#define TANK_PROJECTILE_AVX2_TARGET
+#endif
+
+// 서버 판정 포탄 시뮬레이션
+// SendFire의 방향/발사 힘/발사 높이로 포탄을 만들어 틱마다 중력을 받는 탄도로 적분하고, 탱크와의 충돌을 서버가 판정합니다.
+// 포탄 상태는 필드별 배열(SoA)로 두어 적분 루프가 연속 메모리를 훑고, 충돌 대상 탱크도 틱마다 위치 배열로 복사해
+// 포탄 하나를 탱크 8대씩 AVX2로 비교합니다 (CPU가 AVX2를 지원하지 않거나 x86이 아니면 같은 결과의 스칼라 경로).
+// 탱크 1000대 기준 격자 쿼리가 고른 300m 이상 맵에서는 더 빠르고 무리 지은 맵에서는 비슷하며 100m 밀집 맵에서만 느리지만 (BroadphaseBench),
+// 명중 판정은 살아 있는 탱크와 지연 보상으로 되돌린 위치만 봐야 하고 기본 방 크기에서는 몇 번의 AVX2 반복이면 끝나므로 전체 비교를 유지합니다.
+// 좌표는 탱크 평면 (posX, posY)를 포탄의 (x, z)로, 높이를 y로 쓰며, 방향은 Unity처럼 0도가 +z, 90도가 +x입니다.
+// 발사 위치는 클라이언트가 보낸 값 대신 서버가 아는 탱크 위치를 쓰고 발사 힘은 범위로 제한해, 클라이언트가 판정을 조작하지 못하게 합니다.
+
+struct ProjectileConfig {
+    float tickSeconds = 0.0f;          // 틱 간격 (0이면 끔)
+    float gravity = 9.81f;
+    float launchPitchDegrees = 10.0f;  // 포구 앙각 (SendFire에는 수평 방향만 있음)
+    float minLaunchForce = 15.0f;      // 발사 힘 범위 (초당 속도)
+    float maxLaunchForce = 30.0f;
+    float tankRadius = 1.5f;           // 평면 충돌 반경
+    float tankHeight = 2.0f;           // 이 높이 아래의 포탄만 탱크와 충돌
+    float hitDamage = 25.0f;           // 명중 한 번의 피해
+    float maxLifetimeSeconds = 5.0f;   // 땅에 닿지 않아도 이 시간이 지나면 제거
+    size_t maxProjectiles = 65536;     // 방 하나의 최대 포탄 수 (넘으면 새 포탄은 서버 판정에서 빠짐)
+
+    bool Enabled() const { return tickSeconds > 0.0f; }
+};
+
+// 포탄 누적 값 (atomic - 메트릭 스레드에서 읽음, 쓰기는 월드에 접근하는 스레드 하나만)
+struct ProjectileStats {
+    std::atomic<int> live{ 0 };                 // 지금 날아가는 포탄
+    std::atomic<uint64_t> spawned{ 0 };
+    std::atomic<uint64_t> hits{ 0 };            // 탱크에 맞은 포탄
+    std::atomic<uint64_t> kills{ 0 };           // 명중으로 파괴된 탱크
+    std::atomic<uint64_t> expired{ 0 };         // 땅에 닿거나 수명이 끝난 포탄
+    std::atomic<uint64_t> dropped{ 0 };         // 포탄 수 한도로 만들지 못한 포탄
+    std::atomic<uint64_t> pairTests{ 0 };       // 포탄-탱크 충돌 비교 수
+    std::atomic<uint64_t> ignoredReports{ 0 };  // 서버 판정 중이라 무시한 클라이언트 체력/파괴 보고
+};
+
+// 명중 - 월드가 체력/파괴 이벤트로 바꿈
+struct ProjectileHit {
+    int shooterId;
+    int targetId;
+};
+
+// 충돌 대상 탱크 (틱마다 살아 있는 탱크만 복사, 끝은 8의 배수까지 맞지 않는 값으로 채움)
+struct ProjectileTargets {
+    std::vector<float> x;
+    std::vector<float> z;
+    std::vector<int> hostId;
+    size_t count = 0;
+
+    void Clear() {
+        x.clear();
+        z.clear();
+        hostId.clear();
+        count = 0;
+    }
+
+    void Add(int id, float posX, float posZ) {
+        x.push_back(posX);
+        z.push_back(posZ);
+        hostId.push_back(id);
+        count++;
+    }
+
+    // AVX2 루프가 남은 탱크를 따로 처리하지 않도록 8의 배수까지 채움 (거리가 무한대라 맞지 않음)
+    void Pad() {
+        while (x.size() % 8 != 0) {
+            x.push_back(INFINITY);
+            z.push_back(INFINITY);
+            hostId.push_back(0);
+        }
+    }
+};
+
+// 포탄 하나와 가장 앞 번호의 맞은 탱크 (shooter 제외, 없으면 -1) - 스칼라
+inline int FindProjectileHitScalar(const ProjectileTargets& targets, float px, float pz, int shooter, float radiusSq) {
+    for (size_t i = 0; i < targets.count; i++) {
+        float dx = targets.x[i] - px;
+        float dz = targets.z[i] - pz;
+        if (dx * dx + dz * dz < radiusSq && targets.hostId[i] != shooter) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+#ifdef TANK_PROJECTILE_AVX2
+// 같은 판정을 탱크 8대씩 - 한 블록 안에서 여러 대가 맞으면 가장 앞 번호 (스칼라와 같은 결과)
+TANK_PROJECTILE_AVX2_TARGET
+inline int FindProjectileHitAvx2(const ProjectileTargets& targets, float px, float pz, int shooter, float radiusSq) {
+    const __m256 x = _mm256_set1_ps(px);
+    const __m256 z = _mm256_set1_ps(pz);
+    const __m256 r2 = _mm256_set1_ps(radiusSq);
+    const __m256i self = _mm256_set1_epi32(shooter);
+    const float* tx = targets.x.data();
+    const float* tz = targets.z.data();
+    const int* ids = targets.hostId.data();
+    for (size_t i = 0; i < targets.count; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(tx + i), x);
+        __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(tz + i), z);
+        __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dz, dz));
+        int inside = _mm256_movemask_ps(_mm256_cmp_ps(d2, r2, _CMP_LT_OQ));
+        if (inside == 0) {
+            continue;
+        }
+        __m256i same = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids + i)), self);
+        int mask = inside & ~_mm256_movemask_ps(_mm256_castsi256_ps(same));
+        if (mask != 0) {
+            for (int lane = 0; lane < 8; lane++) {
+                if (mask & (1 << lane)) {
+                    return (int)i + lane;
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+// 실행 중인 CPU와 OS가 AVX2를 쓸 수 있는지 (한 번만 확인)
+inline bool CpuSupportsAvx2() {
+#if defined(_MSC_VER)
+    static const bool supported = []() {
+        int info[4];
+        __cpuid(info, 1);
+        bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6;
+        __cpuidex(info, 7, 0);
+        return osSavesYmm && (info[1] & (1 << 5)) != 0;
+    }();
+    return supported;
+#else
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#endif
+}
+#endif
+
+// ProjectileSystem - 방 하나의 포탄 풀과 틱 단위 적분/충돌
+// 스레드 안전하지 않으며 월드와 같은 스레드에서만 호출합니다
+class ProjectileSystem {
+public:
+    ProjectileSystem() {
+#ifdef TANK_PROJECTILE_AVX2
+        useAvx2 = CpuSupportsAvx2();
+#endif
+    }
+
+    void SetConfig(const ProjectileConfig& value) { config = value; }
+    const ProjectileConfig& Config() const { return config; }
+    const ProjectileStats& Stats() const { return stats; }
+    ProjectileStats& Stats() { return stats; }
+
+    // AVX2 충돌 경로 사용 여부 (지원하지 않는 CPU에서는 켜지지 않음, 벤치마크 비교용)
+    void SetUseAvx2(bool enabled) {
+#ifdef TANK_PROJECTILE_AVX2
+        useAvx2 = enabled && CpuSupportsAvx2();
+#else
+        (void)enabled;
+#endif
+    }
+    bool UsesAvx2() const { return useAvx2; }
+
+    size_t Count() const { return posX.size(); }
+
+    // 포탄 추가 - 높이 height에서 direction(도) 방향으로 launchForce 속도로 발사 (한도를 넘으면 false)
+    bool Spawn(int shooterId, float x, float z, float height, float direction, float launchForce) {
+        if (posX.size() >= config.maxProjectiles) {
+            stats.dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        const float degToRad = 0.017453292f;
+        float speed = std::min(std::max(launchForce, config.minLaunchForce), config.maxLaunchForce);
+        float pitch = config.launchPitchDegrees * degToRad;
+        float yaw = direction * degToRad;
+        float horizontal = speed * std::cos(pitch);
+
+        posX.push_back(x);
+        posY.push_back(std::min(std::max(height, 0.0f), config.tankHeight));
+        posZ.push_back(z);
+        velX.push_back(horizontal * std::sin(yaw));
+        velY.push_back(speed * std::sin(pitch));
+        velZ.push_back(horizontal * std::cos(yaw));
+        shooters.push_back(shooterId);
+        ticksLeft.push_back(std::max(1, (int)(config.maxLifetimeSeconds / config.tickSeconds)));
+        stats.spawned.fetch_add(1, std::memory_order_relaxed);
+        stats.live.store((int)posX.size(), std::memory_order_relaxed);
+        return true;
+    }
+
+    // 한 틱 진행 - 모든 포탄을 적분한 뒤 탱크 높이 아래의 포탄만 targets와 비교
+    // (이번 틱에 땅에 닿은 포탄도 탱크 반경 안이면 명중) 맞은 포탄과 땅에 닿거나 수명이 끝난 포탄은 제거하고,
+    // 명중을 hits에 추가합니다
+    void Step(const ProjectileTargets& targets, std::vector<ProjectileHit>& hits) {
+        Integrate();
+
+        uint64_t tests = 0;
+        uint64_t expired = 0;
+        size_t i = 0;
+        while (i < posX.size()) {
+            if (!Resolve(i, targets, hits, tests, expired)) {
+                i++;
+            }
+        }
+
+        stats.expired.fetch_add(expired, std::memory_order_relaxed);
+        stats.pairTests.fetch_add(tests, std::memory_order_relaxed);
+        stats.live.store((int)posX.size(), std::memory_order_relaxed);
+    }
+
+    // 마지막으로 만든 포탄 하나만 한 틱 진행 - 지연 보상이 발사 직후 쏜 클라이언트가 보던 시각부터 따라잡을 때 사용
+    // (targets는 그 틱 시각으로 되감은 탱크 위치) 맞거나 땅에 닿아 제거되면 false
+    bool StepNewest(const ProjectileTargets& targets, std::vector<ProjectileHit>& hits) {
+        if (posX.empty()) {
+            return false;
+        }
+        const float dt = config.tickSeconds;
+        size_t i = posX.size() - 1;
+        velY[i] -= config.gravity * dt;
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+        posZ[i] += velZ[i] * dt;
+
+        uint64_t tests = 0;
+        uint64_t expired = 0;
+        bool removed = Resolve(i, targets, hits, tests, expired);
+        stats.expired.fetch_add(expired, std::memory_order_relaxed);
+        stats.pairTests.fetch_add(tests, std::memory_order_relaxed);
+        stats.live.store((int)posX.size(), std::memory_order_relaxed);
+        return !removed;
+    }
+
+    void Clear() {
+        posX.clear();
+        posY.clear();
+        posZ.clear();
+        velX.clear();
+        velY.clear();
+        velZ.clear();
+        shooters.clear();
+        ticksLeft.clear();
+        stats.live.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    // 반암시적 오일러 - 속도에 중력을 먼저 더한 뒤 위치 이동 (필드별 루프라 컴파일러가 벡터화)
+    void Integrate() {
+        const float dt = config.tickSeconds;
+        const float dv = config.gravity * dt;
+        const size_t count = posX.size();
+        float* vy = velY.data();
+        for (size_t i = 0; i < count; i++) {
+            vy[i] -= dv;
+        }
+        Advance(posX.data(), velX.data(), count, dt);
+        Advance(posY.data(), vy, count, dt);
+        Advance(posZ.data(), velZ.data(), count, dt);
+    }
+
+    static void Advance(float* position, const float* velocity, size_t count, float dt) {
+        for (size_t i = 0; i < count; i++) {
+            position[i] += velocity[i] * dt;
+        }
+    }
+
+    // 적분을 마친 포탄 i의 충돌/소멸 판정 - 맞거나 땅에 닿거나 수명이 끝나 제거했으면 true
+    bool Resolve(size_t i, const ProjectileTargets& targets, std::vector<ProjectileHit>& hits, uint64_t& tests, uint64_t& expired) {
+        if (posY[i] <= config.tankHeight && targets.count > 0) {
+            tests += targets.count;
+            int target = FindHit(targets, posX[i], posZ[i], shooters[i], config.tankRadius * config.tankRadius);
+            if (target >= 0) {
+                hits.push_back(ProjectileHit{ shooters[i], targets.hostId[target] });
+                stats.hits.fetch_add(1, std::memory_order_relaxed);
+                RemoveAt(i);
+                return true;
+            }
+        }
+        if (posY[i] <= 0.0f || --ticksLeft[i] <= 0) {
+            expired++;
+            RemoveAt(i);
+            return true;
+        }
+        return false;
+    }
+
+    int FindHit(const ProjectileTargets& targets, float px, float pz, int shooter, float radiusSq) const {
+#ifdef TANK_PROJECTILE_AVX2
+        if (useAvx2) {
+            return FindProjectileHitAvx2(targets, px, pz, shooter, radiusSq);
+        }
+#endif
+        return FindProjectileHitScalar(targets, px, pz, shooter, radiusSq);
+    }
+
+    // 마지막 포탄을 i로 옮겨 제거 (순서 유지하지 않음)
+    void RemoveAt(size_t i) {
+        size_t last = posX.size() - 1;
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        posZ[i] = posZ[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        velZ[i] = velZ[last];
+        shooters[i] = shooters[last];
+        ticksLeft[i] = ticksLeft[last];
+        posX.pop_back();
+        posY.pop_back();
+        posZ.pop_back();
+        velX.pop_back();
+        velY.pop_back();
+        velZ.pop_back();
+        shooters.pop_back();
+        ticksLeft.pop_back();
+    }
+
+    ProjectileConfig config;
+    ProjectileStats stats;
+    bool useAvx2 = false;
+
+    // 포탄 상태 (필드별 배열, 같은 인덱스가 포탄 하나)
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> velX, velY, velZ;
+    std::vector<int> shooters;
+    std::vector<int> ticksLeft;
+};
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "GameWorld.h"
+
+// 월드가 내보내는 이벤트 종류 (GameEventSink 메서드와 1:1)
+enum class GameEventType : uint8_t {
+    PlayerJoined,
+    PlayerLeft,
+    TankHealthUpdated,
+    TankDestroyed,
+    TankSpawned,
+    SpawnBullet,
+    TankSnapshot,
+    P2PMessage,
+    TankPositionUpdated,
+    TanksOutOfRange,
+    WorldSnapshot,
+    TankSnapshotCompact,
+    RoomSlots,
+    TankDeltaSnapshot,
+    Count
+};
+
+inline const char* GameEventTypeName(GameEventType type) {
+    static const char* names[] = {
+        "OnPlayerJoined", "OnPlayerLeft", "OnTankHealthUpdated", "OnTankDestroyed",
+        "OnTankSpawned", "OnSpawnBullet", "OnTankSnapshot", "P2PMessage", "OnTankPositionUpdated",
+        "OnTanksOutOfRange", "OnWorldSnapshot", "OnTankSnapshotCompact", "OnRoomSlots",
+        "OnTankDeltaSnapshot"
+    };
+    return (size_t)type < sizeof(names) / sizeof(names[0]) ? names[(size_t)type] : "?";
+}
+
+// 이벤트 종류별 누적 값
+struct GameEventCounters {
+    uint64_t calls = 0;         // 싱크 호출 수 (멀티캐스트 한 번 = 1)
+    uint64_t deliveries = 0;    // 수신자 수 합계 (클라이언트별 전달 건수)
+    uint64_t bytes = 0;         // 예상 전송 바이트 (메시지 크기 x 수신자 수)
+};
+
+// 보관 모드에서 기록하는 이벤트 한 건
+struct RecordedGameEvent {
+    GameEventType type;
+    int clientId;                    // 이벤트 대상 탱크 (스냅샷은 tickId, P2P 메시지는 0)
+    uint32_t messageBytes;           // 수신자 한 명에게 가는 메시지 크기
+    std::vector<int> recipients;
+};
+
+// RecordingEventSink - 네트워크 없이 GameWorld를 구동할 때 쓰는 메모리 내 싱크
+//  - 기본은 종류별 호출 수/전달 건수/예상 바이트만 집계 (벤치마크에서 싱크 비용이 결과를 가리지 않도록)
+//  - SetKeepEvents(true)면 이벤트와 수신자 목록을 순서대로 보관해 검증에 사용
+// 메시지 크기는 RmiID(2바이트) + 인자 크기로 추정하며, ProudNet 헤더/암호화/압축은 포함하지 않습니다.
+class RecordingEventSink : public GameEventSink {
+public:
+    void SetKeepEvents(bool keep) { keepEvents = keep; }
+
+    const GameEventCounters& Counters(GameEventType type) const { return counters[(size_t)type]; }
+    const std::vector<RecordedGameEvent>& Events() const { return events; }
+
+    GameEventCounters Total() const {
+        GameEventCounters total;
+        for (const GameEventCounters& c : counters) {
+            total.calls += c.calls;
+            total.deliveries += c.deliveries;
+            total.bytes += c.bytes;
+        }
+        return total;
+    }
+
+    void Reset() {
+        for (GameEventCounters& c : counters) {
+            c = GameEventCounters();
+        }
+        events.clear();
+    }
+
+    void OnPlayerJoined(const int* recipients, int count, int clientId, float, float, int) override {
+        Record(GameEventType::PlayerJoined, recipients, count, clientId, RmiIdSize + 4 + 4 + 4 + 4);
+    }
+
+    void OnPlayerLeft(const int* recipients, int count, int clientId) override {
+        Record(GameEventType::PlayerLeft, recipients, count, clientId, RmiIdSize + 4);
+    }
+
+    void OnTankHealthUpdated(const int* recipients, int count, int clientId, float, float) override {
+        Record(GameEventType::TankHealthUpdated, recipients, count, clientId, RmiIdSize + 4 + 4 + 4);
+    }
+
+    void OnTankDestroyed(const int* recipients, int count, int clientId, int) override {
+        Record(GameEventType::TankDestroyed, recipients, count, clientId, RmiIdSize + 4 + 4);
+    }
+
+    void OnTankSpawned(const int* recipients, int count, int clientId, float, float, float, int, float) override {
+        Record(GameEventType::TankSpawned, recipients, count, clientId, RmiIdSize + 4 + 4 * 3 + 4 + 4);
+    }
+
+    void OnSpawnBullet(const int* recipients, int count, int clientId, int, float, float, float, float, float, float, float) override {
+        Record(GameEventType::SpawnBullet, recipients, count, clientId, RmiIdSize + 4 + 4 + 4 * 7);
+    }
+
+    void OnTankPositionUpdated(const int* recipients, int count, int clientId, float, float, float) override {
+        Record(GameEventType::TankPositionUpdated, recipients, count, clientId, RmiIdSize + 4 + 4 * 3);
+    }
+
+    void OnTankSnapshot(const int* recipients, int count, int tickId, const uint8_t*, size_t size) override {
+        // tickId + ByteArray 길이 접두사 + 본문
+        Record(GameEventType::TankSnapshot, recipients, count, tickId, RmiIdSize + 4 + 4 + (uint32_t)size);
+    }
+
+    void OnTanksOutOfRange(const int* recipients, int count, int tickId, const uint8_t*, size_t size) override {
+        Record(GameEventType::TanksOutOfRange, recipients, count, tickId, RmiIdSize + 4 + 4 + (uint32_t)size);
+    }
+
+    void OnWorldSnapshot(const int* recipients, int count, int tickId, const uint8_t*, size_t size) override {
+        // 압축 전 크기 (ProudNet 압축은 전송 계층에서 적용)
+        Record(GameEventType::WorldSnapshot, recipients, count, tickId, RmiIdSize + 4 + 4 + (uint32_t)size);
+    }
+
+    void OnTankSnapshotCompact(const int* recipients, int count, int tickId, const uint8_t*, size_t size) override {
+        Record(GameEventType::TankSnapshotCompact, recipients, count, tickId, RmiIdSize + 4 + 4 + (uint32_t)size);
+    }
+
+    void OnRoomSlots(const int* recipients, int count, const uint8_t*, size_t size) override {
+        Record(GameEventType::RoomSlots, recipients, count, 0, RmiIdSize + 4 + (uint32_t)size);
+    }
+
+    void OnTankDeltaSnapshot(const int* recipients, int count, int tickId, int, const uint8_t*, size_t size) override {
+        // tickId + baselineTickId + ByteArray 길이 접두사 + 본문
+        Record(GameEventType::TankDeltaSnapshot, recipients, count, tickId, RmiIdSize + 4 + 4 + 4 + (uint32_t)size);
+    }
+
+    void P2PMessage(const int* recipients, int count, const std::string& message) override {
+        Record(GameEventType::P2PMessage, recipients, count, 0, RmiIdSize + 4 + (uint32_t)message.size());
+    }
+
+    // P2P 그룹은 ID만 발급 (ProudNet처럼 클라이언트 HostID와 겹치지 않는 큰 값)
+    int CreateP2PGroup(const int*, int) override { return nextGroupId++; }
+    bool JoinP2PGroup(int, int) override { return true; }
+    void LeaveP2PGroup(int, int) override {}
+
+private:
+    static const uint32_t RmiIdSize = 2;
+
+    void Record(GameEventType type, const int* recipients, int count, int clientId, uint32_t messageBytes) {
+        GameEventCounters& c = counters[(size_t)type];
+        c.calls++;
+        c.deliveries += (uint64_t)count;
+        c.bytes += (uint64_t)messageBytes * (uint64_t)count;
+
+        if (keepEvents) {
+            RecordedGameEvent event;
+            event.type = type;
+            event.clientId = clientId;
+            event.messageBytes = messageBytes;
+            event.recipients.assign(recipients, recipients + count);
+            events.push_back(std::move(event));
+        }
+    }
+
+    GameEventCounters counters[(size_t)GameEventType::Count];
+    std::vector<RecordedGameEvent> events;
+    bool keepEvents = false;
+    int nextGroupId = 100000;
+};
@@ -0,0 +1,672 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "CompactMove.h"
+#include "MappedFile.h"
+#include "SimCommand.h"
+
+// RMI 캡처 파일 형식 v2 (리틀 엔디언) - mmap으로 열어 힙에 올리지 않고 탐색/재생
+//   파일 헤더 (32바이트): magic "TNKCAP01", version(u32), worldSeed(u32), startUnixMs(u64), blockSize(u32), reserved(u32)
+//   블록 N개 (각 blockSize 바이트 고정, 파일 헤더 바로 뒤부터 순서대로):
+//     블록 헤더 (32바이트): recordCount(u32), usedBytes(u32), firstTimestampNs(u64), lastTimestampNs(u64), reserved(u64)
+//     레코드들 (블록 경계를 넘지 않음, 나머지는 0으로 채움)
+//       레코드 헤더 (20바이트): kind(u8), reserved(u8), rmiId(u16), hostId(i32), timestampNs(u64, 캡처 시작 기준), payloadSize(u32)
+//       이어서 payloadSize 바이트 - RMI 인자 부분 원본 (RmiID 뒤, BeforeDeserialize 시점의 읽기 위치부터)
+//   블록 시간 인덱스 (블록당 24바이트): firstTimestampNs(u64), lastTimestampNs(u64), recordCount(u32), reserved(u32)
+//   HostID 인덱스 (HostID 오름차순, 항목당 24바이트): hostId(i32), recordCount(u32), blockListOffset(u64), blockListCount(u32), reserved(u32)
+//     blockListOffset은 그 HostID의 레코드가 들어 있는 블록 번호(u32) 배열의 파일 오프셋
+//   푸터 (48바이트, 파일 끝): blockIndexOffset(u64), blockCount(u32), blockSize(u32), hostIndexOffset(u64), hostCount(u32),
+//                             reserved(u32), recordCount(u64), magic "TNKIDX02"
+// 레코드는 시각 순서로 추가되므로 블록도 시간순이며, 시각 탐색은 블록 인덱스 이분 탐색 + 블록 안 순차 탐색입니다.
+// 접속/퇴장도 레코드로 남겨 (payload 없음) 재생 시 같은 순서로 월드에 적용합니다.
+// worldSeed는 캡처 중 서버 월드의 난수 시드 (접속 위치) - 재생에서 같은 시드를 쓰면 결과가 같아집니다.
+// 서버가 비정상 종료되어 푸터가 없으면 리더가 블록 헤더를 훑어 시간 인덱스를 다시 만들고, HostID 필터는 전체 블록을 검사합니다.
+static const char RmiCaptureMagic[8] = { 'T', 'N', 'K', 'C', 'A', 'P', '0', '1' };
+static const char RmiCaptureFooterMagic[8] = { 'T', 'N', 'K', 'I', 'D', 'X', '0', '2' };
+static const uint32_t RmiCaptureVersion = 2;
+static const uint32_t RmiCaptureDefaultBlockSize = 64 * 1024;
+static const size_t RmiCaptureFileHeaderSize = 32;
+static const size_t RmiCaptureBlockHeaderSize = 32;
+static const size_t RmiCaptureRecordHeaderSize = 20;
+static const size_t RmiCaptureBlockIndexEntrySize = 24;
+static const size_t RmiCaptureHostIndexEntrySize = 24;
+static const size_t RmiCaptureFooterSize = 48;
+
+enum class CaptureRecordKind : uint8_t {
+    Rmi = 0,
+    Join = 1,
+    Leave = 2,
+};
+
+// 클라이언트 -> 서버 RMI ID (PIDL Tank 범위) - 재생 도구가 ProudNet 헤더 없이 해석하기 위한 사본
+// TankServer.cpp에서 생성된 Tank::Rmi_* 값과 같은지 static_assert로 확인합니다
+namespace CaptureRmiId {
+    static const uint16_t SendMove = 2001;
+    static const uint16_t SendFire = 2002;
+    static const uint16_t SendTankType = 2003;
+    static const uint16_t SendTankHealthUpdated = 2004;
+    static const uint16_t SendTankDestroyed = 2005;
+    static const uint16_t SendTankSpawned = 2006;
+    static const uint16_t P2PMessage = 2014;
+    static const uint16_t SendHello = 2016;
+    static const uint16_t SendMoveCompact = 2019;
+    static const uint16_t SendSnapshotAck = 2023;
+    static const uint16_t SendMoveSequenced = 2024;
+}
+
+struct CaptureRecord {
+    CaptureRecordKind kind;
+    uint16_t rmiId;
+    int hostId;
+    uint64_t timestampNs;
+    const uint8_t* payload;
+    uint32_t payloadSize;
+};
+
+struct RmiCaptureHeader {
+    uint32_t version = 0;
+    uint32_t worldSeed = 0;
+    uint64_t startUnixMs = 0;
+    uint32_t blockSize = 0;
+};
+
+// 블록 하나의 시간 범위 (블록 인덱스 항목)
+struct CaptureBlockInfo {
+    uint64_t firstTimestampNs;
+    uint64_t lastTimestampNs;
+    uint32_t recordCount;
+};
+
+// HostID별 레코드 수 (HostID 인덱스 항목)
+struct CaptureHostInfo {
+    int hostId;
+    uint32_t recordCount;
+    uint32_t blockCount;
+};
+
+// 캡처 조회 조건 - 시각 범위 [fromNs, toNs]와 HostID (0이면 전체)
+struct CaptureFilter {
+    uint64_t fromNs = 0;
+    uint64_t toNs = UINT64_MAX;
+    int hostId = 0;
+};
+
+// 리틀 엔디언 필드 읽기/쓰기 (정렬되지 않은 주소도 안전하도록 memcpy)
+template <typename T>
+inline T LoadCaptureField(const uint8_t* src) {
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return value;
+}
+
+template <typename T>
+inline void StoreCaptureField(uint8_t* dst, T value) {
+    std::memcpy(dst, &value, sizeof(T));
+}
+
+// RmiCaptureWriter - 수신 RMI와 접속/퇴장을 캡처 파일에 추가
+// 여러 ProudNet 워커 스레드에서 호출되므로 짧은 뮤텍스 안에서 현재 블록 버퍼에 쌓고, 블록이 차면 그 자리에서 파일에 씁니다.
+// 블록 인덱스와 HostID 인덱스는 메모리에 모았다가 Close에서 파일 끝에 씁니다 (블록당 수십 바이트).
+// 캡처는 명시적으로 켰을 때만 동작하며, 꺼져 있으면 IsOpen() 확인 비용만 듭니다.
+class RmiCaptureWriter {
+public:
+    ~RmiCaptureWriter() { Close(); }
+
+    bool Open(const std::string& path, uint32_t worldSeed, uint32_t blockSize = RmiCaptureDefaultBlockSize) {
+        Close();
+        std::lock_guard<std::mutex> lock(mutex);
+        file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        uint8_t header[RmiCaptureFileHeaderSize] = {};
+        uint64_t startUnixMs = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        std::memcpy(header, RmiCaptureMagic, sizeof(RmiCaptureMagic));
+        StoreCaptureField(header + 8, RmiCaptureVersion);
+        StoreCaptureField(header + 12, worldSeed);
+        StoreCaptureField(header + 16, startUnixMs);
+        StoreCaptureField(header + 24, blockSize);
+        std::fwrite(header, 1, sizeof(header), file);
+
+        block.assign(blockSize, 0);
+        blockUsed = RmiCaptureBlockHeaderSize;
+        blockRecords = 0;
+        blockIndex.clear();
+        hostBlocks.clear();
+        startNs = SimNowNs();
+        recordCount.store(0, std::memory_order_relaxed);
+        droppedCount.store(0, std::memory_order_relaxed);
+        byteCount.store(sizeof(header), std::memory_order_relaxed);
+        open.store(true, std::memory_order_release);
+        return true;
+    }
+
+    // 남은 블록과 인덱스, 푸터를 쓰고 닫음
+    void Close() {
+        open.store(false, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (file == nullptr) {
+            return;
+        }
+        if (blockRecords > 0) {
+            FlushBlockLocked();
+        }
+        WriteIndexLocked();
+        std::fclose(file);
+        file = nullptr;
+    }
+
+    bool IsOpen() const { return open.load(std::memory_order_acquire); }
+
+    void AppendRmi(int hostId, uint16_t rmiId, const uint8_t* payload, uint32_t payloadSize) {
+        Append(CaptureRecordKind::Rmi, rmiId, hostId, payload, payloadSize);
+    }
+
+    void AppendJoin(int hostId) { Append(CaptureRecordKind::Join, 0, hostId, nullptr, 0); }
+    void AppendLeave(int hostId) { Append(CaptureRecordKind::Leave, 0, hostId, nullptr, 0); }
+
+    // 레코드 시각을 직접 지정 (합성 캡처 생성용, 시각은 증가 순서여야 함)
+    void AppendAt(CaptureRecordKind kind, uint16_t rmiId, int hostId, uint64_t timestampNs,
+                  const uint8_t* payload, uint32_t payloadSize) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (file != nullptr) {
+            AppendLocked(kind, rmiId, hostId, timestampNs, payload, payloadSize);
+        }
+    }
+
+    uint64_t RecordCount() const { return recordCount.load(std::memory_order_relaxed); }
+    uint64_t DroppedCount() const { return droppedCount.load(std::memory_order_relaxed); }
+    uint64_t ByteCount() const { return byteCount.load(std::memory_order_relaxed); }
+
+private:
+    void Append(CaptureRecordKind kind, uint16_t rmiId, int hostId, const uint8_t* payload, uint32_t payloadSize) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (file == nullptr) {
+            return;
+        }
+        // 시각은 잠금 안에서 읽어 파일 안의 레코드 순서와 시각 순서가 일치하도록 함
+        AppendLocked(kind, rmiId, hostId, (uint64_t)(SimNowNs() - startNs), payload, payloadSize);
+    }
+
+    void AppendLocked(CaptureRecordKind kind, uint16_t rmiId, int hostId, uint64_t timestampNs,
+                      const uint8_t* payload, uint32_t payloadSize) {
+        size_t recordSize = RmiCaptureRecordHeaderSize + payloadSize;
+        if (recordSize > block.size() - RmiCaptureBlockHeaderSize) {
+            // 블록보다 큰 레코드는 기록하지 않음 (클라이언트 RMI는 수십 바이트)
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (blockUsed + recordSize > block.size()) {
+            FlushBlockLocked();
+        }
+
+        uint8_t* dst = block.data() + blockUsed;
+        dst[0] = (uint8_t)kind;
+        dst[1] = 0;
+        StoreCaptureField(dst + 2, rmiId);
+        StoreCaptureField(dst + 4, hostId);
+        StoreCaptureField(dst + 8, timestampNs);
+        StoreCaptureField(dst + 16, payloadSize);
+        if (payloadSize > 0) {
+            std::memcpy(dst + RmiCaptureRecordHeaderSize, payload, payloadSize);
+        }
+        blockUsed += recordSize;
+
+        if (blockRecords == 0) {
+            blockFirstNs = timestampNs;
+        }
+        blockLastNs = timestampNs;
+        blockRecords++;
+
+        // HostID별로 이 블록 번호를 한 번만 추가
+        HostEntry& host = hostBlocks[hostId];
+        uint32_t blockNumber = (uint32_t)blockIndex.size();
+        if (host.blocks.empty() || host.blocks.back() != blockNumber) {
+            host.blocks.push_back(blockNumber);
+        }
+        host.recordCount++;
+
+        recordCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 현재 블록을 고정 크기 그대로 파일에 쓰고 인덱스에 추가
+    void FlushBlockLocked() {
+        uint8_t* header = block.data();
+        StoreCaptureField(header, blockRecords);
+        StoreCaptureField(header + 4, (uint32_t)(blockUsed - RmiCaptureBlockHeaderSize));
+        StoreCaptureField(header + 8, blockFirstNs);
+        StoreCaptureField(header + 16, blockLastNs);
+        StoreCaptureField(header + 24, (uint64_t)0);
+        std::fwrite(block.data(), 1, block.size(), file);
+        std::fflush(file);
+        byteCount.fetch_add(block.size(), std::memory_order_relaxed);
+
+        blockIndex.push_back(CaptureBlockInfo{ blockFirstNs, blockLastNs, blockRecords });
+        std::memset(block.data(), 0, block.size());
+        blockUsed = RmiCaptureBlockHeaderSize;
+        blockRecords = 0;
+    }
+
+    void WriteIndexLocked() {
+        uint64_t offset = RmiCaptureFileHeaderSize + (uint64_t)blockIndex.size() * block.size();
+        std::vector<uint8_t> tail;
+
+        uint64_t blockIndexOffset = offset;
+        tail.resize(blockIndex.size() * RmiCaptureBlockIndexEntrySize);
+        for (size_t i = 0; i < blockIndex.size(); i++) {
+            uint8_t* dst = tail.data() + i * RmiCaptureBlockIndexEntrySize;
+            StoreCaptureField(dst, blockIndex[i].firstTimestampNs);
+            StoreCaptureField(dst + 8, blockIndex[i].lastTimestampNs);
+            StoreCaptureField(dst + 16, blockIndex[i].recordCount);
+            StoreCaptureField(dst + 20, (uint32_t)0);
+        }
+
+        // HostID 인덱스 항목 뒤에 블록 번호 배열을 이어 붙임
+        uint64_t hostIndexOffset = blockIndexOffset + tail.size();
+        uint64_t blockListOffset = hostIndexOffset + hostBlocks.size() * RmiCaptureHostIndexEntrySize;
+        size_t entryStart = tail.size();
+        tail.resize(entryStart + hostBlocks.size() * RmiCaptureHostIndexEntrySize);
+        size_t entry = 0;
+        for (const auto& pair : hostBlocks) {
+            uint8_t* dst = tail.data() + entryStart + entry * RmiCaptureHostIndexEntrySize;
+            StoreCaptureField(dst, (int32_t)pair.first);
+            StoreCaptureField(dst + 4, pair.second.recordCount);
+            StoreCaptureField(dst + 8, blockListOffset);
+            StoreCaptureField(dst + 16, (uint32_t)pair.second.blocks.size());
+            StoreCaptureField(dst + 20, (uint32_t)0);
+            blockListOffset += pair.second.blocks.size() * sizeof(uint32_t);
+            entry++;
+        }
+        for (const auto& pair : hostBlocks) {
+            size_t listStart = tail.size();
+            tail.resize(listStart + pair.second.blocks.size() * sizeof(uint32_t));
+            std::memcpy(tail.data() + listStart, pair.second.blocks.data(), pair.second.blocks.size() * sizeof(uint32_t));
+        }
+
+        uint8_t footer[RmiCaptureFooterSize] = {};
+        StoreCaptureField(footer, blockIndexOffset);
+        StoreCaptureField(footer + 8, (uint32_t)blockIndex.size());
+        StoreCaptureField(footer + 12, (uint32_t)block.size());
+        StoreCaptureField(footer + 16, hostIndexOffset);
+        StoreCaptureField(footer + 24, (uint32_t)hostBlocks.size());
+        StoreCaptureField(footer + 32, (uint64_t)recordCount.load(std::memory_order_relaxed));
+        std::memcpy(footer + 40, RmiCaptureFooterMagic, sizeof(RmiCaptureFooterMagic));
+        tail.insert(tail.end(), footer, footer + sizeof(footer));
+
+        std::fwrite(tail.data(), 1, tail.size(), file);
+        byteCount.fetch_add(tail.size(), std::memory_order_relaxed);
+    }
+
+    struct HostEntry {
+        uint32_t recordCount = 0;
+        std::vector<uint32_t> blocks;
+    };
+
+    std::mutex mutex;
+    FILE* file = nullptr;
+    std::vector<uint8_t> block;
+    size_t blockUsed = 0;
+    uint32_t blockRecords = 0;
+    uint64_t blockFirstNs = 0;
+    uint64_t blockLastNs = 0;
+    std::vector<CaptureBlockInfo> blockIndex;
+    std::map<int, HostEntry> hostBlocks;    // HostID 오름차순으로 인덱스를 쓰기 위해 정렬된 map
+    int64_t startNs = 0;
+    std::atomic<bool> open{ false };
+    std::atomic<uint64_t> recordCount{ 0 };
+    std::atomic<uint64_t> droppedCount{ 0 };
+    std::atomic<uint64_t> byteCount{ 0 };
+};
+
+class RmiCaptureReader;
+
+// CaptureCursor - 조건에 맞는 레코드를 시간순으로 순회 (payload는 매핑된 파일을 직접 가리킴)
+class CaptureCursor {
+public:
+    bool Next(CaptureRecord& record);
+
+private:
+    friend class RmiCaptureReader;
+
+    // 후보 순번 -> 블록 번호
+    uint32_t BlockAt(uint32_t index) const {
+        return blockList != nullptr ? LoadCaptureField<uint32_t>(blockList + (size_t)index * sizeof(uint32_t)) : index;
+    }
+
+    const RmiCaptureReader* reader = nullptr;
+    CaptureFilter filter;
+    const uint8_t* blockList = nullptr;   // HostID 인덱스의 블록 번호 배열 (nullptr이면 모든 블록)
+    uint32_t candidateCount = 0;          // 후보 블록 수
+    uint32_t candidate = 0;               // 다음에 읽을 후보 블록
+    const uint8_t* cursor = nullptr;      // 현재 블록 안 다음 레코드
+    const uint8_t* blockEnd = nullptr;
+    bool finished = false;
+};
+
+// RmiCaptureReader - 캡처 파일을 mmap으로 열어 인덱스만 읽고, 레코드는 접근할 때 페이지 단위로 올라옴
+class RmiCaptureReader {
+public:
+    // 파일을 매핑하고 헤더/푸터를 확인, 실패 시 false와 error 설정
+    bool Open(const std::string& path, std::string& error) {
+        blockIndexData = nullptr;
+        hostIndexData = nullptr;
+        recoveredIndex.clear();
+        if (!file.Open(path, error)) {
+            return false;
+        }
+        const uint8_t* data = file.Data();
+        size_t size = file.Size();
+
+        if (size < RmiCaptureFileHeaderSize || std::memcmp(data, RmiCaptureMagic, sizeof(RmiCaptureMagic)) != 0) {
+            error = "not a tank RMI capture file";
+            return false;
+        }
+        header.version = LoadCaptureField<uint32_t>(data + 8);
+        header.worldSeed = LoadCaptureField<uint32_t>(data + 12);
+        header.startUnixMs = LoadCaptureField<uint64_t>(data + 16);
+        header.blockSize = LoadCaptureField<uint32_t>(data + 24);
+        if (header.version != RmiCaptureVersion) {
+            error = "unsupported capture version " + std::to_string(header.version) + " (expected " 
+                  + std::to_string(RmiCaptureVersion) + ")";
+            return false;
+        }
+        if (header.blockSize <= RmiCaptureBlockHeaderSize) {
+            error = "invalid block size";
+            return false;
+        }
+
+        if (!LoadFooter()) {
+            RecoverIndex();
+        }
+        return true;
+    }
+
+    const RmiCaptureHeader& Header() const { return header; }
+
+    // 푸터 없이 블록을 훑어 인덱스를 다시 만들었는지 (캡처 중 비정상 종료)
+    bool Recovered() const { return blockIndexData == recoveredIndex.data() && !recoveredIndex.empty(); }
+
+    uint32_t BlockCount() const { return blockCount; }
+    uint64_t RecordCount() const { return recordCount; }
+    uint32_t HostCount() const { return hostCount; }
+
+    CaptureBlockInfo Block(uint32_t index) const {
+        const uint8_t* src = blockIndexData + (size_t)index * RmiCaptureBlockIndexEntrySize;
+        return CaptureBlockInfo{ LoadCaptureField<uint64_t>(src), LoadCaptureField<uint64_t>(src + 8),
+                                 LoadCaptureField<uint32_t>(src + 16) };
+    }
+
+    CaptureHostInfo Host(uint32_t index) const {
+        const uint8_t* src = hostIndexData + (size_t)index * RmiCaptureHostIndexEntrySize;
+        return CaptureHostInfo{ LoadCaptureField<int32_t>(src), LoadCaptureField<uint32_t>(src + 4),
+                                LoadCaptureField<uint32_t>(src + 16) };
+    }
+
+    // 캡처 전체 시간 범위 (마지막 레코드 시각)
+    uint64_t EndTimestampNs() const { return blockCount > 0 ? Block(blockCount - 1).lastTimestampNs : 0; }
+
+    // 조건에 맞는 레코드 순회 시작 - 시작 블록은 블록 인덱스 이분 탐색으로 찾음
+    CaptureCursor Query(const CaptureFilter& filter) const {
+        CaptureCursor result;
+        result.reader = this;
+        result.filter = filter;
+        result.candidateCount = blockCount;
+
+        if (filter.hostId != 0 && hostIndexData != nullptr) {
+            // HostID 인덱스도 HostID 오름차순이므로 이분 탐색
+            uint32_t lo = 0, hi = hostCount;
+            while (lo < hi) {
+                uint32_t mid = (lo + hi) / 2;
+                if (Host(mid).hostId < filter.hostId) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            if (lo == hostCount || Host(lo).hostId != filter.hostId) {
+                result.finished = true;
+                return result;
+            }
+            const uint8_t* entry = hostIndexData + (size_t)lo * RmiCaptureHostIndexEntrySize;
+            result.blockList = file.Data() + LoadCaptureField<uint64_t>(entry + 8);
+            result.candidateCount = LoadCaptureField<uint32_t>(entry + 16);
+        }
+
+        // lastTimestampNs >= fromNs인 첫 후보 블록
+        uint32_t lo = 0, hi = result.candidateCount;
+        while (lo < hi) {
+            uint32_t mid = (lo + hi) / 2;
+            if (Block(result.BlockAt(mid)).lastTimestampNs < filter.fromNs) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        result.candidate = lo;
+        return result;
+    }
+
+    // 전체 레코드 순회
+    CaptureCursor All() const { return Query(CaptureFilter()); }
+
+    const uint8_t* BlockData(uint32_t index) const {
+        return file.Data() + RmiCaptureFileHeaderSize + (size_t)index * header.blockSize;
+    }
+
+private:
+    bool LoadFooter() {
+        const uint8_t* data = file.Data();
+        size_t size = file.Size();
+        if (size < RmiCaptureFileHeaderSize + RmiCaptureFooterSize) {
+            return false;
+        }
+        const uint8_t* footer = data + size - RmiCaptureFooterSize;
+        if (std::memcmp(footer + 40, RmiCaptureFooterMagic, sizeof(RmiCaptureFooterMagic)) != 0) {
+            return false;
+        }
+        uint64_t blockIndexOffset = LoadCaptureField<uint64_t>(footer);
+        uint64_t hostIndexOffset = LoadCaptureField<uint64_t>(footer + 16);
+        blockCount = LoadCaptureField<uint32_t>(footer + 8);
+        hostCount = LoadCaptureField<uint32_t>(footer + 24);
+        recordCount = LoadCaptureField<uint64_t>(footer + 32);
+        if (blockIndexOffset + (uint64_t)blockCount * RmiCaptureBlockIndexEntrySize > size
+            || hostIndexOffset + (uint64_t)hostCount * RmiCaptureHostIndexEntrySize > size) {
+            return false;
+        }
+        blockIndexData = data + blockIndexOffset;
+        hostIndexData = data + hostIndexOffset;
+        return true;
+    }
+
+    // 푸터가 없으면 완전히 기록된 블록의 헤더만 훑어 시간 인덱스를 만듦 (HostID 인덱스는 없음)
+    void RecoverIndex() {
+        size_t size = file.Size();
+        blockCount = 0;
+        recordCount = 0;
+        hostCount = 0;
+        uint64_t available = size > RmiCaptureFileHeaderSize ? (size - RmiCaptureFileHeaderSize) / header.blockSize : 0;
+        for (uint64_t i = 0; i < available; i++) {
+            const uint8_t* block = BlockData((uint32_t)i);
+            uint32_t records = LoadCaptureField<uint32_t>(block);
+            if (records == 0) {
+                break;
+            }
+            size_t offset = recoveredIndex.size();
+            recoveredIndex.resize(offset + RmiCaptureBlockIndexEntrySize);
+            std::memcpy(recoveredIndex.data() + offset, block + 8, 16);
+            StoreCaptureField(recoveredIndex.data() + offset + 16, records);
+            StoreCaptureField(recoveredIndex.data() + offset + 20, (uint32_t)0);
+            blockCount++;
+            recordCount += records;
+        }
+        blockIndexData = recoveredIndex.data();
+        hostIndexData = nullptr;
+    }
+
+    friend class CaptureCursor;
+
+    MappedFile file;
+    RmiCaptureHeader header;
+    const uint8_t* blockIndexData = nullptr;
+    const uint8_t* hostIndexData = nullptr;
+    std::vector<uint8_t> recoveredIndex;
+    uint32_t blockCount = 0;
+    uint32_t hostCount = 0;
+    uint64_t recordCount = 0;
+};
+
+inline bool CaptureCursor::Next(CaptureRecord& record) {
+    while (!finished) {
+        if (cursor == blockEnd) {
+            if (candidate >= candidateCount) {
+                finished = true;
+                break;
+            }
+            uint32_t blockNumber = BlockAt(candidate++);
+            const uint8_t* block = reader->BlockData(blockNumber);
+            cursor = block + RmiCaptureBlockHeaderSize;
+            blockEnd = cursor + LoadCaptureField<uint32_t>(block + 4);
+            continue;
+        }
+
+        const uint8_t* src = cursor;
+        record.kind = (CaptureRecordKind)src[0];
+        record.rmiId = LoadCaptureField<uint16_t>(src + 2);
+        record.hostId = LoadCaptureField<int32_t>(src + 4);
+        record.timestampNs = LoadCaptureField<uint64_t>(src + 8);
+        record.payloadSize = LoadCaptureField<uint32_t>(src + 16);
+        record.payload = src + RmiCaptureRecordHeaderSize;
+        cursor += RmiCaptureRecordHeaderSize + record.payloadSize;
+
+        if (record.timestampNs > filter.toNs) {
+            finished = true;
+            break;
+        }
+        if (record.timestampNs < filter.fromNs || (filter.hostId != 0 && record.hostId != filter.hostId)) {
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+// 캡처 payload 읽기 도우미 - ProudNet은 int/float를 리틀 엔디언 4바이트 그대로 직렬화
+class CapturePayloadReader {
+public:
+    CapturePayloadReader(const uint8_t* data, uint32_t size) : data(data), size(size), offset(0) {}
+
+    template <typename T>
+    bool Read(T& value) {
+        if (offset + sizeof(T) > size) {
+            return false;
+        }
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+private:
+    const uint8_t* data;
+    uint32_t size;
+    uint32_t offset;
+};
+
+// 캡처 레코드를 월드 명령으로 변환 (지원하지 않는 RMI나 잘린 payload면 false)
+// P2PMessage는 ProudNet 문자열 직렬화를 해석하지 않고 payload 바이트를 그대로 메시지로 씁니다 (릴레이 크기/팬아웃은 같음).
+// 메시지 문자열은 message로 넘긴 객체를 가리키므로 명령을 적용할 때까지 유지되어야 합니다.
+template <typename MessageT>
+bool DecodeCaptureRecord(const CaptureRecord& record, SimCommand<MessageT>& command, MessageT& message) {
+    command.remote = record.hostId;
+    command.enqueueNs = 0;
+    if (record.kind == CaptureRecordKind::Join) {
+        command.type = SimCommandType::Join;
+        return true;
+    }
+    if (record.kind == CaptureRecordKind::Leave) {
+        command.type = SimCommandType::Leave;
+        return true;
+    }
+    if (record.kind != CaptureRecordKind::Rmi) {
+        return false;
+    }
+
+    CapturePayloadReader reader(record.payload, record.payloadSize);
+    switch (record.rmiId) {
+    case CaptureRmiId::SendMove:
+        command.type = SimCommandType::Move;
+        return reader.Read(command.pose.posX) && reader.Read(command.pose.posY) && reader.Read(command.pose.direction);
+    case CaptureRmiId::SendFire:
+        command.type = SimCommandType::Fire;
+        return reader.Read(command.fire.shooterId) && reader.Read(command.fire.direction) && reader.Read(command.fire.launchForce)
+            && reader.Read(command.fire.fireX) && reader.Read(command.fire.fireY) && reader.Read(command.fire.fireZ);
+    case CaptureRmiId::SendTankType:
+        command.type = SimCommandType::TankType;
+        return reader.Read(command.tankType);
+    case CaptureRmiId::SendTankHealthUpdated:
+        command.type = SimCommandType::HealthUpdated;
+        return reader.Read(command.health.currentHealth) && reader.Read(command.health.maxHealth);
+    case CaptureRmiId::SendTankDestroyed:
+        command.type = SimCommandType::Destroyed;
+        return reader.Read(command.destroyedById);
+    case CaptureRmiId::SendTankSpawned:
+        command.type = SimCommandType::Spawned;
+        return reader.Read(command.spawn.posX) && reader.Read(command.spawn.posY) && reader.Read(command.spawn.direction)
+            && reader.Read(command.spawn.tankType) && reader.Read(command.spawn.initialHealth);
+    case CaptureRmiId::SendMoveCompact: {
+        int16_t posX = 0, posY = 0;
+        uint8_t direction = 0;
+        if (!reader.Read(posX) || !reader.Read(posY) || !reader.Read(direction)) {
+            return false;
+        }
+        command.type = SimCommandType::Move;
+        command.pose = SimPoseArgs{ DequantizePosition(posX, CompactMapOriginX), DequantizePosition(posY, CompactMapOriginY),
+                                    DequantizeDirection(direction) };
+        return true;
+    }
+    case CaptureRmiId::SendMoveSequenced: {
+        uint16_t sequence = 0;
+        int16_t posX = 0, posY = 0;
+        uint8_t direction = 0;
+        if (!reader.Read(sequence) || !reader.Read(posX) || !reader.Read(posY) || !reader.Read(direction)) {
+            return false;
+        }
+        command.type = SimCommandType::MoveSequenced;
+        command.sequencedMove.pose = SimPoseArgs{ DequantizePosition(posX, CompactMapOriginX), DequantizePosition(posY, CompactMapOriginY),
+                                                  DequantizeDirection(direction) };
+        command.sequencedMove.sequence = sequence;
+        return true;
+    }
+    case CaptureRmiId::SendSnapshotAck: {
+        // 재생에서는 틱 번호가 캡처 때와 다를 수 있으며, 기록에 없는 틱이면 서버가 전체 스냅샷으로 대체
+        int tickId = 0;
+        if (!reader.Read(tickId)) {
+            return false;
+        }
+        command.type = SimCommandType::SnapshotAck;
+        command.ackTickId = (uint32_t)tickId;
+        return true;
+    }
+    case CaptureRmiId::P2PMessage:
+        command.type = SimCommandType::P2PMessage;
+        message.assign((const char*)record.payload, record.payloadSize);
+        command.message = &message;
+        return true;
+    case CaptureRmiId::SendHello:
+        command.type = SimCommandType::Hello;
+        return reader.Read(command.protocolRevision);
+    default:
+        return false;
+    }
+}
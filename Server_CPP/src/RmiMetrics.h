@@ -0,0 +1,243 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// 지연 시간 히스토그램 스냅샷 (복사본) - 퍼센타일 계산과 구간 차이 계산에 사용
+struct LatencyHistogramSnapshot {
+    std::vector<uint64_t> buckets;
+    uint64_t count = 0;
+    uint64_t sumNs = 0;
+    uint64_t maxNs = 0;
+
+    // q (0~1) 퍼센타일 값 (ns) - 해당 버킷의 상한, 최대값을 넘지 않음
+    uint64_t ValueAtQuantile(double q) const;
+
+    // this - older (구간 통계, maxNs는 this의 값 유지)
+    LatencyHistogramSnapshot Since(const LatencyHistogramSnapshot& older) const {
+        LatencyHistogramSnapshot result = *this;
+        if (older.buckets.size() == buckets.size()) {
+            for (size_t i = 0; i < buckets.size(); i++) {
+                result.buckets[i] -= older.buckets[i];
+            }
+        }
+        result.count -= older.count;
+        result.sumNs -= older.sumNs;
+        return result;
+    }
+
+    double AverageNs() const { return count > 0 ? (double)sumNs / count : 0.0; }
+};
+
+// LatencyHistogram - HDR 방식의 log-linear 히스토그램 (ns 단위, lock-free 기록)
+//  - 2의 거듭제곱 구간마다 16개 하위 버킷 -> 상대 오차 약 6%, 1ns ~ 약 1000초
+//  - Record는 relaxed fetch_add 뿐이므로 여러 워커 스레드에서 동시에 호출 가능
+//  - 값은 누적만 되며 (Prometheus 카운터처럼), 구간 통계는 스냅샷 차이로 계산
+class LatencyHistogram {
+public:
+    static const int SubBucketBits = 4;
+    static const int SubBucketCount = 1 << SubBucketBits;
+    static const int MaxExponent = 40;
+    static const int BucketCount = (MaxExponent - SubBucketBits + 2) * SubBucketCount;
+
+    LatencyHistogram() {
+        for (int i = 0; i < BucketCount; i++) {
+            buckets[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void Record(uint64_t valueNs) {
+        buckets[BucketIndex(valueNs)].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        sumNs.fetch_add(valueNs, std::memory_order_relaxed);
+        uint64_t currentMax = maxNs.load(std::memory_order_relaxed);
+        while (valueNs > currentMax && !maxNs.compare_exchange_weak(currentMax, valueNs, std::memory_order_relaxed)) {
+        }
+    }
+
+    LatencyHistogramSnapshot Snapshot() const {
+        LatencyHistogramSnapshot result;
+        result.buckets.resize(BucketCount);
+        for (int i = 0; i < BucketCount; i++) {
+            result.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+        }
+        result.count = count.load(std::memory_order_relaxed);
+        result.sumNs = sumNs.load(std::memory_order_relaxed);
+        result.maxNs = maxNs.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    static int BucketIndex(uint64_t value) {
+        if (value < (uint64_t)SubBucketCount) {
+            return (int)value;
+        }
+        int exponent = HighestBit(value);
+        if (exponent > MaxExponent) {
+            return BucketCount - 1;
+        }
+        int sub = (int)((value >> (exponent - SubBucketBits)) & (SubBucketCount - 1));
+        return (exponent - SubBucketBits + 1) * SubBucketCount + sub;
+    }
+
+    // 버킷에 들어가는 가장 작은 값
+    static uint64_t BucketLowerBound(int index) {
+        if (index < SubBucketCount) {
+            return (uint64_t)index;
+        }
+        int exponent = index / SubBucketCount + SubBucketBits - 1;
+        int sub = index % SubBucketCount;
+        return (uint64_t)(SubBucketCount + sub) << (exponent - SubBucketBits);
+    }
+
+    // 버킷에 들어가는 가장 큰 값
+    static uint64_t BucketUpperBound(int index) {
+        if (index + 1 >= BucketCount) {
+            return UINT64_MAX;
+        }
+        return BucketLowerBound(index + 1) - 1;
+    }
+
+private:
+    static int HighestBit(uint64_t value) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return (int)index;
+#else
+        return 63 - __builtin_clzll(value);
+#endif
+    }
+
+    std::atomic<uint64_t> buckets[BucketCount];
+    std::atomic<uint64_t> count{ 0 };
+    std::atomic<uint64_t> sumNs{ 0 };
+    std::atomic<uint64_t> maxNs{ 0 };
+};
+
+inline uint64_t LatencyHistogramSnapshot::ValueAtQuantile(double q) const {
+    if (count == 0 || buckets.empty()) {
+        return 0;
+    }
+    uint64_t target = (uint64_t)(q * (double)count + 0.5);
+    if (target < 1) {
+        target = 1;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        seen += buckets[i];
+        if (seen >= target) {
+            uint64_t upper = LatencyHistogram::BucketUpperBound((int)i);
+            return (maxNs > 0 && upper > maxNs) ? maxNs : upper;
+        }
+    }
+    return maxNs;
+}
+
+// RMI 한 종류의 누적 통계
+struct RmiTypeStats {
+    std::string name;
+    int rmiId = 0;
+    uint64_t calls = 0;             // 핸들러 호출 수 (프로파일링 훅 기준)
+    uint64_t messages = 0;          // 수신 메시지 수 (역직렬화 직전 기준)
+    uint64_t bytes = 0;             // 수신 바이트 (RmiID 헤더 포함 메시지 길이)
+    LatencyHistogramSnapshot latency;
+};
+
+// RmiMetrics - RMI ID별 호출 수, 수신 바이트, 핸들러 처리 시간 히스토그램
+// 등록된 ID 범위 [firstId, firstId + count) 를 배열로 두어 조회에 해시가 필요 없습니다.
+// 처리 시간은 steady_clock (ns) 기준이라 ms 미만 핸들러도 측정됩니다.
+// 같은 스레드에서 BeginCall -> EndCall 순서로 호출되어야 합니다 (스텁 훅은 핸들러를 감싸 같은 스레드에서 호출됨).
+class RmiMetrics {
+public:
+    RmiMetrics(int firstId, int count) : firstId(firstId), entries(count > 0 ? count : 0) {}
+
+    RmiMetrics(const RmiMetrics&) = delete;
+    RmiMetrics& operator=(const RmiMetrics&) = delete;
+
+    void SetName(int rmiId, const char* name) {
+        Entry* entry = Find(rmiId);
+        if (entry != nullptr) {
+            entry->name = name;
+        }
+    }
+
+    void RecordReceived(int rmiId, uint64_t bytes) {
+        Entry* entry = Find(rmiId);
+        if (entry != nullptr) {
+            entry->messages.fetch_add(1, std::memory_order_relaxed);
+            entry->bytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    void BeginCall() {
+        CallStartNs() = NowNs();
+    }
+
+    void EndCall(int rmiId) {
+        int64_t elapsedNs = NowNs() - CallStartNs();
+        Entry* entry = Find(rmiId);
+        if (entry != nullptr) {
+            entry->calls.fetch_add(1, std::memory_order_relaxed);
+            entry->latency.Record(elapsedNs > 0 ? (uint64_t)elapsedNs : 0);
+        }
+    }
+
+    // 메시지를 한 번이라도 받은 RMI의 누적 통계
+    std::vector<RmiTypeStats> Snapshot() const {
+        std::vector<RmiTypeStats> result;
+        for (size_t i = 0; i < entries.size(); i++) {
+            const Entry& entry = entries[i];
+            uint64_t messages = entry.messages.load(std::memory_order_relaxed);
+            uint64_t calls = entry.calls.load(std::memory_order_relaxed);
+            if (messages == 0 && calls == 0) {
+                continue;
+            }
+            RmiTypeStats stats;
+            stats.rmiId = firstId + (int)i;
+            stats.name = entry.name.empty() ? "Rmi_" + std::to_string(stats.rmiId) : entry.name;
+            stats.calls = calls;
+            stats.messages = messages;
+            stats.bytes = entry.bytes.load(std::memory_order_relaxed);
+            stats.latency = entry.latency.Snapshot();
+            result.push_back(stats);
+        }
+        return result;
+    }
+
+    static int64_t NowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    struct Entry {
+        std::string name;
+        std::atomic<uint64_t> calls{ 0 };
+        std::atomic<uint64_t> messages{ 0 };
+        std::atomic<uint64_t> bytes{ 0 };
+        LatencyHistogram latency;
+    };
+
+    Entry* Find(int rmiId) {
+        int index = rmiId - firstId;
+        if (index < 0 || index >= (int)entries.size()) {
+            return nullptr;
+        }
+        return &entries[index];
+    }
+
+    static int64_t& CallStartNs() {
+        thread_local int64_t startNs = 0;
+        return startNs;
+    }
+
+    int firstId;
+    std::vector<Entry> entries;
+};
@@ -0,0 +1,652 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "AsyncLog.h"
+#include "GameWorld.h"
+#include "LockStats.h"
+#include "Matchmaker.h"
+#include "MpscQueue.h"
+#include "RmiMetrics.h"
+#include "SimCommand.h"
+#include "TickLoop.h"
+
+// 방 단위 샤딩
+// 방마다 GameWorld(탱크 레지스트리, P2P 그룹, 스냅샷 상태)를 따로 두고, 방을 만들 때 워커 스레드 하나에 고정합니다.
+// actor 모드에서 워커는 자기 방들로 가는 명령 큐와 틱 루프를 하나씩 가지며, 틱 사이에 큐를 비우고 틱마다 자기 방들의 스냅샷을 보냅니다.
+// 방의 월드는 그 워커만 만지므로 서로 다른 워커의 방은 잠금을 공유하지 않고, 워커 수만큼 코어를 씁니다.
+// lock 모드에서는 방마다 뮤텍스를 두고 핸들러가 직접 적용하며, 워커는 방 뮤텍스를 잡고 틱만 실행합니다.
+// 접속한 클라이언트는 Matchmaker가 모아서 방에 배정하고 (방 생성/종료도 매치메이커 스레드),
+// 핸들러 스레드는 HostID -> 방 디렉터리(구간별 잠금)로 명령을 보낼 방을 찾습니다.
+
+// 방 하나의 누적 값 (atomic - 메트릭 스레드에서 읽음, 쓰기는 방의 월드에 접근하는 스레드 하나만)
+struct RoomStats {
+    std::atomic<int> tanks{ 0 };
+    std::atomic<uint64_t> commands[SimCommandTypeCount];   // 적용한 명령 수 (종류별)
+    LatencyHistogram tickDuration;                          // 틱마다 방 하나를 처리한 시간 (스냅샷 전송 포함)
+
+    RoomStats() {
+        for (std::atomic<uint64_t>& count : commands) {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Room - 월드 하나와 그 이벤트 싱크, 통계, lock 모드용 뮤텍스
+class Room {
+public:
+    Room(int id, int worker, const MatchKey& key, std::unique_ptr<GameEventSink> eventSink, float interestRadius)
+        : id(id), worker(worker), key(key), sink(std::move(eventSink)), world(*sink, interestRadius) {}
+
+    Room(const Room&) = delete;
+    Room& operator=(const Room&) = delete;
+
+    int Id() const { return id; }
+    int Worker() const { return worker; }
+    const MatchKey& Key() const { return key; }
+    GameWorld& World() { return world; }
+    const GameWorld& World() const { return world; }
+    const RoomStats& Stats() const { return stats; }
+    MeasuredMutex& Mutex() { return mutex; }
+
+    // 배정된 클라이언트 수 (늘리는 것은 매치메이커 스레드, 줄이는 것은 퇴장 처리 스레드)
+    int Members() const { return members.load(std::memory_order_acquire); }
+    void AddMember() { members.fetch_add(1, std::memory_order_relaxed); }
+    void RemoveMember() { members.fetch_sub(1, std::memory_order_release); }
+
+    // 명령 하나 적용 (월드 접근이 직렬화된 상태에서만)
+    void Apply(const GameCommand& command) {
+        if (command.type == SimCommandType::PrintStatus) {
+            DebugLog("---------- Room " + std::to_string(id) + " (worker " + std::to_string(worker) + ") ----------");
+        }
+        world.Apply(command);
+
+        std::atomic<uint64_t>& count = stats.commands[(size_t)command.type];
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (command.type == SimCommandType::Join || command.type == SimCommandType::Leave) {
+            stats.tanks.store((int)world.TankCount(), std::memory_order_relaxed);
+        }
+    }
+
+    // 스냅샷 틱 (처리 시간 기록)
+    void Tick(uint32_t tickId) {
+        int64_t start = RmiMetrics::NowNs();
+        world.BroadcastSnapshot(tickId);
+        stats.tickDuration.Record((uint64_t)(RmiMetrics::NowNs() - start));
+    }
+
+private:
+    int id;
+    int worker;
+    MatchKey key;
+    std::atomic<int> members{ 0 };
+    std::unique_ptr<GameEventSink> sink;
+    GameWorld world;
+    RoomStats stats;
+    MeasuredMutex mutex;
+};
+
+// 명령 적용 후 P2P 메시지 해제 (명령을 넘긴 쪽 대신)
+inline void ReleaseRoomCommand(const GameCommand& command) {
+    if (command.type == SimCommandType::P2PMessage) {
+        delete command.message;
+    }
+}
+
+// RoomDirectory - HostID -> 방 (핸들러 스레드가 RMI마다 조회)
+// HostID로 나눈 구간마다 잠금을 따로 두어, 서로 다른 클라이언트의 조회가 한 잠금에 몰리지 않게 합니다.
+// 매치메이커가 방을 정하기 전(배정 대기)에 온 명령은 항목에 모아 두었다가, 배정할 때 Join 뒤에 순서대로 넘깁니다
+class RoomDirectory {
+public:
+    // 배정 대기 중인 클라이언트 등록
+    void AddPending(int hostId) {
+        Stripe& stripe = StripeOf(hostId);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        Entry& entry = stripe.entries[hostId];
+        entry.room = nullptr;
+        DiscardPending(entry);
+    }
+
+    // 배정된 방에 대해 구간 잠금 안에서 func(room) 호출 (배정 대기 중이거나 없으면 호출하지 않고 false)
+    template <typename Func>
+    bool Visit(int hostId, Func&& func) {
+        Stripe& stripe = StripeOf(hostId);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        auto it = stripe.entries.find(hostId);
+        if (it == stripe.entries.end() || it->second.room == nullptr) {
+            return false;
+        }
+        func(*it->second.room);
+        return true;
+    }
+
+    // 명령을 클라이언트의 방으로 - 배정됐으면 구간 잠금 안에서 deliver(room, command),
+    // 배정 대기 중이면 모아 둠(한도를 넘으면 버림). 접속 중이 아니면 false
+    // 항목의 Room*는 구간 잠금을 잡은 동안에만 유효합니다. 항목이 남아 있는 동안은 그 클라이언트가 방 인원에
+    // 포함되어 방이 닫히지 않지만, 잠금을 놓으면 Remove와 Leave 뒤 인원이 0이 되어 매치메이커가 방을 닫을 수 있음
+    // 그래서 Place처럼 잠금 안에서 넘겨, Remove 뒤에는 명령이 그 방에 닿지 않고 Leave를 앞지르지도 않게 합니다
+    template <typename Deliver>
+    bool Route(GameCommand& command, Deliver&& deliver) {
+        Stripe& stripe = StripeOf(command.remote);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        auto it = stripe.entries.find(command.remote);
+        if (it == stripe.entries.end()) {
+            return false;
+        }
+        Entry& entry = it->second;
+        if (entry.room != nullptr) {
+            deliver(*entry.room, command);
+            return true;
+        }
+
+        if (entry.pending.size() < PendingLimit) {
+            entry.pending.push_back(command);
+        } else {
+            ReleaseRoomCommand(command);
+        }
+        return true;
+    }
+
+    // 배정 대기 중인 클라이언트를 방에 배정 - 구간 잠금 안에서 deliver(Join)와 모아 둔 명령을 순서대로 넘긴 뒤 방을 기록
+    // (그 사이 들어온 RMI가 Join이나 모아 둔 명령을 앞지르지 않게 함) 이미 퇴장했으면 false
+    template <typename Deliver>
+    bool Place(int hostId, Room* room, Deliver&& deliver) {
+        Stripe& stripe = StripeOf(hostId);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        auto it = stripe.entries.find(hostId);
+        if (it == stripe.entries.end() || it->second.room != nullptr) {
+            return false;
+        }
+
+        Entry& entry = it->second;
+        GameCommand join;
+        join.type = SimCommandType::Join;
+        join.remote = hostId;
+        join.enqueueNs = 0;
+        deliver(join);
+        for (GameCommand& command : entry.pending) {
+            deliver(command);
+        }
+        entry.pending.clear();
+        entry.room = room;
+        return true;
+    }
+
+    // 퇴장 - 배정된 방 반환 (배정 대기 중이었으면 모아 둔 명령을 버리고 wasPending을 true로)
+    Room* Remove(int hostId, bool& wasPending) {
+        Stripe& stripe = StripeOf(hostId);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        wasPending = false;
+        auto it = stripe.entries.find(hostId);
+        if (it == stripe.entries.end()) {
+            return nullptr;
+        }
+        Room* room = it->second.room;
+        wasPending = room == nullptr;
+        DiscardPending(it->second);
+        stripe.entries.erase(it);
+        return room;
+    }
+
+private:
+    static const size_t StripeCount = 64;
+    static const size_t PendingLimit = 64;   // 배정 대기 중인 클라이언트 하나가 모아 두는 명령 수
+
+    struct Entry {
+        Room* room = nullptr;                // nullptr이면 배정 대기 중
+        std::vector<GameCommand> pending;
+    };
+
+    // 구간마다 캐시 라인을 따로 써서 이웃 구간의 잠금과 거짓 공유하지 않도록 함
+    struct alignas(64) Stripe {
+        std::mutex mutex;
+        std::unordered_map<int, Entry> entries;
+    };
+
+    static void DiscardPending(Entry& entry) {
+        for (const GameCommand& command : entry.pending) {
+            ReleaseRoomCommand(command);
+        }
+        entry.pending.clear();
+    }
+
+    Stripe& StripeOf(int hostId) { return stripes[(uint32_t)hostId % StripeCount]; }
+
+    Stripe stripes[StripeCount];
+};
+
+// 워커 큐로 가는 명령 - 어느 방의 명령인지 함께 넘김 (close면 명령 대신 방을 닫음)
+struct RoomCommand {
+    GameCommand command;
+    Room* room;
+    bool close = false;
+};
+
+// RoomWorker - 고정된 방들을 처리하는 스레드 하나 (명령 큐 + 틱 루프)
+class RoomWorker {
+public:
+    using TickHook = std::function<void(Room& room, uint32_t tickId)>;
+    using ClosedHook = std::function<void(Room& room)>;
+
+    RoomWorker(int index, size_t queueCapacity) : index(index), queue(queueCapacity) {
+        batch.resize(BatchSize);
+    }
+
+    RoomWorker(const RoomWorker&) = delete;
+    RoomWorker& operator=(const RoomWorker&) = delete;
+
+    ~RoomWorker() { Stop(); }
+
+    int Index() const { return index; }
+    MpscQueue<RoomCommand>& Queue() { return queue; }
+    TickLoop& Loop() { return tickLoop; }
+    const TickLoop& Loop() const { return tickLoop; }
+    SimLatencyRecorder& Latency() { return latency; }
+
+    // 새 방을 이 워커에 고정 - 워커 스레드가 다음 틱에 목록으로 가져감
+    void Attach(Room* room) {
+        std::lock_guard<std::mutex> lock(attachMutex);
+        attached.push_back(room);
+        hasChanges.store(true, std::memory_order_release);
+    }
+
+    // 닫은 방을 넘김 - 워커 스레드가 다음 틱에 목록에서 빼고 closed 훅을 부른 뒤 해제
+    // actor 모드에서는 앞서 큐에 들어간 그 방의 명령을 모두 적용한 뒤에 넘어오도록 큐(close 항목)로 보냅니다
+    void Detach(Room* room) {
+        std::lock_guard<std::mutex> lock(attachMutex);
+        detached.push_back(room);
+        hasChanges.store(true, std::memory_order_release);
+    }
+
+    // 틱 루프 시작 - actor면 틱 사이에 명령 큐를 비움
+    // beforeSnapshot은 방마다 스냅샷 직전에, onClosed는 닫은 방을 해제하기 직전에 워커 스레드에서 호출
+    void Start(int tickRateHz, bool actor, TickHook beforeSnapshot, ClosedHook onClosed = ClosedHook()) {
+        hook = std::move(beforeSnapshot);
+        closedHook = std::move(onClosed);
+        if (actor) {
+            tickLoop.Start(tickRateHz, [this](uint32_t tickId) { Tick(tickId, false); },
+                           [this](std::chrono::steady_clock::time_point deadline) { RunUntil(deadline); });
+        } else {
+            tickLoop.Start(tickRateHz, [this](uint32_t tickId) { Tick(tickId, true); });
+        }
+    }
+
+    // 틱 루프를 멈추고 적용되지 않은 명령과 닫은 방 정리
+    void Stop() {
+        tickLoop.Stop();
+        size_t count;
+        while ((count = queue.PopBatch(batch.data(), batch.size())) > 0) {
+            for (size_t i = 0; i < count; i++) {
+                if (batch[i].close) {
+                    Detach(batch[i].room);
+                } else {
+                    ReleaseRoomCommand(batch[i].command);
+                }
+            }
+        }
+        TakeChanges();
+    }
+
+private:
+    static const size_t BatchSize = 256;
+
+    // 다음 틱 예정 시각까지 명령 큐를 배치 단위로 비움 (배치마다 돌아가 TickLoop가 틱 시각을 다시 확인)
+    void RunUntil(std::chrono::steady_clock::time_point deadline) {
+        size_t count = queue.PopBatch(batch.data(), batch.size());
+        if (count == 0) {
+            queue.WaitUntil(deadline);
+            return;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            const RoomCommand& item = batch[i];
+            if (item.close) {
+                Detach(item.room);
+                continue;
+            }
+            latency.Record(item.command.enqueueNs, SimNowNs());
+            item.room->Apply(item.command);
+            ReleaseRoomCommand(item.command);
+        }
+    }
+
+    // 고정된 방마다 스냅샷 전송 (lock 모드면 방 뮤텍스를 잡고)
+    void Tick(uint32_t tickId, bool lockRooms) {
+        if (hasChanges.load(std::memory_order_acquire)) {
+            TakeChanges();
+        }
+
+        for (Room* room : rooms) {
+            if (lockRooms) {
+                std::lock_guard<MeasuredMutex> lock(room->Mutex());
+                TickRoom(*room, tickId);
+            } else {
+                TickRoom(*room, tickId);
+            }
+        }
+    }
+
+    void TickRoom(Room& room, uint32_t tickId) {
+        if (hook) {
+            hook(room, tickId);
+        }
+        room.Tick(tickId);
+    }
+
+    // 새로 고정한 방을 목록에 넣고 닫은 방을 빼서 해제 (워커 스레드, 또는 틱 루프가 멈춘 뒤)
+    void TakeChanges() {
+        std::vector<Room*> closing;
+        {
+            std::lock_guard<std::mutex> lock(attachMutex);
+            rooms.insert(rooms.end(), attached.begin(), attached.end());
+            attached.clear();
+            closing.swap(detached);
+            hasChanges.store(false, std::memory_order_relaxed);
+        }
+
+        for (Room* room : closing) {
+            rooms.erase(std::remove(rooms.begin(), rooms.end(), room), rooms.end());
+            if (closedHook) {
+                closedHook(*room);
+            }
+            delete room;
+        }
+    }
+
+    int index;
+    MpscQueue<RoomCommand> queue;
+    std::vector<RoomCommand> batch;
+    SimLatencyRecorder latency;
+    TickLoop tickLoop;
+    TickHook hook;
+    ClosedHook closedHook;
+
+    // 워커 스레드만 쓰는 방 목록과, 다른 스레드가 새로 고정하거나 닫은 방
+    std::vector<Room*> rooms;
+    std::mutex attachMutex;
+    std::vector<Room*> attached;
+    std::vector<Room*> detached;
+    std::atomic<bool> hasChanges{ false };
+};
+
+struct RoomManagerConfig {
+    int workers = 1;                  // 워커 스레드 수
+    int roomSize = 64;                // 방 정원 (0이면 키마다 제한 없이 방 하나)
+    int tickRateHz = 20;
+    bool useActor = true;             // false면 lock 모드 (핸들러가 방 뮤텍스를 잡고 직접 적용)
+    float interestRadius = 0.0f;
+    size_t queueCapacity = 16384;     // 워커당 명령 큐 크기
+    int matchWindowMs = 20;           // 매치메이커가 대기표를 모으는 시간
+    int emptyRoomTimeoutMs = 30000;   // 빈 방을 닫기까지 기다리는 시간 (0이면 닫지 않음)
+};
+
+// RoomManager - 방 생성/종료, 명령 전달, 워커 스레드 관리
+// 접속은 디렉터리에 배정 대기로 올리고 매치메이커 큐에 대기표를 넣기만 하며 (잠금 없는 push),
+// 방 배정과 방 생성/종료는 매치메이커 스레드가 MatchRoomPool 인터페이스로 합니다.
+// 접속한 뒤의 RMI는 디렉터리 조회와 워커 큐 push만 거칩니다.
+// 방 목록 잠금(roomsMutex)은 방을 열고 닫을 때와 콘솔/메트릭이 방을 순회할 때만 잡습니다
+class RoomManager : private MatchRoomPool {
+public:
+    using SinkFactory = std::function<std::unique_ptr<GameEventSink>(int roomId)>;
+    using WorldSetup = std::function<void(GameWorld& world, int roomId)>;
+
+    RoomManager(const RoomManagerConfig& config, SinkFactory makeSink, WorldSetup setupWorld)
+        : config(config), makeSink(std::move(makeSink)), setupWorld(std::move(setupWorld)),
+          matchmaker(MakeMatchmakerConfig(config), *this) {
+        int workerCount = std::max(1, config.workers);
+        for (int i = 0; i < workerCount; i++) {
+            workers.emplace_back(new RoomWorker(i, config.queueCapacity));
+        }
+    }
+
+    RoomManager(const RoomManager&) = delete;
+    RoomManager& operator=(const RoomManager&) = delete;
+
+    ~RoomManager() { Stop(); }
+
+    // 닫은 방을 해제하기 직전에 그 방의 워커에서 호출 (누적 통계를 옮겨 둘 때, Start 전에 설정)
+    void SetRoomClosedHook(RoomWorker::ClosedHook hook) { closedHook = std::move(hook); }
+
+    // 워커 틱 루프와 매치메이커 시작 (beforeSnapshot은 방마다 스냅샷 직전에 그 방의 워커에서 호출)
+    void Start(RoomWorker::TickHook beforeSnapshot = RoomWorker::TickHook()) {
+        for (std::unique_ptr<RoomWorker>& worker : workers) {
+            worker->Start(config.tickRateHz, config.useActor, beforeSnapshot, closedHook);
+        }
+        matchmaker.Start();
+    }
+
+    // 매치메이커를 먼저 멈춘 뒤 (더 이상 방을 열고 닫지 않음) 워커를 멈춤
+    void Stop() {
+        matchmaker.Stop();
+        for (std::unique_ptr<RoomWorker>& worker : workers) {
+            worker->Stop();
+        }
+    }
+
+    // 접속한 클라이언트를 배정 대기로 올리고 매치메이커에 대기표 제출
+    // 배정 전에 온 RMI는 디렉터리에 모아 두었다가 배정할 때 Join 뒤에 순서대로 적용합니다
+    void Join(int hostId, const MatchKey& key = MatchKey()) {
+        directory.AddPending(hostId);
+        playerCount.fetch_add(1, std::memory_order_relaxed);
+        matchmaker.Submit(hostId, key);
+    }
+
+    // 퇴장 - 디렉터리에서 빼고 방에 Leave 명령 전달 (배정 전이면 대기표만 무효, 이후 이 클라이언트의 RMI는 버림)
+    void Leave(int hostId) {
+        bool wasPending;
+        Room* room = directory.Remove(hostId, wasPending);
+        if (room == nullptr && !wasPending) {
+            return;
+        }
+        playerCount.fetch_sub(1, std::memory_order_relaxed);
+        if (wasPending) {
+            matchmaker.NoteCancelled();
+            return;
+        }
+
+        // Leave를 넘긴 뒤에 인원을 줄여, 방을 닫는 close 항목이 Leave보다 앞서지 않게 함
+        GameCommand command = MakeCommand(SimCommandType::Leave, hostId);
+        Deliver(*room, command);
+        room->RemoveMember();
+    }
+
+    // 클라이언트 명령을 그 클라이언트의 방으로 전달 (배정 대기 중이면 모아 둠, 접속 중이 아니면 버리고 false)
+    // P2P 메시지는 넘긴 뒤 RoomManager가 해제합니다
+    bool Dispatch(GameCommand& command) {
+        bool accepted = directory.Route(command, [this](Room& room, GameCommand& routed) { Deliver(room, routed); });
+        if (!accepted) {
+            ReleaseRoomCommand(command);
+        }
+        return accepted;
+    }
+
+    // 콘솔 명령 - console.targetId 탱크의 방으로, status와 전체 체력(-1)은 모든 방으로 전달
+    void DispatchConsole(GameCommand& command) {
+        bool everyRoom = command.type == SimCommandType::PrintStatus
+            || (command.type == SimCommandType::PrintHealth && command.console.targetId == -1);
+        if (!everyRoom) {
+            // Dispatch와 같이 디렉터리 구간 잠금 안에서 넘김
+            if (!directory.Visit(command.console.targetId, [&](Room& room) { Deliver(room, command); })) {
+                DebugLog("Tank with ID " + std::to_string(command.console.targetId) + " not found");
+            }
+            return;
+        }
+
+        // 방 목록 잠금을 잡은 채로 넘겨, 넘기는 동안 방이 닫히지 않게 함
+        std::lock_guard<std::mutex> lock(roomsMutex);
+        if (rooms.empty()) {
+            DebugLog("No rooms (no clients are connected)");
+        }
+        for (auto& entry : rooms) {
+            Deliver(*entry.second, command);
+        }
+    }
+
+    // 클라이언트가 배정된 방 ID (배정 대기 중이거나 없으면 0)
+    int RoomOf(int hostId) {
+        int roomId = 0;
+        directory.Visit(hostId, [&](Room& room) { roomId = room.Id(); });
+        return roomId;
+    }
+
+    // 열린 방마다 func(room) 호출 - 방 목록 잠금 안에서 호출하므로 통계만 읽어야 함 (월드 상태는 워커 소유)
+    template <typename Func>
+    void ForEachRoom(Func&& func) {
+        std::lock_guard<std::mutex> lock(roomsMutex);
+        for (auto& entry : rooms) {
+            func(*entry.second);
+        }
+    }
+
+    // 접속 중인 클라이언트 수 (배정 대기 포함)
+    int PlayerCount() const { return playerCount.load(std::memory_order_relaxed); }
+
+    int RoomCount() {
+        std::lock_guard<std::mutex> lock(roomsMutex);
+        return (int)rooms.size();
+    }
+
+    size_t WorkerCount() const { return workers.size(); }
+    RoomWorker& WorkerAt(size_t index) { return *workers[index]; }
+    const RoomManagerConfig& Config() const { return config; }
+    const MatchmakerStats& MatchStats() const { return matchmaker.Stats(); }
+    size_t MatchQueueDepth() const { return matchmaker.QueueDepth(); }
+
+private:
+    static MatchmakerConfig MakeMatchmakerConfig(const RoomManagerConfig& config) {
+        MatchmakerConfig matchConfig;
+        matchConfig.roomSize = config.roomSize;
+        matchConfig.batchWindowMs = config.matchWindowMs;
+        matchConfig.emptyRoomTimeoutMs = config.emptyRoomTimeoutMs;
+        return matchConfig;
+    }
+
+    static GameCommand MakeCommand(SimCommandType type, int hostId) {
+        GameCommand command;
+        command.type = type;
+        command.remote = hostId;
+        command.enqueueNs = 0;
+        return command;
+    }
+
+    // MatchRoomPool - 아래 네 함수는 매치메이커 스레드에서만 호출
+
+    // 새 방을 배정된 인원이 가장 적은 워커에 고정
+    int OpenRoom(const MatchKey& key) override {
+        std::vector<int> workerMembers(workers.size(), 0);
+        int roomId;
+        {
+            std::lock_guard<std::mutex> lock(roomsMutex);
+            for (auto& entry : rooms) {
+                workerMembers[entry.second->Worker()] += entry.second->Members();
+            }
+            roomId = nextRoomId++;
+        }
+        int worker = (int)(std::min_element(workerMembers.begin(), workerMembers.end()) - workerMembers.begin());
+
+        std::unique_ptr<Room> room(new Room(roomId, worker, key, makeSink(roomId), config.interestRadius));
+        if (setupWorld) {
+            setupWorld(room->World(), roomId);
+        }
+        workers[worker]->Attach(room.get());
+        {
+            std::lock_guard<std::mutex> lock(roomsMutex);
+            rooms[roomId] = std::move(room);
+        }
+        TANK_LOG_INFO(LogCategory::Net, "Room {} opened on worker {} (skill {}, region {})", roomId, worker,
+                      key.skillBucket, key.region);
+        return roomId;
+    }
+
+    bool PlaceClient(int hostId, int roomId) override {
+        Room* room = FindRoom(roomId);
+        if (room == nullptr) {
+            return false;
+        }
+        // 인원은 구간 잠금 안에서 (퇴장 처리가 디렉터리에서 방을 보기 전에) 늘림
+        bool placed = directory.Place(hostId, room, [this, room](GameCommand& command) {
+            if (command.type == SimCommandType::Join) {
+                room->AddMember();
+            }
+            Deliver(*room, command);
+        });
+        if (!placed) {
+            return false;
+        }
+        TANK_LOG_INFO(LogCategory::Net, "Client {} assigned to room {} (worker {})", hostId, roomId, room->Worker());
+        return true;
+    }
+
+    int RoomMembers(int roomId) override {
+        Room* room = FindRoom(roomId);
+        return room != nullptr ? room->Members() : 0;
+    }
+
+    // 방 목록에서 빼고 워커에 넘김 - 비어 있고 새로 배정되지 않으므로, 앞서 넘긴 명령을 적용한 뒤 워커가 해제
+    void CloseRoom(int roomId) override {
+        Room* room;
+        {
+            std::lock_guard<std::mutex> lock(roomsMutex);
+            auto it = rooms.find(roomId);
+            if (it == rooms.end()) {
+                return;
+            }
+            room = it->second.release();
+            rooms.erase(it);
+        }
+
+        if (config.useActor) {
+            RoomCommand close{ MakeCommand(SimCommandType::Leave, 0), room, true };
+            workers[room->Worker()]->Queue().Push(close);
+        } else {
+            workers[room->Worker()]->Detach(room);
+        }
+        TANK_LOG_INFO(LogCategory::Net, "Room {} closed (empty)", roomId);
+    }
+
+    Room* FindRoom(int roomId) {
+        std::lock_guard<std::mutex> lock(roomsMutex);
+        auto it = rooms.find(roomId);
+        return it != rooms.end() ? it->second.get() : nullptr;
+    }
+
+    // actor면 방의 워커 큐로, lock 모드면 방 뮤텍스를 잡고 바로 적용
+    void Deliver(Room& room, GameCommand& command) {
+        command.enqueueNs = SimNowNs();
+        if (config.useActor) {
+            workers[room.Worker()]->Queue().Push(RoomCommand{ command, &room });
+            return;
+        }
+
+        std::lock_guard<MeasuredMutex> lock(room.Mutex());
+        workers[room.Worker()]->Latency().Record(command.enqueueNs, SimNowNs());
+        room.Apply(command);
+        ReleaseRoomCommand(command);
+    }
+
+    RoomManagerConfig config;
+    SinkFactory makeSink;
+    WorldSetup setupWorld;
+    RoomWorker::ClosedHook closedHook;
+    std::vector<std::unique_ptr<RoomWorker>> workers;
+    RoomDirectory directory;
+
+    // 열린 방 (방 ID는 1부터 계속 늘어나며 닫은 방의 ID는 다시 쓰지 않음)
+    std::mutex roomsMutex;
+    std::map<int, std::unique_ptr<Room>> rooms;
+    int nextRoomId = 1;
+    std::atomic<int> playerCount{ 0 };
+
+    // 마지막 멤버 - 가장 먼저 해제되므로 매치메이커 스레드가 위 멤버를 쓰는 동안 멤버가 사라지지 않음
+    Matchmaker matchmaker;
+};
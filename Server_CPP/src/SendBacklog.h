@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// 클라이언트별 송신 대기열 백프레셔
+// 전송 계층이 틱마다 클라이언트의 송신 대기열 크기(ProudNet CNetClientInfo::m_sendQueuedAmountInBytes)를 알려 주면
+// highWater 이상인 클라이언트는 위치 스냅샷을 매 틱 받지 않고 coalesceTicks마다 그동안 바뀐 위치를 최신 값 하나로 모아 받고,
+// lowWater 아래로 내려가면 모은 위치를 받은 뒤 다시 매 틱 받습니다 (둘 사이에서는 현재 상태 유지).
+// dropBytes 이상이면 위치와 총알 생성(OnSpawnBullet)도 보내지 않고 접속/퇴장/체력/파괴/생성 같은 상태 이벤트만 보냅니다.
+// 그래도 대기열이 disconnectBytes에 닿거나 버리는 상태가 dropTimeoutTicks 동안 이어지면 (읽지 않는 클라이언트)
+// 연결 종료를 요청해 클라이언트 하나가 붙잡는 서버 메모리를 제한합니다.
+
+struct SendBacklogConfig {
+    uint32_t highWaterBytes = 0;        // 이 이상이면 위치를 모아서 보냄 (0이면 끔)
+    uint32_t lowWaterBytes = 0;         // 이 아래로 내려가면 매 틱 전송 (0이면 highWater / 4)
+    uint32_t dropBytes = 0;             // 이 이상이면 위치와 총알을 보내지 않음 (0이면 highWater x 4)
+    uint32_t disconnectBytes = 0;       // 이 이상이면 연결 종료 (0이면 끔)
+    uint32_t coalesceTicks = 5;         // 모으는 중인 클라이언트에게 위치를 보내는 간격
+    uint32_t dropTimeoutTicks = 200;    // 버리는 상태가 이만큼 이어지면 연결 종료 (0이면 끔)
+
+    bool Enabled() const { return highWaterBytes > 0; }
+    uint32_t LowWater() const { return lowWaterBytes > 0 ? lowWaterBytes : highWaterBytes / 4; }
+    uint32_t DropLevel() const { return dropBytes > 0 ? dropBytes : highWaterBytes * 4; }
+};
+
+enum class SendBacklogLevel : uint8_t {
+    Normal,       // 매 틱 전송
+    Coalescing,   // coalesceTicks마다 최신 위치만 전송
+    Dropping,     // 위치/총알 전송 안 함
+};
+
+inline const char* SendBacklogLevelName(SendBacklogLevel level) {
+    switch (level) {
+    case SendBacklogLevel::Normal: return "normal";
+    case SendBacklogLevel::Coalescing: return "coalescing";
+    case SendBacklogLevel::Dropping: return "dropping";
+    }
+    return "unknown";
+}
+
+// 클라이언트 하나의 대기열 상태
+struct SendBacklogState {
+    uint32_t queuedBytes = 0;                            // 마지막으로 알려 준 송신 대기열 크기
+    SendBacklogLevel level = SendBacklogLevel::Normal;
+    bool stale = false;                                  // 건너뛴 위치 스냅샷이 있어 모은 위치를 보내야 함
+    uint32_t lastSentTick = 0;                           // 모으는 중에 마지막으로 위치를 보낸 틱
+    uint32_t droppingTicks = 0;                          // 버리는 상태가 이어진 틱 수
+    bool closeRequested = false;                         // 연결 종료를 요청함 (퇴장할 때까지 더 판단하지 않음)
+};
+
+// 대기열 크기로 다음 상태 결정 - lowWater ~ highWater 사이에서는 정상은 정상, 혼잡은 모으는 상태로 둠
+inline SendBacklogLevel NextSendBacklogLevel(SendBacklogLevel current, uint32_t queuedBytes, const SendBacklogConfig& config) {
+    if (queuedBytes >= config.DropLevel()) {
+        return SendBacklogLevel::Dropping;
+    }
+    if (queuedBytes >= config.highWaterBytes) {
+        return SendBacklogLevel::Coalescing;
+    }
+    if (queuedBytes < config.LowWater()) {
+        return SendBacklogLevel::Normal;
+    }
+    return current == SendBacklogLevel::Normal ? SendBacklogLevel::Normal : SendBacklogLevel::Coalescing;
+}
+
+// 이번 틱에 위치를 보낼 차례인지
+inline bool SendBacklogDue(const SendBacklogState& state, uint32_t tickId, const SendBacklogConfig& config) {
+    switch (state.level) {
+    case SendBacklogLevel::Normal: return true;
+    case SendBacklogLevel::Coalescing: return tickId - state.lastSentTick >= config.coalesceTicks;
+    case SendBacklogLevel::Dropping: return false;
+    }
+    return false;
+}
+
+// 백프레셔 누적 값과 게이지 (atomic - 메트릭 스레드에서 읽음)
+struct SendBacklogStats {
+    std::atomic<uint64_t> skipped{ 0 };          // 대기열 때문에 건너뛴 위치 스냅샷 (클라이언트 x 틱)
+    std::atomic<uint64_t> coalesced{ 0 };        // 모은 위치를 보낸 횟수
+    std::atomic<uint64_t> droppedBullets{ 0 };   // 버리는 상태라 보내지 않은 총알 생성 (클라이언트 x 발사)
+    std::atomic<uint64_t> disconnects{ 0 };      // 연결 종료를 요청한 클라이언트
+    std::atomic<int> coalescingClients{ 0 };
+    std::atomic<int> droppingClients{ 0 };
+};
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+// 서버 실행 옵션 - 명령줄 인자로 변경 가능
+//   --tick-rate N       : 스냅샷 브로드캐스트 주기 (Hz)
+//   --interest-radius R : 관심 영역 반경 (0이면 관심 영역 없이 모두에게 전송)
+//   --sim-mode M        : actor(명령 큐 + 단일 시뮬레이션 스레드) 또는 lock(핸들러가 뮤텍스를 잡고 직접 처리)
+//   --metrics-port P    : /metrics, /healthz HTTP 포트 (기본 g_WebServerPort, 0이면 끔)
+//   --capture FILE      : 수신 RMI와 접속/퇴장을 FILE에 기록 (bench/RmiReplay로 재생)
+//   --compress-world M  : on(기본)이면 늦게 들어온 클라이언트에게 보내는 OnWorldSnapshot을 ProudNet 압축으로 전송, off면 끔
+//   --position-stream M : unreliable(기본)이면 위치 스냅샷을 비신뢰(UDP 우선)로 보내고 1초마다 전체 위치를 다시 포함, reliable이면 기존처럼 신뢰 전송
+//   --dead-reckoning D  : float/압축 스냅샷에서 선형 외삽 위치와 실제 위치의 차이가 D 이하인 탱크는 생략 (0(기본)이면 끔)
+//   --dead-reckoning-heartbeat MS : 데드 레커닝 중에도 움직이는 탱크는 MS 밀리초마다 실제 위치 전송 (기본 500)
+//   --lod-budget N      : 관찰자마다 틱당 최대 N대의 위치를 거리/최근 발사 기반 우선순위 순으로 전송 (0(기본)이면 끔)
+//   --lod-near D        : 우선순위 가중치가 1인 거리, 그 뒤로는 거리에 반비례해 최소 0.1까지 감소 (기본 20)
+//   --send-queue-high KB : 클라이언트 송신 대기열이 KB 이상이면 위치를 모아 4Hz로, 4배 이상이면 위치/총알을 보내지 않음 (기본 64, 0이면 끔)
+//   --send-queue-limit KB : 송신 대기열이 KB에 닿거나 위치를 보내지 않는 상태가 10초 이어지면 연결 종료 (기본 1024, 0이면 끊지 않음)
+//   --server-hits M     : on이면 서버가 포탄을 시뮬레이션해 명중/파괴를 판정하고 클라이언트의 체력/파괴 보고를 무시, off(기본)면 클라이언트 보고를 따름
+//   --lag-compensation MS : 서버 판정 포탄을 쏜 클라이언트의 RTT만큼 (최대 MS 밀리초) 다른 탱크 위치를 되감아 판정 (0(기본)이면 끔)
+//   --pose-history N    : 지연 보상용으로 탱크마다 보관하는 최근 이동 수 (기본 32, 2의 거듭제곱으로 올림)
+//   --spawn-candidates N : 접속 위치 후보 N곳 중 가장 가까운 탱크가 가장 먼 곳에 생성 (기본 1 - 무작위 한 곳)
+//   --room-size N       : 방 하나의 정원 - 방이 모두 차면 새 방을 열어 워커 스레드 하나에 고정 (기본 64, 0이면 제한 없이 방 하나)
+//   --room-workers N    : 방을 나눠 처리할 워커 스레드 수 (0(기본)이면 하드웨어 스레드 수)
+//   --match-window MS   : 매치메이커가 접속한 클라이언트를 MS 밀리초 동안 모아 한 번에 방에 배정 (기본 20, 0이면 바로 배정)
+//   --empty-room-timeout S : 빈 방을 S초 동안 아무도 배정되지 않으면 닫음 (기본 30, 0이면 닫지 않음)
+struct ServerConfig {
+    int tickRateHz = 20;
+    float interestRadius = 0.0f;
+    bool useSimulationActor = true;
+    int metricsPort = -1;  // -1이면 g_WebServerPort 사용
+    std::string capturePath;
+    bool compressWorldSnapshot = true;
+    bool unreliablePositions = true;
+    float deadReckoningThreshold = 0.0f;
+    int deadReckoningHeartbeatMs = 500;
+    int lodBudget = 0;
+    float lodNearDistance = 20.0f;
+    int sendQueueHighKB = 64;
+    int sendQueueLimitKB = 1024;
+    bool serverProjectiles = false;
+    int lagCompensationMs = 0;
+    int poseHistorySamples = 32;
+    int spawnCandidates = 1;
+    int roomSize = 64;
+    int roomWorkers = 0;   // 0이면 std::thread::hardware_concurrency()
+    int matchWindowMs = 20;
+    int emptyRoomTimeoutSeconds = 30;
+};
+
+// "--name value" 또는 "--name=value" 형식의 명령줄 인자를 해석합니다
+inline ServerConfig ParseServerConfig(int argc, char* argv[]) {
+    ServerConfig config;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value;
+
+        size_t eq = arg.find('=');
+        if (eq != std::string::npos) {
+            value = arg.substr(eq + 1);
+            arg = arg.substr(0, eq);
+        } else if (i + 1 < argc && std::strncmp(argv[i + 1], "--", 2) != 0) {
+            value = argv[++i];
+        }
+
+        if (arg == "--tick-rate" && !value.empty()) {
+            int rate = std::atoi(value.c_str());
+            if (rate > 0 && rate <= 1000) {
+                config.tickRateHz = rate;
+            }
+        }
+        else if (arg == "--interest-radius" && !value.empty()) {
+            float radius = (float)std::atof(value.c_str());
+            if (radius >= 0.0f) {
+                config.interestRadius = radius;
+            }
+        }
+        else if (arg == "--metrics-port" && !value.empty()) {
+            int port = std::atoi(value.c_str());
+            if (port >= 0 && port <= 65535) {
+                config.metricsPort = port;
+            }
+        }
+        else if (arg == "--capture" && !value.empty()) {
+            config.capturePath = value;
+        }
+        else if (arg == "--compress-world") {
+            if (value == "on") {
+                config.compressWorldSnapshot = true;
+            } else if (value == "off") {
+                config.compressWorldSnapshot = false;
+            }
+        }
+        else if (arg == "--server-hits") {
+            if (value == "on") {
+                config.serverProjectiles = true;
+            } else if (value == "off") {
+                config.serverProjectiles = false;
+            }
+        }
+        else if (arg == "--lag-compensation" && !value.empty()) {
+            int milliseconds = std::atoi(value.c_str());
+            if (milliseconds >= 0 && milliseconds <= 1000) {
+                config.lagCompensationMs = milliseconds;
+            }
+        }
+        else if (arg == "--pose-history" && !value.empty()) {
+            int samples = std::atoi(value.c_str());
+            if (samples >= 1 && samples <= 1024) {
+                config.poseHistorySamples = samples;
+            }
+        }
+        else if (arg == "--spawn-candidates" && !value.empty()) {
+            int candidates = std::atoi(value.c_str());
+            if (candidates >= 1 && candidates <= 64) {
+                config.spawnCandidates = candidates;
+            }
+        }
+        else if (arg == "--position-stream") {
+            if (value == "unreliable") {
+                config.unreliablePositions = true;
+            } else if (value == "reliable") {
+                config.unreliablePositions = false;
+            }
+        }
+        else if (arg == "--dead-reckoning" && !value.empty()) {
+            float threshold = (float)std::atof(value.c_str());
+            if (threshold >= 0.0f) {
+                config.deadReckoningThreshold = threshold;
+            }
+        }
+        else if (arg == "--dead-reckoning-heartbeat" && !value.empty()) {
+            int heartbeatMs = std::atoi(value.c_str());
+            if (heartbeatMs >= 0) {
+                config.deadReckoningHeartbeatMs = heartbeatMs;
+            }
+        }
+        else if (arg == "--lod-budget" && !value.empty()) {
+            int budget = std::atoi(value.c_str());
+            if (budget >= 0) {
+                config.lodBudget = budget;
+            }
+        }
+        else if (arg == "--lod-near" && !value.empty()) {
+            float distance = (float)std::atof(value.c_str());
+            if (distance > 0.0f) {
+                config.lodNearDistance = distance;
+            }
+        }
+        else if (arg == "--send-queue-high" && !value.empty()) {
+            int kilobytes = std::atoi(value.c_str());
+            if (kilobytes >= 0) {
+                config.sendQueueHighKB = kilobytes;
+            }
+        }
+        else if (arg == "--send-queue-limit" && !value.empty()) {
+            int kilobytes = std::atoi(value.c_str());
+            if (kilobytes >= 0) {
+                config.sendQueueLimitKB = kilobytes;
+            }
+        }
+        else if (arg == "--room-size" && !value.empty()) {
+            int size = std::atoi(value.c_str());
+            if (size >= 0) {
+                config.roomSize = size;
+            }
+        }
+        else if (arg == "--room-workers" && !value.empty()) {
+            int workers = std::atoi(value.c_str());
+            if (workers >= 0 && workers <= 256) {
+                config.roomWorkers = workers;
+            }
+        }
+        else if (arg == "--match-window" && !value.empty()) {
+            int milliseconds = std::atoi(value.c_str());
+            if (milliseconds >= 0 && milliseconds <= 1000) {
+                config.matchWindowMs = milliseconds;
+            }
+        }
+        else if (arg == "--empty-room-timeout" && !value.empty()) {
+            int seconds = std::atoi(value.c_str());
+            if (seconds >= 0) {
+                config.emptyRoomTimeoutSeconds = seconds;
+            }
+        }
+        else if (arg == "--sim-mode") {
+            if (value == "actor") {
+                config.useSimulationActor = true;
+            } else if (value == "lock") {
+                config.useSimulationActor = false;
+            }
+        }
+    }
+
+    return config;
+}
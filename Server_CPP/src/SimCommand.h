@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// 시뮬레이션 액터로 전달되는 명령 종류
+// RMI 핸들러/콘솔 스레드가 명령을 만들어 큐에 넣고, 시뮬레이션 스레드 하나가 순서대로 월드에 적용합니다
+enum class SimCommandType : uint8_t {
+    // 네트워크 이벤트
+    Join,
+    Leave,
+    // RMI 요청
+    Move,
+    MoveSequenced,
+    Fire,
+    TankType,
+    HealthUpdated,
+    Destroyed,
+    Spawned,
+    P2PMessage,
+    Hello,
+    SnapshotAck,
+    // 콘솔 명령
+    Damage,
+    Heal,
+    Respawn,
+    PrintStatus,
+    PrintHealth,
+};
+
+// 명령 종류 수 (종류별 배열 크기)
+const size_t SimCommandTypeCount = (size_t)SimCommandType::PrintHealth + 1;
+
+inline const char* SimCommandTypeName(SimCommandType type) {
+    static const char* const names[SimCommandTypeCount] = {
+        "Join", "Leave", "Move", "MoveSequenced", "Fire", "TankType", "HealthUpdated", "Destroyed", "Spawned",
+        "P2PMessage", "Hello", "SnapshotAck", "Damage", "Heal", "Respawn", "PrintStatus", "PrintHealth",
+    };
+    return (size_t)type < SimCommandTypeCount ? names[(size_t)type] : "Unknown";
+}
+
+struct SimPoseArgs {
+    float posX;
+    float posY;
+    float direction;
+};
+
+// 순서 번호가 붙은 이동 (비신뢰 전송이라 늦게 도착한 이동은 월드가 버림)
+struct SimSequencedMoveArgs {
+    SimPoseArgs pose;
+    uint16_t sequence;
+};
+
+struct SimFireArgs {
+    int shooterId;
+    float direction;
+    float launchForce;
+    float fireX;
+    float fireY;
+    float fireZ;
+};
+
+struct SimHealthArgs {
+    float currentHealth;
+    float maxHealth;
+};
+
+struct SimSpawnArgs {
+    float posX;
+    float posY;
+    float direction;
+    int tankType;
+    float initialHealth;
+};
+
+// 콘솔 명령 대상 (damage/heal은 amount, respawn은 posX/posY 사용)
+struct SimConsoleArgs {
+    int targetId;
+    float amount;
+    float posX;
+    float posY;
+};
+
+// 고정 크기 명령 레코드 - 큐 슬롯에 그대로 복사됩니다
+// 가변 길이 데이터(P2P 메시지)만 포인터로 넘기며, 적용한 쪽(시뮬레이션 스레드)이 해제합니다
+// MessageT는 서버의 문자열 타입 (ProudNet 의존성을 헤더 밖에 두기 위해 템플릿)
+template <typename MessageT>
+struct SimCommand {
+    SimCommandType type;
+    int remote;              // 요청한 클라이언트 HostID (콘솔 명령은 0)
+    int64_t enqueueNs;       // 큐에 넣은 시각 (steady_clock) - 적용 지연 측정용
+    union {
+        SimPoseArgs pose;            // Move
+        SimSequencedMoveArgs sequencedMove;  // MoveSequenced
+        SimFireArgs fire;            // Fire
+        int tankType;                // TankType
+        SimHealthArgs health;        // HealthUpdated
+        int destroyedById;           // Destroyed
+        SimSpawnArgs spawn;          // Spawned
+        MessageT* message;           // P2PMessage
+        int protocolRevision;        // Hello
+        uint32_t ackTickId;          // SnapshotAck
+        SimConsoleArgs console;      // Damage/Heal/Respawn/PrintHealth
+    };
+};
+
+inline int64_t SimNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 명령 적용 지연 통계 (큐에 넣은 시각 -> 시뮬레이션 스레드가 적용한 시각)
+struct SimLatencyStats {
+    uint64_t appliedCount = 0;
+    double avgLatencyUs = 0.0;
+    double maxLatencyUs = 0.0;
+};
+
+// 기록은 시뮬레이션 스레드 하나만, 조회/초기화는 콘솔 스레드에서 (통계용이라 약간의 경쟁은 허용)
+class SimLatencyRecorder {
+public:
+    void Record(int64_t enqueueNs, int64_t nowNs) {
+        int64_t latencyNs = nowNs - enqueueNs;
+        appliedCount.store(appliedCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        latencySumNs.store(latencySumNs.load(std::memory_order_relaxed) + latencyNs, std::memory_order_relaxed);
+        if (latencyNs > maxLatencyNs.load(std::memory_order_relaxed)) {
+            maxLatencyNs.store(latencyNs, std::memory_order_relaxed);
+        }
+    }
+
+    SimLatencyStats TakeStats() {
+        SimLatencyStats result;
+        result.appliedCount = appliedCount.exchange(0, std::memory_order_relaxed);
+        int64_t sumNs = latencySumNs.exchange(0, std::memory_order_relaxed);
+        result.maxLatencyUs = maxLatencyNs.exchange(0, std::memory_order_relaxed) / 1000.0;
+        if (result.appliedCount > 0) {
+            result.avgLatencyUs = (double)sumNs / result.appliedCount / 1000.0;
+        }
+        return result;
+    }
+
+private:
+    std::atomic<uint64_t> appliedCount{ 0 };
+    std::atomic<int64_t> latencySumNs{ 0 };
+    std::atomic<int64_t> maxLatencyNs{ 0 };
+};
@@ -0,0 +1,294 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// 근접 쿼리 결과 하나 (가까운 순으로 정렬해 돌려줌)
+struct SpatialNeighbor {
+    int id;
+    float distanceSq;
+};
+
+// 점 (px, py)와 선분 (x0, y0) - (x0 + dx, y0 + dy) 사이 최단 거리 제곱, t는 선분 위 가장 가까운 점의 위치 (0 ~ 1)
+inline float SegmentDistanceSq(float x0, float y0, float dx, float dy, float invLengthSq, float px, float py, float& t) {
+    t = std::min(1.0f, std::max(0.0f, ((px - x0) * dx + (py - y0) * dy) * invLengthSq));
+    float ex = x0 + dx * t - px;
+    float ey = y0 + dy * t - py;
+    return ex * ex + ey * ey;
+}
+
+// SpatialHash - 균일 격자 기반 공간 해시 (탱크/포탄 위치의 broadphase 색인)
+//  - 셀 크기 = 관심 영역 반경으로 두면 반경 쿼리는 주변 3x3 셀만 확인합니다
+//  - 셀마다 id/x/y를 연속 배열로 두어 쿼리가 항목별 해시 조회 없이 셀 배열만 훑습니다
+//  - 이동할 때 같은 셀이면 셀 배열의 좌표만 고치고, 셀이 바뀐 경우에만 셀 목록을 수정 (증분 갱신, O(1))
+//  - 셀 내 삭제는 마지막 원소와 교체하여 O(1)
+//  - 반경, 선분 스윕(캡슐), k-최근접 쿼리를 지원하며 LooseQuadtree와 같은 인터페이스입니다
+class SpatialHash {
+public:
+    explicit SpatialHash(float cellSize = 100.0f) { SetCellSize(cellSize); }
+
+    SpatialHash(const SpatialHash&) = delete;
+    SpatialHash& operator=(const SpatialHash&) = delete;
+
+    // 셀 크기 변경 - 기존 항목은 새 격자로 다시 배치됩니다
+    void SetCellSize(float newCellSize) {
+        Cell moved;
+        for (auto& pair : cells) {
+            const Cell& cell = pair.second;
+            moved.ids.insert(moved.ids.end(), cell.ids.begin(), cell.ids.end());
+            moved.xs.insert(moved.xs.end(), cell.xs.begin(), cell.xs.end());
+            moved.ys.insert(moved.ys.end(), cell.ys.begin(), cell.ys.end());
+        }
+
+        cellSize = newCellSize > 0.0f ? newCellSize : 1.0f;
+        invCellSize = 1.0f / cellSize;
+        cells.clear();
+        entries.clear();
+        for (size_t i = 0; i < moved.ids.size(); i++) {
+            Update(moved.ids[i], moved.xs[i], moved.ys[i]);
+        }
+    }
+
+    float CellSize() const { return cellSize; }
+    size_t Size() const { return entries.size(); }
+    size_t CellCount() const { return cells.size(); }
+
+    // 위치 갱신 (없으면 추가)
+    void Update(int id, float x, float y) {
+        auto it = entries.find(id);
+        uint64_t newKey = CellKeyOf(x, y);
+        if (it == entries.end()) {
+            Entry e{ newKey, nullptr, 0 };
+            AddToCell(id, x, y, e);
+            entries.emplace(id, e);
+            return;
+        }
+
+        Entry& e = it->second;
+        if (newKey == e.key) {
+            e.cell->xs[e.indexInCell] = x;
+            e.cell->ys[e.indexInCell] = y;
+            return;
+        }
+        RemoveFromCell(e);
+        e.key = newKey;
+        AddToCell(id, x, y, e);
+    }
+
+    void Remove(int id) {
+        auto it = entries.find(id);
+        if (it == entries.end()) {
+            return;
+        }
+        RemoveFromCell(it->second);
+        entries.erase(it);
+    }
+
+    void Clear() {
+        cells.clear();
+        entries.clear();
+    }
+
+    // 항목의 현재 위치 (없으면 false)
+    bool Find(int id, float& x, float& y) const {
+        auto it = entries.find(id);
+        if (it == entries.end()) {
+            return false;
+        }
+        x = it->second.cell->xs[it->second.indexInCell];
+        y = it->second.cell->ys[it->second.indexInCell];
+        return true;
+    }
+
+    // (x, y)에서 radius 이내에 있는 항목마다 visit(id) 호출
+    template <typename Visitor>
+    void QueryRadius(float x, float y, float radius, Visitor&& visit) const {
+        int32_t minX = CellCoord(x - radius);
+        int32_t maxX = CellCoord(x + radius);
+        int32_t minY = CellCoord(y - radius);
+        int32_t maxY = CellCoord(y + radius);
+        float radiusSq = radius * radius;
+
+        for (int32_t cy = minY; cy <= maxY; cy++) {
+            for (int32_t cx = minX; cx <= maxX; cx++) {
+                auto cellIt = cells.find(MakeKey(cx, cy));
+                if (cellIt == cells.end()) {
+                    continue;
+                }
+                const Cell& cell = cellIt->second;
+                const size_t count = cell.ids.size();
+                for (size_t i = 0; i < count; i++) {
+                    float dx = cell.xs[i] - x;
+                    float dy = cell.ys[i] - y;
+                    if (dx * dx + dy * dy <= radiusSq) {
+                        visit(cell.ids[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    // 결과를 out에 추가하는 편의 함수
+    void QueryRadius(float x, float y, float radius, std::vector<int>& out) const {
+        QueryRadius(x, y, radius, [&out](int id) { out.push_back(id); });
+    }
+
+    // 선분 (x0, y0) - (x1, y1)에서 radius 이내 (캡슐)에 있는 항목마다 visit(id, t) 호출 - t는 가장 가까운 지점 (0 ~ 1)
+    // 선분의 경계 상자 안 셀 중 선분에서 radius + 셀 대각선 절반보다 먼 셀은 건너뜀 (긴 대각선 스윕도 선분 주변 셀만 봄)
+    template <typename Visitor>
+    void QuerySegment(float x0, float y0, float x1, float y1, float radius, Visitor&& visit) const {
+        float dx = x1 - x0;
+        float dy = y1 - y0;
+        float lengthSq = dx * dx + dy * dy;
+        float invLengthSq = lengthSq > 0.0f ? 1.0f / lengthSq : 0.0f;
+        float radiusSq = radius * radius;
+        float cellReach = radius + cellSize * 0.70710678f;
+        float cellReachSq = cellReach * cellReach;
+
+        int32_t minX = CellCoord(std::min(x0, x1) - radius);
+        int32_t maxX = CellCoord(std::max(x0, x1) + radius);
+        int32_t minY = CellCoord(std::min(y0, y1) - radius);
+        int32_t maxY = CellCoord(std::max(y0, y1) + radius);
+        for (int32_t cy = minY; cy <= maxY; cy++) {
+            for (int32_t cx = minX; cx <= maxX; cx++) {
+                float t;
+                float centerX = ((float)cx + 0.5f) * cellSize;
+                float centerY = ((float)cy + 0.5f) * cellSize;
+                if (SegmentDistanceSq(x0, y0, dx, dy, invLengthSq, centerX, centerY, t) > cellReachSq) {
+                    continue;
+                }
+                auto cellIt = cells.find(MakeKey(cx, cy));
+                if (cellIt == cells.end()) {
+                    continue;
+                }
+                const Cell& cell = cellIt->second;
+                const size_t count = cell.ids.size();
+                for (size_t i = 0; i < count; i++) {
+                    if (SegmentDistanceSq(x0, y0, dx, dy, invLengthSq, cell.xs[i], cell.ys[i], t) <= radiusSq) {
+                        visit(cell.ids[i], t);
+                    }
+                }
+            }
+        }
+    }
+
+    // (x, y)에서 가장 가까운 항목 k개 (maxDistance 이내, exclude 제외)를 가까운 순으로 out에 채움 - 찾은 수 반환
+    // 중심 셀부터 한 겹씩 넓히며, k번째 후보가 아직 보지 않은 겹까지의 거리보다 가까우면 멈춥니다
+    size_t QueryNearest(float x, float y, size_t k, float maxDistance, int exclude, std::vector<SpatialNeighbor>& out) const {
+        out.clear();
+        if (k == 0 || entries.empty()) {
+            return 0;
+        }
+        float maxDistanceSq = maxDistance * maxDistance;
+        int32_t centerX = CellCoord(x);
+        int32_t centerY = CellCoord(y);
+        int32_t maxRing = (int32_t)std::min(std::ceil(maxDistance * invCellSize) + 1.0f, 1e6f);
+        size_t seen = 0;
+        for (int32_t ring = 0; ring <= maxRing && seen < entries.size(); ring++) {
+            for (int32_t cy = centerY - ring; cy <= centerY + ring; cy++) {
+                bool edgeRow = cy == centerY - ring || cy == centerY + ring;
+                for (int32_t cx = centerX - ring; cx <= centerX + ring; cx += edgeRow ? 1 : 2 * std::max(ring, 1)) {
+                    auto cellIt = cells.find(MakeKey(cx, cy));
+                    if (cellIt == cells.end()) {
+                        continue;
+                    }
+                    const Cell& cell = cellIt->second;
+                    seen += cell.ids.size();
+                    for (size_t i = 0; i < cell.ids.size(); i++) {
+                        float dx = cell.xs[i] - x;
+                        float dy = cell.ys[i] - y;
+                        float distanceSq = dx * dx + dy * dy;
+                        if (distanceSq <= maxDistanceSq && cell.ids[i] != exclude) {
+                            PushNeighbor(out, k, SpatialNeighbor{ cell.ids[i], distanceSq });
+                        }
+                    }
+                }
+            }
+            // 다음 겹의 셀은 (x, y)에서 최소 ring * cellSize 떨어져 있음
+            float nextRing = (float)ring * cellSize;
+            if (out.size() == k && out.back().distanceSq <= nextRing * nextRing) {
+                break;
+            }
+        }
+        return out.size();
+    }
+
+private:
+    // 셀 하나의 항목 (같은 인덱스가 항목 하나)
+    struct Cell {
+        std::vector<int> ids;
+        std::vector<float> xs;
+        std::vector<float> ys;
+    };
+
+    // 항목이 속한 셀 - unordered_map 원소는 재해시에도 주소가 바뀌지 않으므로 셀을 포인터로 바로 가리킴
+    struct Entry {
+        uint64_t key;
+        Cell* cell;
+        uint32_t indexInCell;
+    };
+
+    int32_t CellCoord(float v) const {
+        return static_cast<int32_t>(std::floor(v * invCellSize));
+    }
+
+    static uint64_t MakeKey(int32_t cx, int32_t cy) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+    }
+
+    uint64_t CellKeyOf(float x, float y) const {
+        return MakeKey(CellCoord(x), CellCoord(y));
+    }
+
+    void AddToCell(int id, float x, float y, Entry& e) {
+        Cell& cell = cells[e.key];
+        e.cell = &cell;
+        e.indexInCell = static_cast<uint32_t>(cell.ids.size());
+        cell.ids.push_back(id);
+        cell.xs.push_back(x);
+        cell.ys.push_back(y);
+    }
+
+    void RemoveFromCell(const Entry& e) {
+        Cell& cell = *e.cell;
+        size_t last = cell.ids.size() - 1;
+        if (e.indexInCell < last) {
+            int movedId = cell.ids[last];
+            cell.ids[e.indexInCell] = movedId;
+            cell.xs[e.indexInCell] = cell.xs[last];
+            cell.ys[e.indexInCell] = cell.ys[last];
+            entries.find(movedId)->second.indexInCell = e.indexInCell;
+        }
+        cell.ids.pop_back();
+        cell.xs.pop_back();
+        cell.ys.pop_back();
+        if (cell.ids.empty()) {
+            cells.erase(e.key);
+        }
+    }
+
+    // 가까운 순으로 정렬된 k개 후보에 추가 (k개를 넘으면 가장 먼 것을 버림)
+    static void PushNeighbor(std::vector<SpatialNeighbor>& out, size_t k, const SpatialNeighbor& neighbor) {
+        if (out.size() == k && neighbor.distanceSq >= out.back().distanceSq) {
+            return;
+        }
+        auto at = std::upper_bound(out.begin(), out.end(), neighbor.distanceSq,
+                                   [](float d, const SpatialNeighbor& n) { return d < n.distanceSq; });
+        out.insert(at, neighbor);
+        if (out.size() > k) {
+            out.pop_back();
+        }
+    }
+
+    float cellSize = 100.0f;
+    float invCellSize = 0.01f;
+
+    // 셀 키 -> 셀에 속한 항목 (연속 배열)
+    std::unordered_map<uint64_t, Cell> cells;
+
+    // id -> 소속 셀과 셀 안의 위치
+    std::unordered_map<int, Entry> entries;
+};
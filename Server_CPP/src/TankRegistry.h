@@ -0,0 +1,307 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// TankInfo - 탱크 정보를 저장하는 구조체
+// 레지스트리에 넣고 꺼낼 때 사용하는 전체 레코드이며, 내부에서는 hot/cold로 나누어 저장합니다.
+struct TankInfo {
+    int clientId;
+    float posX;
+    float posY;
+    float direction;
+    int tankType;
+    float currentHealth;
+    float maxHealth;
+    bool isDestroyed;
+
+    TankInfo(int _clientId = 0, float _posX = 0, float _posY = 0, float _direction = 0,
+            int _tankType = -1, float _maxHealth = 100.0f)
+        : clientId(_clientId), posX(_posX), posY(_posY), direction(_direction),
+          tankType(_tankType), currentHealth(_maxHealth), maxHealth(_maxHealth), isDestroyed(false) {
+    }
+};
+
+// 매 SendMove마다 접근하는 hot 데이터 (위치/방향)
+struct TankPose {
+    float posX;
+    float posY;
+    float direction;
+};
+
+// 가끔 접근하는 cold 데이터 (타입/체력)
+struct TankStatus {
+    int clientId;
+    int tankType;
+    float currentHealth;
+    float maxHealth;
+    bool isDestroyed;
+};
+
+// 레지스트리 슬롯을 가리키는 핸들 - 슬롯이 재사용되면 generation이 달라져 무효가 됩니다
+struct TankHandle {
+    uint32_t slot;
+    uint32_t generation;
+
+    bool IsValid() const { return slot != InvalidSlot; }
+
+    static constexpr uint32_t InvalidSlot = 0xFFFFFFFFu;
+};
+
+// TankRegistry - HostID를 키로 하는 slot-map 구조의 탱크 저장소
+//  - 탱크 상태는 dense 배열에 연속으로 저장 (삭제 시 마지막 원소와 교체)
+//  - HostID -> 슬롯은 open addressing 해시로 O(1) 조회
+//  - 슬롯 -> dense 인덱스 간접 참조로 핸들이 삭제/재배치에도 안정적으로 유지됨
+class TankRegistry {
+public:
+    TankRegistry() { Rehash(16); }
+
+    // 탱크 추가 (이미 있으면 덮어씀)
+    TankHandle Insert(int hostId, const TankInfo& info) {
+        TankHandle existing = Find(hostId);
+        if (existing.IsValid()) {
+            uint32_t dense = slots[existing.slot].dense;
+            poses[dense] = TankPose{ info.posX, info.posY, info.direction };
+            statuses[dense] = MakeStatus(info);
+            poseDirty[dense] = 1;
+            return existing;
+        }
+
+        uint32_t slot;
+        if (freeSlotHead != TankHandle::InvalidSlot) {
+            slot = freeSlotHead;
+            freeSlotHead = slots[slot].dense;
+        } else {
+            slot = static_cast<uint32_t>(slots.size());
+            slots.push_back(Slot{ 0, 0 });
+        }
+
+        uint32_t dense = static_cast<uint32_t>(hostIds.size());
+        slots[slot].dense = dense;
+        hostIds.push_back(hostId);
+        denseToSlot.push_back(slot);
+        poses.push_back(TankPose{ info.posX, info.posY, info.direction });
+        statuses.push_back(MakeStatus(info));
+        poseDirty.push_back(1);
+
+        IndexInsert(hostId, slot);
+        return TankHandle{ slot, slots[slot].generation };
+    }
+
+    // 탱크 제거 - dense 배열의 마지막 원소를 빈 자리로 옮깁니다
+    bool Erase(int hostId) {
+        uint32_t slot = IndexErase(hostId);
+        if (slot == TankHandle::InvalidSlot) {
+            return false;
+        }
+
+        uint32_t dense = slots[slot].dense;
+        uint32_t last = static_cast<uint32_t>(hostIds.size()) - 1;
+        if (dense != last) {
+            hostIds[dense] = hostIds[last];
+            poses[dense] = poses[last];
+            statuses[dense] = statuses[last];
+            poseDirty[dense] = poseDirty[last];
+            denseToSlot[dense] = denseToSlot[last];
+            slots[denseToSlot[dense]].dense = dense;
+        }
+        hostIds.pop_back();
+        poses.pop_back();
+        statuses.pop_back();
+        poseDirty.pop_back();
+        denseToSlot.pop_back();
+
+        // 슬롯을 free list에 반환하고 세대를 올려 기존 핸들을 무효화
+        slots[slot].generation++;
+        slots[slot].dense = freeSlotHead;
+        freeSlotHead = slot;
+        return true;
+    }
+
+    // HostID로 핸들 조회 (없으면 IsValid() == false)
+    TankHandle Find(int hostId) const {
+        uint32_t mask = static_cast<uint32_t>(index.size()) - 1;
+        for (uint32_t i = HashOf(hostId) & mask; ; i = (i + 1) & mask) {
+            const IndexEntry& e = index[i];
+            if (e.slot == TankHandle::InvalidSlot) {
+                return TankHandle{ TankHandle::InvalidSlot, 0 };
+            }
+            if (e.hostId == hostId) {
+                return TankHandle{ e.slot, slots[e.slot].generation };
+            }
+        }
+    }
+
+    bool Contains(int hostId) const { return Find(hostId).IsValid(); }
+
+    // 핸들이 아직 살아있는 탱크를 가리키는지 확인
+    bool IsAlive(TankHandle handle) const {
+        return handle.IsValid() && handle.slot < slots.size() && slots[handle.slot].generation == handle.generation;
+    }
+
+    // 핸들로 데이터 접근 (IsAlive인 핸들만 사용)
+    TankPose& Pose(TankHandle handle) { return poses[slots[handle.slot].dense]; }
+    const TankPose& Pose(TankHandle handle) const { return poses[slots[handle.slot].dense]; }
+    TankStatus& Status(TankHandle handle) { return statuses[slots[handle.slot].dense]; }
+    const TankStatus& Status(TankHandle handle) const { return statuses[slots[handle.slot].dense]; }
+    int HostIdOf(TankHandle handle) const { return hostIds[slots[handle.slot].dense]; }
+
+    // 위치 변경 표시 - 다음 틱 스냅샷에 포함할 탱크를 고르는 데 사용
+    void MarkPoseDirty(TankHandle handle) { poseDirty[slots[handle.slot].dense] = 1; }
+    bool IsPoseDirty(TankHandle handle) const { return poseDirty[slots[handle.slot].dense] != 0; }
+
+    // 전체 레코드 조합 (콘솔 출력 등 드문 경로용)
+    TankInfo Get(TankHandle handle) const {
+        uint32_t dense = slots[handle.slot].dense;
+        const TankPose& pose = poses[dense];
+        const TankStatus& status = statuses[dense];
+        TankInfo info(status.clientId, pose.posX, pose.posY, pose.direction, status.tankType, status.maxHealth);
+        info.currentHealth = status.currentHealth;
+        info.isDestroyed = status.isDestroyed;
+        return info;
+    }
+
+    // dense 순회 - 0 <= i < Size() 범위에서 연속 메모리를 순서대로 접근합니다
+    size_t Size() const { return hostIds.size(); }
+    bool Empty() const { return hostIds.empty(); }
+    int HostIdAt(size_t i) const { return hostIds[i]; }
+    TankPose& PoseAt(size_t i) { return poses[i]; }
+    const TankPose& PoseAt(size_t i) const { return poses[i]; }
+    TankStatus& StatusAt(size_t i) { return statuses[i]; }
+    const TankStatus& StatusAt(size_t i) const { return statuses[i]; }
+    bool IsPoseDirtyAt(size_t i) const { return poseDirty[i] != 0; }
+    void ClearPoseDirtyAt(size_t i) { poseDirty[i] = 0; }
+    uint32_t SlotAt(size_t i) const { return denseToSlot[i]; }
+    TankHandle HandleAt(size_t i) const {
+        uint32_t slot = denseToSlot[i];
+        return TankHandle{ slot, slots[slot].generation };
+    }
+
+    // HostID 배열 전체 (멀티캐스트 수신자 목록 등에 사용)
+    const std::vector<int>& HostIds() const { return hostIds; }
+
+    void Reserve(size_t count) {
+        hostIds.reserve(count);
+        denseToSlot.reserve(count);
+        poses.reserve(count);
+        statuses.reserve(count);
+        poseDirty.reserve(count);
+        slots.reserve(count);
+        size_t wanted = 16;
+        while (wanted < count * 2) {
+            wanted <<= 1;
+        }
+        if (wanted > index.size()) {
+            Rehash(wanted);
+        }
+    }
+
+    void Clear() {
+        hostIds.clear();
+        denseToSlot.clear();
+        poses.clear();
+        statuses.clear();
+        poseDirty.clear();
+        slots.clear();
+        freeSlotHead = TankHandle::InvalidSlot;
+        indexCount = 0;
+        Rehash(16);
+    }
+
+private:
+    struct Slot {
+        uint32_t dense;       // 사용 중: dense 인덱스, 비어 있음: 다음 free 슬롯
+        uint32_t generation;
+    };
+
+    struct IndexEntry {
+        int hostId;
+        uint32_t slot;        // InvalidSlot이면 빈 칸
+    };
+
+    static uint32_t HashOf(int hostId) {
+        // HostID는 연속된 정수로 발급되므로 곱셈 해시로 섞어줍니다
+        return static_cast<uint32_t>(hostId) * 2654435761u;
+    }
+
+    static TankStatus MakeStatus(const TankInfo& info) {
+        return TankStatus{ info.clientId, info.tankType, info.currentHealth, info.maxHealth, info.isDestroyed };
+    }
+
+    void IndexInsert(int hostId, uint32_t slot) {
+        if ((indexCount + 1) * 2 > index.size()) {
+            Rehash(index.size() * 2);
+        }
+        uint32_t mask = static_cast<uint32_t>(index.size()) - 1;
+        uint32_t i = HashOf(hostId) & mask;
+        while (index[i].slot != TankHandle::InvalidSlot) {
+            i = (i + 1) & mask;
+        }
+        index[i] = IndexEntry{ hostId, slot };
+        indexCount++;
+    }
+
+    // 선형 탐사 테이블에서 삭제 - tombstone 없이 뒤쪽 원소를 당겨옵니다 (backward shift)
+    uint32_t IndexErase(int hostId) {
+        uint32_t mask = static_cast<uint32_t>(index.size()) - 1;
+        uint32_t i = HashOf(hostId) & mask;
+        while (true) {
+            if (index[i].slot == TankHandle::InvalidSlot) {
+                return TankHandle::InvalidSlot;
+            }
+            if (index[i].hostId == hostId) {
+                break;
+            }
+            i = (i + 1) & mask;
+        }
+
+        uint32_t slot = index[i].slot;
+        uint32_t hole = i;
+        for (uint32_t j = (i + 1) & mask; index[j].slot != TankHandle::InvalidSlot; j = (j + 1) & mask) {
+            uint32_t home = HashOf(index[j].hostId) & mask;
+            // home이 (hole, j] 구간 밖에 있으면 hole로 옮겨도 탐색 경로가 유지됨
+            bool movable = (hole <= j) ? (home <= hole || home > j) : (home <= hole && home > j);
+            if (movable) {
+                index[hole] = index[j];
+                hole = j;
+            }
+        }
+        index[hole].slot = TankHandle::InvalidSlot;
+        indexCount--;
+        return slot;
+    }
+
+    void Rehash(size_t newSize) {
+        std::vector<IndexEntry> old;
+        old.swap(index);
+        index.assign(newSize, IndexEntry{ 0, TankHandle::InvalidSlot });
+        indexCount = 0;
+        uint32_t mask = static_cast<uint32_t>(newSize) - 1;
+        for (const IndexEntry& e : old) {
+            if (e.slot != TankHandle::InvalidSlot) {
+                uint32_t i = HashOf(e.hostId) & mask;
+                while (index[i].slot != TankHandle::InvalidSlot) {
+                    i = (i + 1) & mask;
+                }
+                index[i] = e;
+                indexCount++;
+            }
+        }
+    }
+
+    // dense 배열 (hot/cold 분리)
+    std::vector<int> hostIds;
+    std::vector<uint32_t> denseToSlot;
+    std::vector<TankPose> poses;
+    std::vector<TankStatus> statuses;
+    std::vector<uint8_t> poseDirty;
+
+    // 슬롯 테이블과 free list
+    std::vector<Slot> slots;
+    uint32_t freeSlotHead = TankHandle::InvalidSlot;
+
+    // HostID -> 슬롯 해시 인덱스 (크기는 항상 2의 거듭제곱)
+    std::vector<IndexEntry> index;
+    size_t indexCount = 0;
+};
@@ -10,6 +10,7 @@
 #include <random>
 #include <cmath>
 #include <sstream>
+#include <cstring>
 
 // Windows 헤더 포함
 #ifdef _WIN32
@@ -27,14 +28,36 @@
 // Common 디렉토리의 Vars.h를 include합니다
 #include "../../Common/Vars.h"
 
+// 비동기 로그
+#include "AsyncLog.h"
+
+// 게임 로직 (전송 계층과 분리된 월드, 이벤트 싱크 인터페이스)
+#include "GameWorld.h"
+
+// 틱 루프와 서버 설정
+#include "TickLoop.h"
+#include "ServerConfig.h"
+
+// 시뮬레이션 액터 명령 큐와 잠금 대기 측정
+#include "MpscQueue.h"
+#include "SimCommand.h"
+#include "LockStats.h"
+
+// 방 단위 샤딩 (방별 월드, 방을 고정한 워커 스레드)
+#include "RoomManager.h"
+
+// RMI별 처리 시간 히스토그램과 수신 바이트
+#include "RmiMetrics.h"
+
+// /metrics, /healthz HTTP 엔드포인트
+#include "MetricsHttpServer.h"
+
+// 수신 RMI 캡처 (재생 벤치마크용)
+#include "RmiCapture.h"
+
 using namespace std;
 using namespace Proud;
 
-// 디버그 출력 함수
-inline void DebugLog(const std::string& message) {
-    std::cout << message << std::endl;
-}
-
 // RmiContext 생성 함수
 inline ::Proud::RmiContext CreateServerRmiContext() {
     ::Proud::RmiContext rmiCtx;
@@ -42,42 +65,299 @@ inline ::Proud::RmiContext CreateServerRmiContext() {
     return rmiCtx;
 }
 
+// 캡처 파일의 RMI ID 사본이 PIDL 생성 값과 같은지 확인
+static_assert(CaptureRmiId::SendMove == Tank::Rmi_SendMove, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::SendFire == Tank::Rmi_SendFire, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::SendTankType == Tank::Rmi_SendTankType, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::SendTankHealthUpdated == Tank::Rmi_SendTankHealthUpdated, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::SendTankDestroyed == Tank::Rmi_SendTankDestroyed, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::SendTankSpawned == Tank::Rmi_SendTankSpawned, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::P2PMessage == Tank::Rmi_P2PMessage, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::SendHello == Tank::Rmi_SendHello, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::SendMoveCompact == Tank::Rmi_SendMoveCompact, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::SendSnapshotAck == Tank::Rmi_SendSnapshotAck, "capture RMI ID mismatch");
+static_assert(CaptureRmiId::SendMoveSequenced == Tank::Rmi_SendMoveSequenced, "capture RMI ID mismatch");
+
+// 시뮬레이션 명령 - 월드 명령 그대로 (P2P 메시지는 핸들러에서 std::string으로 변환)
+typedef GameCommand TankCommand;
+
+inline TankCommand MakeTankCommand(SimCommandType type, ::Proud::HostID remote) {
+    TankCommand command;
+    command.type = type;
+    command.remote = (int)remote;
+    command.enqueueNs = 0;
+    return command;
+}
+
+// ProudNet 전송 어댑터 - 월드 이벤트를 생성된 Proxy의 RMI 호출과 P2P 그룹 API로 전달
+class ProudNetEventSink : public GameEventSink {
+public:
+    ProudNetEventSink(Tank::Proxy& proxy, std::shared_ptr<::Proud::CNetServer>& server, bool compressWorldSnapshot,
+                      bool unreliablePositions)
+        : proxy(proxy), server(server), compressWorldSnapshot(compressWorldSnapshot), unreliablePositions(unreliablePositions) {}
+
+    // 방이 닫히면 싱크도 함께 해제되므로 방의 P2P 그룹을 정리 (서버가 이미 내려갔으면 ProudNet이 정리)
+    ~ProudNetEventSink() override {
+        if (p2pGroupId != ::Proud::HostID_None && server) {
+            server->DestroyP2PGroup(p2pGroupId);
+        }
+    }
+
+    void OnPlayerJoined(const int* recipients, int count, int clientId, float posX, float posY, int tankType) override {
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.OnPlayerJoined(ToHostIDs(recipients), count, rmiCtx, clientId, posX, posY, tankType);
+    }
 
-// TankInfo - 탱크 정보를 저장하는 구조체
-struct TankInfo {
-    int clientId;
-    float posX;
-    float posY;
-    float direction;
-    int tankType;
-    float currentHealth;
-    float maxHealth;
-    bool isDestroyed;
+    void OnPlayerLeft(const int* recipients, int count, int clientId) override {
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.OnPlayerLeft(ToHostIDs(recipients), count, rmiCtx, clientId);
+    }
 
-    TankInfo(int _clientId = 0, float _posX = 0, float _posY = 0, float _direction = 0, 
-            int _tankType = -1, float _maxHealth = 100.0f)
-        : clientId(_clientId), posX(_posX), posY(_posY), direction(_direction),
-          tankType(_tankType), maxHealth(_maxHealth), currentHealth(_maxHealth), isDestroyed(false) {
+    void OnTankHealthUpdated(const int* recipients, int count, int clientId, float currentHealth, float maxHealth) override {
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.OnTankHealthUpdated(ToHostIDs(recipients), count, rmiCtx, clientId, currentHealth, maxHealth);
+    }
+
+    void OnTankDestroyed(const int* recipients, int count, int clientId, int destroyedById) override {
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.OnTankDestroyed(ToHostIDs(recipients), count, rmiCtx, clientId, destroyedById);
+    }
+
+    void OnTankSpawned(const int* recipients, int count, int clientId, float posX, float posY, float direction, 
+                       int tankType, float initialHealth) override {
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.OnTankSpawned(ToHostIDs(recipients), count, rmiCtx, clientId, posX, posY, direction, tankType, initialHealth);
+    }
+
+    void OnSpawnBullet(const int* recipients, int count, int clientId, int shooterId, float posX, float posY, 
+                       float direction, float launchForce, float fireX, float fireY, float fireZ) override {
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.OnSpawnBullet(ToHostIDs(recipients), count, rmiCtx, clientId, shooterId, posX, posY, 
+                            direction, launchForce, fireX, fireY, fireZ);
+    }
+
+    // SendHello 이전 클라이언트의 위치 - 틱 번호 없이 받은 순서대로 적용하므로 기존처럼 신뢰 전송
+    void OnTankPositionUpdated(const int* recipients, int count, int clientId, float posX, float posY, float direction) override {
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.OnTankPositionUpdated(ToHostIDs(recipients), count, rmiCtx, clientId, posX, posY, direction);
+    }
+
+    void OnTankSnapshot(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) override {
+        ::Proud::ByteArray snapshot;
+        snapshot.SetCount((int)size);
+        memcpy(snapshot.GetData(), data, size);
+        
+        ::Proud::RmiContext rmiCtx = CreatePositionRmiContext();
+        proxy.OnTankSnapshot(ToHostIDs(recipients), count, rmiCtx, tickId, snapshot);
+    }
+
+    // 범위를 벗어난 탱크는 다시 들어오기 전까지 위치를 받지 않으므로, 유실되면 멈춘 탱크가 남지 않도록 신뢰 전송
+    void OnTanksOutOfRange(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) override {
+        ::Proud::ByteArray clientIds;
+        clientIds.SetCount((int)size);
+        memcpy(clientIds.GetData(), data, size);
+        
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.OnTanksOutOfRange(ToHostIDs(recipients), count, rmiCtx, tickId, clientIds);
+    }
+
+    void OnWorldSnapshot(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) override {
+        ::Proud::ByteArray world;
+        world.SetCount((int)size);
+        memcpy(world.GetData(), data, size);
+        
+        // 탱크 항목은 타입/체력 값이 반복되어 잘 압축되므로, 작은 방이 아니면 ProudNet 압축 사용
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        if (compressWorldSnapshot && size >= WorldSnapshotCompressMinBytes) {
+            rmiCtx.m_compressMode = ::Proud::CM_Zip;
+        }
+        proxy.OnWorldSnapshot(ToHostIDs(recipients), count, rmiCtx, tickId, world);
+    }
+
+    void OnTankSnapshotCompact(const int* recipients, int count, int tickId, const uint8_t* data, size_t size) override {
+        ::Proud::ByteArray snapshot;
+        snapshot.SetCount((int)size);
+        memcpy(snapshot.GetData(), data, size);
+        
+        ::Proud::RmiContext rmiCtx = CreatePositionRmiContext();
+        proxy.OnTankSnapshotCompact(ToHostIDs(recipients), count, rmiCtx, tickId, snapshot);
+    }
+
+    void OnRoomSlots(const int* recipients, int count, const uint8_t* data, size_t size) override {
+        ::Proud::ByteArray slots;
+        slots.SetCount((int)size);
+        memcpy(slots.GetData(), data, size);
+        
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.OnRoomSlots(ToHostIDs(recipients), count, rmiCtx, slots);
+    }
+
+    void OnTankDeltaSnapshot(const int* recipients, int count, int tickId, int baselineTickId,
+                             const uint8_t* data, size_t size) override {
+        ::Proud::ByteArray delta;
+        delta.SetCount((int)size);
+        memcpy(delta.GetData(), data, size);
+        
+        ::Proud::RmiContext rmiCtx = CreatePositionRmiContext();
+        proxy.OnTankDeltaSnapshot(ToHostIDs(recipients), count, rmiCtx, tickId, baselineTickId, delta);
+    }
+
+    void P2PMessage(const int* recipients, int count, const std::string& message) override {
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        proxy.P2PMessage(ToHostIDs(recipients), count, rmiCtx, ::Proud::String(message.c_str()));
+    }
+
+    int CreateP2PGroup(const int* members, int count) override {
+        // Sample 코드 참조 - ByteArray 없이 호출
+        p2pGroupId = server->CreateP2PGroup(ToHostIDs(members), count);
+        return (int)p2pGroupId;
+    }
+
+    bool JoinP2PGroup(int hostId, int groupId) override {
+        return server->JoinP2PGroup((::Proud::HostID)hostId, (::Proud::HostID)groupId);
+    }
+
+    void LeaveP2PGroup(int hostId, int groupId) override {
+        server->LeaveP2PGroup((::Proud::HostID)hostId, (::Proud::HostID)groupId);
+    }
+
+private:
+    // 위치 스냅샷용 RmiContext - 비신뢰면 UDP가 있는 클라이언트에게는 UDP로 보내 유실된 패킷이 이후 스냅샷을 막지 않게 함
+    // (UDP가 없는 WebSocket 등은 ProudNet이 TCP로 대체, 파괴/생성 같은 이벤트는 계속 신뢰 전송)
+    ::Proud::RmiContext CreatePositionRmiContext() const {
+        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
+        if (unreliablePositions) {
+            rmiCtx.m_reliability = ::Proud::MessageReliability_Unreliable;
+        }
+        return rmiCtx;
+    }
+
+    // 월드의 int 수신자 배열을 복사 없이 HostID 배열로 넘김 (HostID는 int 크기의 enum)
+    static ::Proud::HostID* ToHostIDs(const int* recipients) {
+        static_assert(sizeof(::Proud::HostID) == sizeof(int), "HostID must be int-sized");
+        return reinterpret_cast<::Proud::HostID*>(const_cast<int*>(recipients));
+    }
+
+    // 이보다 작은 방 상태는 압축 이득보다 비용이 커서 그대로 전송 (탱크 8대 = 256바이트)
+    static const size_t WorldSnapshotCompressMinBytes = 256;
+
+    Tank::Proxy& proxy;
+    std::shared_ptr<::Proud::CNetServer>& server;
+    bool compressWorldSnapshot;
+    bool unreliablePositions;
+    ::Proud::HostID p2pGroupId = ::Proud::HostID_None;
+};
+
+// 방 월드 누적 카운터의 합계 (메트릭 출력용) - 닫힌 방의 값은 따로 더해 두어 방이 닫혀도 카운터가 줄지 않게 함
+struct WorldMetricTotals {
+    static constexpr SnapshotFormat Formats[] = { SnapshotFormat::Float, SnapshotFormat::Compact, SnapshotFormat::Delta,
+                                                  SnapshotFormat::Legacy };
+    static const size_t FormatCount = sizeof(Formats) / sizeof(Formats[0]);
+    
+    double snapshotClients[FormatCount] = {};
+    double snapshotBytes[FormatCount] = {};
+    double snapshotDeliveries[FormatCount] = {};
+    double snapshotFullFallbacks = 0.0, outOfOrderMoves = 0.0, compactOutOfRangeMoves = 0.0, lodSent = 0.0, lodDeferred = 0.0;
+    double deadReckoningForwarded = 0.0, deadReckoningSuppressed = 0.0;
+    double backlogCoalescing = 0.0, backlogDropping = 0.0, backlogSkipped = 0.0, backlogCoalesced = 0.0;
+    double backlogDroppedBullets = 0.0, backlogDisconnects = 0.0;
+    double projectilesLive = 0.0, projectilesSpawned = 0.0, projectileHits = 0.0, projectileKills = 0.0;
+    double projectilesExpired = 0.0, projectilesDropped = 0.0, ignoredHitReports = 0.0;
+    double lagRewoundShots = 0.0, lagRewoundTargets = 0.0, lagClampedTargets = 0.0, lagRewindHits = 0.0;
+    double lagRewindSeconds = 0.0, poseHistoryBytes = 0.0;
+    LockWaitTotals lockWait;
+    
+    // 방 하나의 값을 더함 (atomic 통계만 읽음)
+    void Add(Room& room) {
+        const GameWorld& world = room.World();
+        const SnapshotStats& snapshots = world.SnapshotStatsRef();
+        for (size_t f = 0; f < FormatCount; f++) {
+            const SnapshotFormatCounters& counters = snapshots.Format(Formats[f]);
+            snapshotClients[f] += (double)counters.clients.load(std::memory_order_relaxed);
+            snapshotBytes[f] += (double)counters.bytes.load(std::memory_order_relaxed);
+            snapshotDeliveries[f] += (double)counters.deliveries.load(std::memory_order_relaxed);
+        }
+        snapshotFullFallbacks += (double)snapshots.fullFallbacks.load(std::memory_order_relaxed);
+        outOfOrderMoves += (double)world.OutOfOrderMoveCount();
+        compactOutOfRangeMoves += (double)world.CompactOutOfRangeMoveCount();
+        const PriorityStats& priority = world.PriorityStatsRef();
+        lodSent += (double)priority.sent.load(std::memory_order_relaxed);
+        lodDeferred += (double)priority.deferred.load(std::memory_order_relaxed);
+        const DeadReckoningStats& deadReckoning = world.DeadReckoningStatsRef();
+        deadReckoningForwarded += (double)deadReckoning.forwarded.load(std::memory_order_relaxed);
+        deadReckoningSuppressed += (double)deadReckoning.suppressed.load(std::memory_order_relaxed);
+        const SendBacklogStats& backlog = world.SendBacklogStatsRef();
+        backlogCoalescing += (double)backlog.coalescingClients.load(std::memory_order_relaxed);
+        backlogDropping += (double)backlog.droppingClients.load(std::memory_order_relaxed);
+        backlogSkipped += (double)backlog.skipped.load(std::memory_order_relaxed);
+        backlogCoalesced += (double)backlog.coalesced.load(std::memory_order_relaxed);
+        backlogDroppedBullets += (double)backlog.droppedBullets.load(std::memory_order_relaxed);
+        backlogDisconnects += (double)backlog.disconnects.load(std::memory_order_relaxed);
+        const ProjectileStats& shells = world.ProjectileStatsRef();
+        projectilesLive += (double)shells.live.load(std::memory_order_relaxed);
+        projectilesSpawned += (double)shells.spawned.load(std::memory_order_relaxed);
+        projectileHits += (double)shells.hits.load(std::memory_order_relaxed);
+        projectileKills += (double)shells.kills.load(std::memory_order_relaxed);
+        projectilesExpired += (double)shells.expired.load(std::memory_order_relaxed);
+        projectilesDropped += (double)shells.dropped.load(std::memory_order_relaxed);
+        ignoredHitReports += (double)shells.ignoredReports.load(std::memory_order_relaxed);
+        const LagCompensationStats& lag = world.LagCompensationStatsRef();
+        lagRewoundShots += (double)lag.rewoundShots.load(std::memory_order_relaxed);
+        lagRewoundTargets += (double)lag.rewoundTargets.load(std::memory_order_relaxed);
+        lagClampedTargets += (double)lag.clampedTargets.load(std::memory_order_relaxed);
+        lagRewindHits += (double)lag.rewindHits.load(std::memory_order_relaxed);
+        lagRewindSeconds += (double)lag.rewindNs.load(std::memory_order_relaxed) / 1e9;
+        poseHistoryBytes += (double)lag.historyBytes.load(std::memory_order_relaxed);
+        
+        LockWaitTotals roomLock = room.Mutex().Totals();
+        lockWait.acquireCount += roomLock.acquireCount;
+        lockWait.contendedCount += roomLock.contendedCount;
+        lockWait.waitSumSeconds += roomLock.waitSumSeconds;
     }
 };
 
-// TankServer 클래스 - 탱크 게임 서버
+// TankServer 클래스 - 탱크 게임 서버 (ProudNet 스텁/이벤트를 월드 명령으로 바꿔 클라이언트가 배정된 방으로 전달)
 class TankServer : public Tank::Stub {
 private:
     // RMI 프록시 인스턴스
     Tank::Proxy tankProxy;
     
-    // P2P 그룹 ID
-    ::Proud::HostID gameP2PGroupID;
-    
-    // 연결된 탱크들의 정보
-    std::map<::Proud::HostID, TankInfo> tanks;
-    
     // 네트워크 서버 인스턴스
     std::shared_ptr<::Proud::CNetServer> server;
     
-    // 뮤텍스 - 스레드 안전성 보장
-    std::mutex mutex;
+    // 방별 게임 월드와 워커 스레드 - 방마다 월드 이벤트를 ProudNet RMI로 보내는 어댑터를 따로 두고,
+    // actor 모드에서는 방이 고정된 워커의 명령 큐로, lock 모드에서는 방 뮤텍스를 잡고 전달
+    RoomManager rooms;
+    
+    // RMI별 호출 수/수신 바이트/핸들러 처리 시간 (스텁 프로파일링 훅에서 기록)
+    RmiMetrics rmiMetrics;
+    
+    // 콘솔 rmi 명령의 구간 계산용 이전 스냅샷
+    vector<RmiTypeStats> lastRmiStats;
+    std::chrono::steady_clock::time_point lastRmiStatsTime;
+    
+    // 메트릭 HTTP 서버 - 스크레이프는 아래 atomic 값과 각 모듈의 누적 카운터만 읽고 게임 뮤텍스는 잡지 않음
+    MetricsHttpServer metricsServer;
+    
+    // ProudNet 송수신 누적 바이트 (워커 스레드 중 하나가 1초마다 GetStats로 갱신)
+    std::atomic<int64_t> networkSentBytes{ 0 };
+    std::atomic<int64_t> networkReceivedBytes{ 0 };
+    std::atomic<int64_t> lastNetworkSampleNs{ 0 };
+    
+    // 방별 클라이언트 송신 대기열 크기 (방의 워커가 1초마다 복사, 메트릭 스레드가 읽음)
+    std::mutex sendQueueSampleMutex;
+    std::map<int, vector<std::pair<int, uint32_t>>> sendQueueSamples;
+    
+    // 닫힌 방들의 월드 누적 카운터 합계 (방을 해제하기 직전에 그 방의 워커가 더함)
+    std::mutex retiredRoomsMutex;
+    WorldMetricTotals retiredRoomTotals;
+    
+    // 수신 RMI 캡처 (--capture 지정 시에만 기록)
+    RmiCaptureWriter capture;
+    uint32_t captureSeed = 0;
+    
+    // 서버 설정
+    ServerConfig config;
     
     // 초기화 함수
     void Initialize();
@@ -88,14 +368,47 @@ private:
     // 클라이언트 접속 종료 처리
     void OnClientLeave(::Proud::CNetClientInfo* clientInfo, ::Proud::ErrorInfo* errorInfo, const ::Proud::ByteArray& comment);
     
-    // P2P 그룹 업데이트
-    void UpdateP2PGroup();
+    // 새 방의 월드 설정 (방을 열 때 RoomManager가 호출, 워커가 방을 가져가기 전)
+    void SetupRoomWorld(GameWorld& world, int roomId);
+    
+    // 빈 방을 닫을 때 누적 카운터를 옮기고 방별 샘플 정리 (방의 워커 스레드)
+    void OnRoomClosed(Room& room);
     
     // 커맨드 처리 루프
     void ProcessCommands();
     
-    // 연결된 클라이언트 정보 출력
-    void PrintConnectedClients();
+    // 틱 루프 처리 시간/지터 출력
+    void PrintTickStats();
+    
+    // 명령 큐 깊이/적용 지연/잠금 대기 출력
+    void PrintSimStats();
+    
+    // 방별 워커/탱크 수/적용한 명령/틱 처리 시간 출력
+    void PrintRoomStats();
+    
+    // RMI별 호출 수/초, 수신 바이트, 처리 시간 퍼센타일 출력
+    void PrintRmiStats();
+    
+    // 메트릭 HTTP 요청 처리 (HTTP 스레드)
+    int HandleHttpRequest(const std::string& path, std::string& contentType, std::string& body);
+    
+    // 캡처 시작 (월드 난수 시드를 함께 기록해 재생 결과가 같도록 함)
+    void StartCapture();
+    
+    // 캡처 상태 출력
+    void PrintCaptureStats();
+    
+    // Prometheus 형식 메트릭 본문
+    std::string BuildMetricsText();
+    
+    // ProudNet 송수신 통계를 1초마다 atomic 복사본으로 갱신 (워커 스레드)
+    void SampleNetworkStats();
+    
+    // 방 클라이언트의 송신 대기열 크기를 월드에 반영하고, 읽지 않는 클라이언트 연결 종료 (방의 워커 스레드)
+    void SampleSendQueues(Room& room, uint32_t tickId);
+    
+    // 로그 레벨 조회/변경
+    void ConfigureLog(const string& input);
     
     // 탱크 체력 정보 출력
     void ShowTankHealth(const string& input);
@@ -108,17 +421,19 @@ private:
     
     // 탱크 리스폰
     void RespawnTank(const string& input);
-    
-    // 클라이언트 ID로 HostID 찾기
-    ::Proud::HostID FindHostIDById(int clientId);
 
 public:
-    TankServer();
+    TankServer(const ServerConfig& serverConfig = ServerConfig());
     ~TankServer();
     
     // 서버 시작
     void Start();
     
+    // 스텁 프로파일링 훅 - 핸들러 처리 시간과 수신 바이트 기록
+    void BeforeRmiInvocation(const ::Proud::BeforeRmiSummary& summary) override;
+    void AfterRmiInvocation(const ::Proud::AfterRmiSummary& summary) override;
+    bool BeforeDeserialize(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, ::Proud::CMessage& message) override;
+    
     // RMI 스텁 메서드 정의 (Tank::Stub에서 상속)
 #ifdef _WIN32
     // Windows에서는 클래스 이름 필요
@@ -129,6 +444,10 @@ public:
     DEFRMI_Tank_SendTankDestroyed(TankServer);
     DEFRMI_Tank_SendTankSpawned(TankServer);
     DEFRMI_Tank_P2PMessage(TankServer);
+    DEFRMI_Tank_SendHello(TankServer);
+    DEFRMI_Tank_SendMoveCompact(TankServer);
+    DEFRMI_Tank_SendSnapshotAck(TankServer);
+    DEFRMI_Tank_SendMoveSequenced(TankServer);
 #else
     // Linux에서는 매크로를 사용하지 않고 직접 선언
     bool SendMove(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const float& posX, const float& posY, const float& direction);
@@ -138,11 +457,76 @@ public:
     bool SendTankDestroyed(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int& destroyedById);
     bool SendTankSpawned(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const float& posX, const float& posY, const float& direction, const int& tankType, const float& initialHealth);
     bool P2PMessage(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const ::Proud::String& message);
+    bool SendHello(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int& protocolRevision);
+    bool SendMoveCompact(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int16_t& posX, const int16_t& posY, const uint8_t& direction);
+    bool SendSnapshotAck(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int& tickId);
+    bool SendMoveSequenced(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const uint16_t& sequence, const int16_t& posX, const int16_t& posY, const uint8_t& direction);
 #endif
 };
 
-// 생성자
-TankServer::TankServer() : gameP2PGroupID(::Proud::HostID_None) {
+// PIDL에 정의된 RMI ID 범위 (RmiMetrics 배열 크기)
+static int FirstTankRmiID() {
+    int first = Tank::g_RmiIDList[0];
+    for (int i = 1; i < Tank::g_RmiIDListCount; i++) {
+        first = std::min(first, (int)Tank::g_RmiIDList[i]);
+    }
+    return first;
+}
+
+static int TankRmiIDRange() {
+    int last = Tank::g_RmiIDList[0];
+    for (int i = 1; i < Tank::g_RmiIDListCount; i++) {
+        last = std::max(last, (int)Tank::g_RmiIDList[i]);
+    }
+    return last - FirstTankRmiID() + 1;
+}
+
+// 서버 설정에서 방 관리 설정 (워커 수 0이면 하드웨어 스레드 수)
+static RoomManagerConfig MakeRoomConfig(const ServerConfig& serverConfig) {
+    RoomManagerConfig roomConfig;
+    roomConfig.workers = serverConfig.roomWorkers > 0 ? serverConfig.roomWorkers
+                                                      : std::max(1, (int)std::thread::hardware_concurrency());
+    roomConfig.roomSize = serverConfig.roomSize;
+    roomConfig.tickRateHz = serverConfig.tickRateHz;
+    roomConfig.useActor = serverConfig.useSimulationActor;
+    roomConfig.interestRadius = serverConfig.interestRadius;
+    roomConfig.matchWindowMs = serverConfig.matchWindowMs;
+    roomConfig.emptyRoomTimeoutMs = serverConfig.emptyRoomTimeoutSeconds * 1000;
+    return roomConfig;
+}
+
+// 포탄 지연 보상 설정 (서버 판정 포탄을 켰을 때만 사용)
+static LagCompensationConfig MakeLagCompensationConfig(const ServerConfig& serverConfig) {
+    LagCompensationConfig lagConfig;
+    lagConfig.maxRewindMs = serverConfig.lagCompensationMs;
+    lagConfig.historySamples = (uint32_t)serverConfig.poseHistorySamples;
+    return lagConfig;
+}
+
+// 생성자 - 방은 매치메이커가 필요할 때 열며, 방마다 ProudNet 전송 어댑터를 만들어 월드에 연결
+TankServer::TankServer(const ServerConfig& serverConfig) 
+    : rooms(MakeRoomConfig(serverConfig), 
+            [this](int) {
+                return std::unique_ptr<GameEventSink>(new ProudNetEventSink(tankProxy, server, config.compressWorldSnapshot, 
+                                                                            config.unreliablePositions));
+            },
+            [this](GameWorld& world, int roomId) { SetupRoomWorld(world, roomId); }), 
+      rmiMetrics(FirstTankRmiID(), TankRmiIDRange()), config(serverConfig) {
+    // 생성된 RmiName_*은 USE_RMI_NAME_STRING 없이는 빈 문자열이므로 서버가 받는 RMI 이름을 직접 등록
+    rmiMetrics.SetName(Tank::Rmi_SendMove, "SendMove");
+    rmiMetrics.SetName(Tank::Rmi_SendFire, "SendFire");
+    rmiMetrics.SetName(Tank::Rmi_SendTankType, "SendTankType");
+    rmiMetrics.SetName(Tank::Rmi_SendTankHealthUpdated, "SendTankHealthUpdated");
+    rmiMetrics.SetName(Tank::Rmi_SendTankDestroyed, "SendTankDestroyed");
+    rmiMetrics.SetName(Tank::Rmi_SendTankSpawned, "SendTankSpawned");
+    rmiMetrics.SetName(Tank::Rmi_P2PMessage, "P2PMessage");
+    rmiMetrics.SetName(Tank::Rmi_SendHello, "SendHello");
+    rmiMetrics.SetName(Tank::Rmi_SendMoveCompact, "SendMoveCompact");
+    rmiMetrics.SetName(Tank::Rmi_SendSnapshotAck, "SendSnapshotAck");
+    rmiMetrics.SetName(Tank::Rmi_SendMoveSequenced, "SendMoveSequenced");
+    lastRmiStatsTime = std::chrono::steady_clock::now();
+    rooms.SetRoomClosedHook([this](Room& room) { OnRoomClosed(room); });
+    
     // 서버 객체 생성 - shared_ptr로 래핑
     server = std::shared_ptr<::Proud::CNetServer>(::Proud::CNetServer::Create());
 }
@@ -152,6 +536,64 @@ TankServer::~TankServer() {
     if (server) {
         server->Stop();
     }
+    rooms.Stop();
+}
+
+// 새 방의 월드 설정 - 방을 열 때 호출 (방의 워커가 아직 틱에 포함하기 전이라 잠금 없이 설정)
+void TankServer::SetupRoomWorld(GameWorld& world, int roomId) {
+    // SendHello는 접속 완료 직후 오므로 1초 안에 오지 않으면 이전 클라이언트로 보고 탱크별 RMI로 방 상태 전송
+    world.SetHelloWaitTicks((uint32_t)config.tickRateHz);
+    
+    // 비신뢰 위치 스트림은 1초마다 전체 위치를 다시 보내 유실된 마지막 위치를 복구
+    if (config.unreliablePositions) {
+        world.SetPositionRefreshTicks((uint32_t)config.tickRateHz);
+    }
+    
+    // 데드 레커닝 - 하트비트는 틱 단위로 변환 (0이 아니면 최소 1틱)
+    if (config.deadReckoningThreshold > 0.0f) {
+        DeadReckoningConfig deadReckoning;
+        deadReckoning.positionThreshold = config.deadReckoningThreshold;
+        deadReckoning.heartbeatTicks = config.deadReckoningHeartbeatMs > 0
+            ? (uint32_t)std::max(1, config.deadReckoningHeartbeatMs * config.tickRateHz / 1000) : 0u;
+        world.SetDeadReckoning(deadReckoning);
+    }
+    
+    // 관찰자별 우선순위 스냅샷 - 발사 가중치는 1초 동안 유지
+    if (config.lodBudget > 0) {
+        PriorityConfig priority;
+        priority.budget = config.lodBudget;
+        priority.nearDistance = config.lodNearDistance;
+        priority.fireBoostTicks = (uint32_t)config.tickRateHz;
+        world.SetPriorityScheduling(priority);
+    }
+    
+    // 송신 대기열 백프레셔 - 모은 위치는 4Hz, 위치를 보내지 않는 상태가 10초 이어지면 연결 종료
+    if (config.sendQueueHighKB > 0) {
+        SendBacklogConfig backlog;
+        backlog.highWaterBytes = (uint32_t)config.sendQueueHighKB * 1024;
+        backlog.disconnectBytes = (uint32_t)config.sendQueueLimitKB * 1024;
+        backlog.coalesceTicks = (uint32_t)std::max(1, config.tickRateHz / 4);
+        backlog.dropTimeoutTicks = config.sendQueueLimitKB > 0 ? (uint32_t)config.tickRateHz * 10 : 0u;
+        world.SetSendBacklog(backlog);
+    }
+    
+    // 서버 판정 포탄 - 틱마다 한 번 적분/충돌
+    if (config.serverProjectiles) {
+        ProjectileConfig projectiles;
+        projectiles.tickSeconds = 1.0f / (float)config.tickRateHz;
+        world.SetProjectiles(projectiles);
+        world.SetLagCompensation(MakeLagCompensationConfig(config));
+    }
+    
+    // 접속 위치를 다른 탱크에서 떨어진 곳으로 (관심 영역과 같은 공간 해시를 씀)
+    if (config.spawnCandidates > 1) {
+        world.SetSpawnCandidates(config.spawnCandidates);
+    }
+    
+    // 캡처 중이면 방마다 다른 시드 (RmiReplay는 월드 하나로 재생하므로 방 1의 결과와 같음)
+    if (capture.IsOpen()) {
+        world.SetRandomSeed(captureSeed + (uint32_t)roomId - 1);
+    }
 }
 
 // 초기화 함수
@@ -159,6 +601,9 @@ void TankServer::Initialize() {
     // 스텁과 프록시를 서버에 연결
     server->AttachStub(this);
     server->AttachProxy(&tankProxy);
+    
+    // Before/AfterRmiInvocation 훅 활성화 (RMI별 처리 시간 측정)
+    m_enableStubProfiling = true;
 
     // 클라이언트 접속 이벤트 핸들러
     server->OnClientJoin = [this](CNetClientInfo* clientInfo) {
@@ -171,144 +616,66 @@ void TankServer::Initialize() {
     };
 }
 
+// 빈 방을 닫을 때 - 월드 누적 카운터를 닫힌 방 합계로 옮기고 방별 송신 대기열 샘플 삭제 (방의 워커 스레드)
+void TankServer::OnRoomClosed(Room& room) {
+    {
+        std::lock_guard<std::mutex> lock(retiredRoomsMutex);
+        retiredRoomTotals.Add(room);
+    }
+    std::lock_guard<std::mutex> lock(sendQueueSampleMutex);
+    sendQueueSamples.erase(room.Id());
+}
+
 // 클라이언트 접속 처리
 void TankServer::OnClientJoin(::Proud::CNetClientInfo* clientInfo) {
-    std::lock_guard<std::mutex> lock(mutex);
-    
-    HostID hostId = clientInfo->m_HostID;
-    
-    // 랜덤 위치 생성 (예: 0~100 범위)
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> dis(0.0f, 100.0f);
-    float posX = dis(gen);
-    float posY = dis(gen);
-    
-    // 초기 탱크 타입은 -1로 설정 (선택 안함)
-    int defaultTankType = -1;
-    
-    // 초기 체력 설정
-    float defaultMaxHealth = 100.0f;
-    float defaultHealth = defaultMaxHealth;
-    
-    // 탱크 정보 저장
-    TankInfo newTank((int)hostId, posX, posY, 0, defaultTankType, defaultMaxHealth);
-    tanks[hostId] = newTank;
-    
-    DebugLog("Client connected: Host ID = " + std::to_string(static_cast<int>(hostId)));
-    DebugLog("New tank created for client " + std::to_string(static_cast<int>(hostId)) + " with tank type " + std::to_string(defaultTankType) 
-         + " and health " + std::to_string(defaultHealth) + "/" + std::to_string(defaultMaxHealth));
-    
-    // 새 클라이언트에게 기존 탱크 정보 전송
-    for (const auto& tank : tanks) {
-        if (tank.first != hostId) { // 본인 제외
-            // 기존 플레이어 정보 전송
-            ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-            
-            tankProxy.OnPlayerJoined(hostId, rmiCtx, (int)tank.first, 
-                                    tank.second.posX, tank.second.posY, tank.second.tankType);
-            
-            // 기존 플레이어 체력 정보 전송
-            tankProxy.OnTankHealthUpdated(hostId, rmiCtx, (int)tank.first, 
-                                        tank.second.currentHealth, tank.second.maxHealth);
-            
-            // 기존 플레이어가 파괴 상태라면 파괴 정보도 전송
-            if (tank.second.isDestroyed) {
-                tankProxy.OnTankDestroyed(hostId, rmiCtx, (int)tank.first, 0); // 파괴자 ID 정보가 없으므로 0(환경)으로 설정
-            }
-            
-            DebugLog("Sending existing player info to new client: ID=" + std::to_string(static_cast<int>(tank.first)) 
-                 + ", Type=" + std::to_string(tank.second.tankType) 
-                 + ", Health=" + std::to_string(tank.second.currentHealth) + "/" + std::to_string(tank.second.maxHealth));
-        }
+    if (capture.IsOpen()) {
+        capture.AppendJoin((int)clientInfo->m_HostID);
     }
     
-    // 모든 클라이언트에게 새 플레이어 참가 알림
-    for (const auto& existingClient : tanks) {
-        // 새로 참가한 클라이언트 자신에게는 보내지 않음
-        if (existingClient.first != hostId) {
-            // 새 플레이어 정보 전송
-            ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-            
-            tankProxy.OnPlayerJoined(existingClient.first, rmiCtx, (int)hostId, 
-                                    posX, posY, defaultTankType);
-            
-            // 새 플레이어 체력 정보 전송
-            tankProxy.OnTankHealthUpdated(existingClient.first, rmiCtx, (int)hostId, 
-                                        defaultHealth, defaultMaxHealth);
-            
-            // DebugLog("Notifying existing client " + std::to_string(static_cast<int>(existingClient.first)) + " about new player: ID=" + std::to_string(static_cast<int>(hostId)) 
-                //  + ", Type=" + std::to_string(defaultTankType) + ", Health=" + std::to_string(defaultHealth) + "/" + std::to_string(defaultMaxHealth));
-        }
-    }
-    
-    // P2P 그룹 업데이트
-    UpdateP2PGroup();
+    // 클라이언트가 실력/지역 정보를 보내지 않으므로 모두 같은 키로 대기 (정원만큼 채워 방 배정)
+    rooms.Join((int)clientInfo->m_HostID);
 }
 
 // 클라이언트 접속 종료 처리
 void TankServer::OnClientLeave(::Proud::CNetClientInfo* clientInfo, ::Proud::ErrorInfo* errorInfo, const ::Proud::ByteArray& comment) {
-    std::lock_guard<std::mutex> lock(mutex);
-    
     HostID hostId = clientInfo->m_HostID;
     
+    // 오류 정보는 콜백 안에서만 유효하므로 여기서 기록
     std::string errorMessage = "Unknown error";
     if (errorInfo != nullptr) {
         errorMessage = std::string(errorInfo->ToString());
     }
     
-    DebugLog("Client " + std::to_string(static_cast<int>(hostId)) + " disconnected: " + errorMessage);
-    
-    // 탱크 정보 제거
-    if (tanks.find(hostId) != tanks.end()) {
-        tanks.erase(hostId);
-    }
+    TANK_LOG_INFO(LogCategory::Net, "Client {} disconnected: {}", (int)hostId, errorMessage);
     
-    // 모든 클라이언트에게 플레이어 퇴장 알림
-    for (const auto& remainingClient : tanks) {
-        ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-        
-        tankProxy.OnPlayerLeft(remainingClient.first, rmiCtx, (int)hostId);
+    if (capture.IsOpen()) {
+        capture.AppendLeave((int)hostId);
     }
     
-    // P2P 그룹 업데이트
-    UpdateP2PGroup();
+    rooms.Leave((int)hostId);
 }
 
-// P2P 그룹 업데이트
-void TankServer::UpdateP2PGroup() {
-    // 기존 그룹 제거
-    if (gameP2PGroupID != ::Proud::HostID_None) {
-        server->DestroyP2PGroup(gameP2PGroupID);
-        gameP2PGroupID = ::Proud::HostID_None;
-    }
-    
-    // 새 그룹 생성 (2명 이상일 때)
-    if (tanks.size() >= 2) {
-        vector<::Proud::HostID> clients;
-        for (const auto& tank : tanks) {
-            clients.push_back(tank.first);
-        }
-        
-        // Sample 코드 참조 - ByteArray 없이 호출
-        gameP2PGroupID = server->CreateP2PGroup(&clients[0], clients.size());
-        DebugLog("P2P group created with " + std::to_string(tanks.size()) + " members, Group ID: " + std::to_string(static_cast<int>(gameP2PGroupID)));
-        
-        // 모든 클라이언트에게 P2P 그룹 ID 알림
-        for (const auto& clientPair : tanks) {
-            ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-            
-            // P2PMessage에 그룹 ID 정보 전송
-            ::Proud::String groupInfoMsg;
-            groupInfoMsg.Format(_PNT("P2P_GROUP_INFO:%d"), static_cast<int>(gameP2PGroupID));
-            tankProxy.P2PMessage(clientPair.first, rmiCtx, groupInfoMsg);
-            
-            // DebugLog("Sent P2P group info to client " + std::to_string(static_cast<int>(clientPair.first)) + ": " + std::string(groupInfoMsg));
-        }
-    } else {
-        DebugLog("Not enough clients to create P2P group (need at least 2)");
-        gameP2PGroupID = ::Proud::HostID_None;
+// 스텁 프로파일링 훅 - 핸들러 호출 직전 (같은 워커 스레드에서 AfterRmiInvocation이 이어서 호출됨)
+// summary.m_elapsedTime은 ms 단위라 짧은 핸들러가 0으로 보이므로 ns 타이머로 따로 잽니다
+void TankServer::BeforeRmiInvocation(const ::Proud::BeforeRmiSummary& summary) {
+    rmiMetrics.BeginCall();
+}
+
+// 스텁 프로파일링 훅 - 핸들러 반환 직후 (actor 모드에서는 명령을 큐에 넣기까지의 시간)
+void TankServer::AfterRmiInvocation(const ::Proud::AfterRmiSummary& summary) {
+    rmiMetrics.EndCall((int)summary.m_rmiID);
+}
+
+// 역직렬화 직전 - 메시지 종류별 수신 바이트 기록 (프로파일링 여부와 무관하게 호출됨)
+// 캡처 중이면 읽기 위치(RmiID 바로 뒤)부터 끝까지의 인자 바이트를 그대로 기록
+bool TankServer::BeforeDeserialize(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, ::Proud::CMessage& message) {
+    rmiMetrics.RecordReceived((int)rmiContext.m_rmiID, (uint64_t)message.GetLength());
+    if (capture.IsOpen()) {
+        int payloadOffset = message.GetReadOffset();
+        capture.AppendRmi((int)remote, (uint16_t)rmiContext.m_rmiID, message.GetData() + payloadOffset, 
+                          (uint32_t)(message.GetLength() - payloadOffset));
     }
+    return true;
 }
 
 // 위치 이동 요청 처리
@@ -318,28 +685,9 @@ DEFRMI_Tank_SendMove(TankServer)
 bool TankServer::SendMove(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const float& posX, const float& posY, const float& direction)
 #endif
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    
-    DebugLog("SendMove from client " + std::to_string(static_cast<int>(remote)) + ": pos=(" + std::to_string(posX) + "," + std::to_string(posY) 
-         + "), direction=" + std::to_string(direction));
-    
-    // 탱크 정보 업데이트
-    if (tanks.find(remote) != tanks.end()) {
-        tanks[remote].posX = posX;
-        tanks[remote].posY = posY;
-        tanks[remote].direction = direction;
-        
-        // 모든 클라이언트에게 업데이트된 위치 전송
-        for (const auto& clientPair : tanks) {
-            // 움직인 클라이언트 자신에게는 보내지 않음
-            if (clientPair.first != remote) {
-                ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                
-                tankProxy.OnTankPositionUpdated(clientPair.first, rmiCtx, 
-                                                (int)remote, posX, posY, direction);
-            }
-        }
-    }
+    TankCommand command = MakeTankCommand(SimCommandType::Move, remote);
+    command.pose = SimPoseArgs{ posX, posY, direction };
+    rooms.Dispatch(command);
     
     return true;
 }
@@ -351,38 +699,9 @@ DEFRMI_Tank_SendFire(TankServer)
 bool TankServer::SendFire(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int& shooterId, const float& direction, const float& launchForce, const float& fireX, const float& fireY, const float& fireZ)
 #endif
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    
-    DebugLog("========== SendFire Received ==========");
-    DebugLog("From client " + std::to_string(static_cast<int>(remote)) + ": shooterId=" + std::to_string(shooterId) 
-         + ", direction=" + std::to_string(direction) + ", launchForce=" + std::to_string(launchForce));
-    DebugLog("Fire position: (" + std::to_string(fireX) + ", " + std::to_string(fireY) + ", " + std::to_string(fireZ) + ")");
-    
-    // 해당 클라이언트의 탱크 정보 가져오기
-    if (tanks.find(remote) != tanks.end()) {
-        TankInfo& tank = tanks[remote];
-        DebugLog("Tank found: Position=(" + std::to_string(tank.posX) + "," + std::to_string(tank.posY) 
-             + "), Direction=" + std::to_string(tank.direction));
-        
-        // 모든 클라이언트에게 총알 발사 정보 전송
-        int recipientCount = 0;
-        for (const auto& clientPair : tanks) {
-            // 발사한 클라이언트 자신에게는 보내지 않음
-            if (clientPair.first != remote) {
-                ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                
-                DebugLog("Sending OnSpawnBullet to client " + std::to_string(static_cast<int>(clientPair.first)));
-                tankProxy.OnSpawnBullet(clientPair.first, rmiCtx, (int)remote, shooterId, 
-                                         tank.posX, tank.posY, direction, 
-                                         launchForce, fireX, fireY, fireZ);
-                recipientCount++;
-            }
-        }
-        DebugLog("OnSpawnBullet sent to " + std::to_string(recipientCount) + " clients");
-    } else {
-        DebugLog("Error: Tank not found for client " + std::to_string(static_cast<int>(remote)));
-    }
-    DebugLog("========== SendFire Processing Completed ==========");
+    TankCommand command = MakeTankCommand(SimCommandType::Fire, remote);
+    command.fire = SimFireArgs{ shooterId, direction, launchForce, fireX, fireY, fireZ };
+    rooms.Dispatch(command);
     
     return true;
 }
@@ -394,31 +713,9 @@ DEFRMI_Tank_SendTankType(TankServer)
 bool TankServer::SendTankType(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int& tankType)
 #endif
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    
-    DebugLog("========== SendTankType Received ==========");
-    DebugLog("From client " + std::to_string(static_cast<int>(remote)) + ": tankType=" + std::to_string(tankType));
-    
-    // 해당 클라이언트의 탱크 정보 업데이트
-    if (tanks.find(remote) != tanks.end()) {
-        tanks[remote].tankType = tankType;
-        // DebugLog("Tank type updated for client " + std::to_string(static_cast<int>(remote)) + ": Type=" + std::to_string(tankType));
-        
-        // 모든 다른 클라이언트에게 이 클라이언트의 탱크 타입 알림
-        for (const auto& clientPair : tanks) {
-            if (clientPair.first != remote) {
-                ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                
-                // OnPlayerJoined 메시지를 통해 탱크 타입 정보 전송
-                // DebugLog("Notifying client " + std::to_string(static_cast<int>(clientPair.first)) + " about tank type of client " + std::to_string(static_cast<int>(remote)));
-                tankProxy.OnPlayerJoined(clientPair.first, rmiCtx, (int)remote, 
-                                         tanks[remote].posX, tanks[remote].posY, tankType);
-            }
-        }
-    } else {
-        DebugLog("Error: Tank not found for client " + std::to_string(static_cast<int>(remote)));
-    }
-    DebugLog("========== SendTankType Processing Completed ==========");
+    TankCommand command = MakeTankCommand(SimCommandType::TankType, remote);
+    command.tankType = tankType;
+    rooms.Dispatch(command);
     
     return true;
 }
@@ -430,35 +727,9 @@ DEFRMI_Tank_SendTankHealthUpdated(TankServer)
 bool TankServer::SendTankHealthUpdated(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const float& currentHealth, const float& maxHealth)
 #endif
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    
-    DebugLog("========== SendTankHealthUpdated Received ==========");
-    DebugLog("From client " + std::to_string(static_cast<int>(remote)) + ": currentHealth=" + std::to_string(currentHealth) 
-         + ", maxHealth=" + std::to_string(maxHealth));
-    
-    // 해당 클라이언트의 탱크 정보 업데이트
-    if (tanks.find(remote) != tanks.end()) {
-        tanks[remote].currentHealth = currentHealth;
-        tanks[remote].maxHealth = maxHealth;
-        tanks[remote].isDestroyed = (currentHealth <= 0);
-        
-        DebugLog("Tank health updated for client " + std::to_string(static_cast<int>(remote)) + ": " 
-             + std::to_string(currentHealth) + "/" + std::to_string(maxHealth));
-        
-        // 모든 다른 클라이언트에게 이 클라이언트의 체력 정보 전송
-        for (const auto& clientPair : tanks) {
-            if (clientPair.first != remote) {
-                ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                
-                // DebugLog("Notifying client " + std::to_string(static_cast<int>(clientPair.first)) + " about health of client " + std::to_string(static_cast<int>(remote)));
-                tankProxy.OnTankHealthUpdated(clientPair.first, rmiCtx, (int)remote, 
-                                              currentHealth, maxHealth);
-            }
-        }
-    } else {
-        DebugLog("Error: Tank not found for client " + std::to_string(static_cast<int>(remote)));
-    }
-    DebugLog("========== SendTankHealthUpdated Processing Completed ==========");
+    TankCommand command = MakeTankCommand(SimCommandType::HealthUpdated, remote);
+    command.health = SimHealthArgs{ currentHealth, maxHealth };
+    rooms.Dispatch(command);
     
     return true;
 }
@@ -470,32 +741,9 @@ DEFRMI_Tank_SendTankDestroyed(TankServer)
 bool TankServer::SendTankDestroyed(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int& destroyedById)
 #endif
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    
-    DebugLog("========== SendTankDestroyed Received ==========");
-    DebugLog("From client " + std::to_string(static_cast<int>(remote)) + ": destroyedById=" + std::to_string(destroyedById));
-    
-    // 해당 클라이언트의 탱크 정보 업데이트
-    if (tanks.find(remote) != tanks.end()) {
-        tanks[remote].isDestroyed = true;
-        tanks[remote].currentHealth = 0;
-        
-        string destroyedByText = destroyedById > 0 ? "by tank " + std::to_string(destroyedById) : "by environment";
-        DebugLog("Tank destroyed for client " + std::to_string(static_cast<int>(remote)) + ": " + destroyedByText);
-        
-        // 모든 다른 클라이언트에게 이 클라이언트의 파괴 정보 전송
-        for (const auto& clientPair : tanks) {
-            if (clientPair.first != remote) {
-                ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                
-                // DebugLog("Notifying client " + std::to_string(static_cast<int>(clientPair.first)) + " about destruction of client " + std::to_string(static_cast<int>(remote)));
-                tankProxy.OnTankDestroyed(clientPair.first, rmiCtx, (int)remote, destroyedById);
-            }
-        }
-    } else {
-        DebugLog("Error: Tank not found for client " + std::to_string(static_cast<int>(remote)));
-    }
-    DebugLog("========== SendTankDestroyed Processing Completed ==========");
+    TankCommand command = MakeTankCommand(SimCommandType::Destroyed, remote);
+    command.destroyedById = destroyedById;
+    rooms.Dispatch(command);
     
     return true;
 }
@@ -507,39 +755,9 @@ DEFRMI_Tank_SendTankSpawned(TankServer)
 bool TankServer::SendTankSpawned(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const float& posX, const float& posY, const float& direction, const int& tankType, const float& initialHealth)
 #endif
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    
-    DebugLog("========== SendTankSpawned Received ==========");
-    DebugLog("From client " + std::to_string(static_cast<int>(remote)) + ": position=(" + std::to_string(posX) + "," + std::to_string(posY) 
-         + "), direction=" + std::to_string(direction) + ", tankType=" + std::to_string(tankType) 
-         + ", health=" + std::to_string(initialHealth));
-    
-    // 해당 클라이언트의 탱크 정보 업데이트
-    if (tanks.find(remote) != tanks.end()) {
-        tanks[remote].posX = posX;
-        tanks[remote].posY = posY;
-        tanks[remote].direction = direction;
-        tanks[remote].tankType = tankType;
-        tanks[remote].currentHealth = initialHealth;
-        tanks[remote].maxHealth = initialHealth; // 최대 체력도 업데이트
-        tanks[remote].isDestroyed = false;
-        
-        DebugLog("Tank spawned for client " + std::to_string(static_cast<int>(remote)) + " at (" + std::to_string(posX) + "," + std::to_string(posY) + ")");
-        
-        // 모든 다른 클라이언트에게 이 클라이언트의 생성/리스폰 정보 전송
-        for (const auto& clientPair : tanks) {
-            if (clientPair.first != remote) {
-                ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                
-                // DebugLog("Notifying client " + std::to_string(static_cast<int>(clientPair.first)) + " about spawn of client " + std::to_string(static_cast<int>(remote)));
-                tankProxy.OnTankSpawned(clientPair.first, rmiCtx, (int)remote, 
-                                         posX, posY, direction, tankType, initialHealth);
-            }
-        }
-    } else {
-        DebugLog("Error: Tank not found for client " + std::to_string(static_cast<int>(remote)));
-    }
-    DebugLog("========== SendTankSpawned Processing Completed ==========");
+    TankCommand command = MakeTankCommand(SimCommandType::Spawned, remote);
+    command.spawn = SimSpawnArgs{ posX, posY, direction, tankType, initialHealth };
+    rooms.Dispatch(command);
     
     return true;
 }
@@ -551,26 +769,68 @@ DEFRMI_Tank_P2PMessage(TankServer)
 bool TankServer::P2PMessage(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const ::Proud::String& message)
 #endif
 {
-    std::lock_guard<std::mutex> lock(mutex);
-    
-    // ProudNet::String을 C++ std::string으로 변환
-    std::string messageStr = std::string(message);
-    DebugLog("P2PMessage from client " + std::to_string(static_cast<int>(remote)) + ": " + messageStr);
-    
-    // P2P 그룹이 있는 경우 해당 클라이언트 제외한 모든 멤버에게 릴레이
-    if (gameP2PGroupID != ::Proud::HostID_None && messageStr.find("P2P_GROUP_INFO:") == std::string::npos) {
-        // 메시지 보낸 클라이언트를 제외한 모든 클라이언트에게 릴레이
-        for (const auto& clientPair : tanks) {
-            if (clientPair.first != remote) {
-                ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                ::Proud::String relayedMessage;
-                relayedMessage.Format(_PNT("RELAY_FROM_%d:%s"), static_cast<int>(remote), message.GetString());
-                
-                tankProxy.P2PMessage(clientPair.first, rmiCtx, relayedMessage);
-                DebugLog("Relayed P2P message to client " + std::to_string(static_cast<int>(clientPair.first)) + ": " + std::string(relayedMessage));
-            }
-        }
-    }
+    TankCommand command = MakeTankCommand(SimCommandType::P2PMessage, remote);
+    command.message = new std::string(message.GetString());
+    rooms.Dispatch(command);
+    
+    return true;
+}
+
+// 클라이언트 프로토콜 리비전 알림 처리 (틱 스냅샷/압축 이동 지원 여부)
+#ifdef _WIN32
+DEFRMI_Tank_SendHello(TankServer)
+#else
+bool TankServer::SendHello(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int& protocolRevision)
+#endif
+{
+    TankCommand command = MakeTankCommand(SimCommandType::Hello, remote);
+    command.protocolRevision = protocolRevision;
+    rooms.Dispatch(command);
+    
+    return true;
+}
+
+// 압축 위치 이동 요청 처리 - float로 복원해 SendMove와 같은 명령으로 적용
+#ifdef _WIN32
+DEFRMI_Tank_SendMoveCompact(TankServer)
+#else
+bool TankServer::SendMoveCompact(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int16_t& posX, const int16_t& posY, const uint8_t& direction)
+#endif
+{
+    TankCommand command = MakeTankCommand(SimCommandType::Move, remote);
+    command.pose = SimPoseArgs{ DequantizePosition(posX, CompactMapOriginX), DequantizePosition(posY, CompactMapOriginY),
+                                DequantizeDirection(direction) };
+    rooms.Dispatch(command);
+    
+    return true;
+}
+
+// 순서 번호가 붙은 압축 이동 처리 (비신뢰 전송) - 늦게 도착한 이동은 월드가 순서 번호로 걸러냄
+#ifdef _WIN32
+DEFRMI_Tank_SendMoveSequenced(TankServer)
+#else
+bool TankServer::SendMoveSequenced(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const uint16_t& sequence, const int16_t& posX, const int16_t& posY, const uint8_t& direction)
+#endif
+{
+    TankCommand command = MakeTankCommand(SimCommandType::MoveSequenced, remote);
+    command.sequencedMove.pose = SimPoseArgs{ DequantizePosition(posX, CompactMapOriginX), DequantizePosition(posY, CompactMapOriginY),
+                                              DequantizeDirection(direction) };
+    command.sequencedMove.sequence = sequence;
+    rooms.Dispatch(command);
+    
+    return true;
+}
+
+// 델타 스냅샷 ack 처리 - 이후 델타의 기준 틱 갱신
+#ifdef _WIN32
+DEFRMI_Tank_SendSnapshotAck(TankServer)
+#else
+bool TankServer::SendSnapshotAck(::Proud::HostID remote, ::Proud::RmiContext& rmiContext, const int& tickId)
+#endif
+{
+    TankCommand command = MakeTankCommand(SimCommandType::SnapshotAck, remote);
+    command.ackTickId = (uint32_t)tickId;
+    rooms.Dispatch(command);
     
     return true;
 }
@@ -586,6 +846,9 @@ void TankServer::Start() {
         // Common 디렉토리의 Vars.h에 정의된 버전 정보 사용
         serverParam.m_protocolVersion = g_Version;
         serverParam.m_tcpPorts.Add(g_ServerPort);
+        
+        // 멤버가 모두 나가도 P2P 그룹을 유지 (접속/퇴장 시 그룹 재생성 방지)
+        serverParam.m_allowEmptyP2PGroup = true;
 
         // WebSocket 설정
         serverParam.m_webSocketParam.webSocketType = WebSocket_Ws;
@@ -593,12 +856,78 @@ void TankServer::Start() {
         serverParam.m_webSocketParam.threadCount = 4;
         serverParam.m_webSocketParam.endpoint = _PNT("^/ws/?$");
         
+        // 캡처는 첫 접속보다 먼저 열어야 재생 시 접속 순서가 맞음
+        if (!config.capturePath.empty()) {
+            StartCapture();
+        }
+        
         // 서버 시작
         server->Start(serverParam);
         
+        // 방 워커 시작 - 워커마다 틱 루프 하나가 고정된 방들의 스냅샷을 보내고,
+        // actor 모드에서는 틱 사이에 그 방들의 명령 큐를 비움 (방의 월드는 그 워커만 접근)
+        rooms.Start([this](Room& room, uint32_t tickId) {
+            SampleSendQueues(room, tickId);
+            SampleNetworkStats();
+        });
+        
         DebugLog("========== Tank Server Started ==========");
         DebugLog("TCP Server listening on 0.0.0.0:" + std::to_string(g_ServerPort));
         DebugLog("WebSocket Server listening on 0.0.0.0:" + std::to_string(g_WebSocketPort) + "/ws");
+        DebugLog("Snapshot tick rate: " + std::to_string(config.tickRateHz) + " Hz");
+        DebugLog(config.useSimulationActor ? "Simulation mode: actor (lock-free command queue per room worker)"
+                                           : "Simulation mode: lock (handlers lock the client's room)");
+        DebugLog("Rooms: " + (config.roomSize > 0 ? std::to_string(config.roomSize) + " tanks per room" : std::string("single unlimited room")) 
+                 + ", " + std::to_string(rooms.WorkerCount()) + " worker threads, match window " + std::to_string(config.matchWindowMs) 
+                 + " ms, empty rooms closed after " + (config.emptyRoomTimeoutSeconds > 0 ? std::to_string(config.emptyRoomTimeoutSeconds) + " s" : std::string("never")));
+        DebugLog(config.unreliablePositions ? "Position stream: unreliable (full refresh every second)"
+                                            : "Position stream: reliable");
+        if (config.lodBudget > 0) {
+            DebugLog("Level of detail: " + std::to_string(config.lodBudget) + " tanks per client per tick, near distance " 
+                     + std::to_string(config.lodNearDistance));
+        }
+        if (config.deadReckoningThreshold > 0.0f) {
+            DebugLog("Dead reckoning: threshold " + std::to_string(config.deadReckoningThreshold) + ", heartbeat " 
+                     + std::to_string(config.deadReckoningHeartbeatMs) + " ms");
+        }
+        if (config.sendQueueHighKB > 0) {
+            DebugLog("Send queue backpressure: coalesce positions above " + std::to_string(config.sendQueueHighKB) 
+                     + " KB, drop above " + std::to_string(config.sendQueueHighKB * 4) + " KB, disconnect at " 
+                     + (config.sendQueueLimitKB > 0 ? std::to_string(config.sendQueueLimitKB) + " KB" : std::string("never")));
+        }
+        if (config.serverProjectiles) {
+            DebugLog("Hit detection: server-authoritative projectiles (client health/destroy reports ignored)");
+            if (config.lagCompensationMs > 0) {
+                PoseHistory history;
+                history.SetConfig(MakeLagCompensationConfig(config));
+                DebugLog("Lag compensation: rewind up to " + std::to_string(config.lagCompensationMs) + " ms by client RTT, " 
+                         + std::to_string(config.poseHistorySamples) + " moves kept per tank (" 
+                         + std::to_string(history.BytesPerTank()) + " bytes per tank)");
+            }
+        } else if (config.lagCompensationMs > 0) {
+            DebugLog("Lag compensation ignored: it only applies with --server-hits on");
+        }
+        if (config.spawnCandidates > 1) {
+            DebugLog("Spawn selection: farthest from other tanks among " + std::to_string(config.spawnCandidates) + " candidates");
+        }
+        if (config.interestRadius > 0.0f) {
+            DebugLog("Interest radius: " + std::to_string(config.interestRadius));
+        } else {
+            DebugLog("Interest management disabled (broadcast to all clients)");
+        }
+        
+        // 메트릭/헬스 체크 HTTP 서버 시작 (실패해도 게임 서버는 계속 동작)
+        int metricsPort = config.metricsPort < 0 ? g_WebServerPort : config.metricsPort;
+        if (metricsPort > 0) {
+            bool started = metricsServer.Start(metricsPort, [this](const std::string& path, std::string& contentType, std::string& body) {
+                return HandleHttpRequest(path, contentType, body);
+            });
+            if (started) {
+                DebugLog("Metrics HTTP server listening on 0.0.0.0:" + std::to_string(metricsPort) + " (/metrics, /healthz)");
+            } else {
+                TANK_LOG_WARN(LogCategory::General, "Metrics HTTP server failed to listen on port {}", metricsPort);
+            }
+        }
         DebugLog("Ready to accept connections from all network interfaces");
         DebugLog("==========================================");
         
@@ -614,11 +943,17 @@ void TankServer::Start() {
 // 커맨드 처리 루프
 void TankServer::ProcessCommands() {
     DebugLog("Server is running. Commands:");
-    DebugLog("status: Show connected clients");
+    DebugLog("status: Show connected clients and their send queue depth");
     DebugLog("health [id]: Show tank health (all or specific ID)");
     DebugLog("damage id amount: Apply damage to a tank");
     DebugLog("heal id amount: Heal a tank");
     DebugLog("respawn id x y: Respawn a tank at position (x,y)");
+    DebugLog("tick: Show tick duration and jitter since last call");
+    DebugLog("sim: Show command queue depth, apply latency and lock wait since last call");
+    DebugLog("rooms: Show rooms with their worker, tank count, applied commands and tick time");
+    DebugLog("rmi: Show per-RMI calls/s, bytes and handler latency percentiles since last call");
+    DebugLog("capture: Show RMI capture file status");
+    DebugLog("log [category|all level]: Show or set log levels (trace/debug/info/warn/error/off)");
     DebugLog("q: Quit server");
     
     string input;
@@ -629,7 +964,8 @@ void TankServer::ProcessCommands() {
             break;
         }
         else if (input == "status") {
-            PrintConnectedClients();
+            TankCommand command = MakeTankCommand(SimCommandType::PrintStatus, ::Proud::HostID_None);
+            rooms.DispatchConsole(command);
         }
         else if (input.find("health") == 0) {
             ShowTankHealth(input);
@@ -643,34 +979,517 @@ void TankServer::ProcessCommands() {
         else if (input.find("respawn ") == 0) {
             RespawnTank(input);
         }
+        else if (input == "tick") {
+            PrintTickStats();
+        }
+        else if (input == "sim") {
+            PrintSimStats();
+        }
+        else if (input == "rooms") {
+            PrintRoomStats();
+        }
+        else if (input == "rmi") {
+            PrintRmiStats();
+        }
+        else if (input == "capture") {
+            PrintCaptureStats();
+        }
+        else if (input == "log" || input.find("log ") == 0) {
+            ConfigureLog(input);
+        }
     }
     
-    // 서버 종료
+    // 서버 종료 - 네트워크를 먼저 멈춰 새 명령이 들어오지 않게 한 뒤 방 워커 정지
+    metricsServer.Stop();
     server->Stop();
+    capture.Close();
+    rooms.Stop();
     DebugLog("Server stopped");
+    AsyncLog::Instance().Flush();
+}
+
+// 틱 루프 처리 시간/지터 출력 (워커별 - 틱 하나는 그 워커에 고정된 방 전체)
+void TankServer::PrintTickStats() {
+    DebugLog("========== Tick Stats ==========");
+    DebugLog("Rate: " + std::to_string(config.tickRateHz) + " Hz (interval " + std::to_string(rooms.WorkerAt(0).Loop().IntervalMs()) + " ms)");
+    for (size_t i = 0; i < rooms.WorkerCount(); i++) {
+        TickStats stats = rooms.WorkerAt(i).Loop().TakeStats();
+        DebugLog("Worker " + std::to_string(i) + " ticks: " + std::to_string(stats.tickCount) + ", last tick: " + std::to_string(stats.lastTickId) 
+             + ", overruns: " + std::to_string(stats.overrunCount));
+        DebugLog("  Duration avg/max: " + std::to_string(stats.avgDurationMs) + " / " + std::to_string(stats.maxDurationMs) + " ms, jitter avg/max: " 
+             + std::to_string(stats.avgJitterMs) + " / " + std::to_string(stats.maxJitterMs) + " ms");
+    }
+    DebugLog("================================");
+}
+
+// 명령 큐 깊이/적용 지연/잠금 대기 출력 (큐와 지연은 워커별, 잠금은 방별)
+void TankServer::PrintSimStats() {
+    DebugLog("========== Simulation Stats ==========");
+    DebugLog(std::string("Mode: ") + (config.useSimulationActor ? "actor" : "lock") + ", workers: " + std::to_string(rooms.WorkerCount()));
+    for (size_t i = 0; i < rooms.WorkerCount(); i++) {
+        RoomWorker& worker = rooms.WorkerAt(i);
+        MpscQueueStats queue = worker.Queue().TakeStats();
+        SimLatencyStats latency = worker.Latency().TakeStats();
+        DebugLog("Worker " + std::to_string(i) + " commands applied: " + std::to_string(latency.appliedCount) + ", latency avg/max: " 
+             + std::to_string(latency.avgLatencyUs) + " / " + std::to_string(latency.maxLatencyUs) + " us");
+        if (config.useSimulationActor) {
+            DebugLog("  Queue depth: " + std::to_string(queue.currentDepth) + " now, avg/max at drain: " 
+                 + std::to_string(queue.avgDepth) + " / " + std::to_string(queue.maxDepth) + " (capacity " + std::to_string(worker.Queue().Capacity()) + ")");
+            DebugLog("  Batches: " + std::to_string(queue.batchCount) + ", avg size: " + std::to_string(queue.avgBatchSize) 
+                 + ", total pushed/popped: " + std::to_string(queue.pushedCount) + " / " + std::to_string(queue.poppedCount) 
+                 + ", full waits: " + std::to_string(queue.fullWaitCount));
+        }
+    }
+    if (!config.useSimulationActor) {
+        rooms.ForEachRoom([](Room& room) {
+            LockWaitStats lockWait = room.Mutex().TakeStats();
+            DebugLog("Room " + std::to_string(room.Id()) + " lock acquires: " + std::to_string(lockWait.acquireCount) 
+                 + ", contended: " + std::to_string(lockWait.contendedCount) + ", wait avg/max: " 
+                 + std::to_string(lockWait.avgWaitUs) + " / " + std::to_string(lockWait.maxWaitUs) + " us");
+        });
+    }
+    DebugLog("======================================");
+}
+
+// 방별 워커/탱크 수/적용한 명령/틱 처리 시간 출력 (시작 이후 누적)
+void TankServer::PrintRoomStats() {
+    DebugLog("========== Rooms ==========");
+    DebugLog("Rooms: " + std::to_string(rooms.RoomCount()) + ", players: " + std::to_string(rooms.PlayerCount()) + ", workers: " 
+         + std::to_string(rooms.WorkerCount()) + ", room size: " + (config.roomSize > 0 ? std::to_string(config.roomSize) : std::string("unlimited")));
+    char line[256];
+    snprintf(line, sizeof(line), "%6s %7s %7s %12s %12s %12s %12s", "room", "worker", "tanks", "commands", "tick avg us", "tick p99 us", "tick max us");
+    DebugLog(line);
+    rooms.ForEachRoom([&line](Room& room) {
+        const RoomStats& stats = room.Stats();
+        uint64_t commands = 0;
+        for (const std::atomic<uint64_t>& count : stats.commands) {
+            commands += count.load(std::memory_order_relaxed);
+        }
+        LatencyHistogramSnapshot tick = stats.tickDuration.Snapshot();
+        snprintf(line, sizeof(line), "%6d %7d %7d %12llu %12.1f %12.1f %12.1f", room.Id(), room.Worker(), 
+                 stats.tanks.load(std::memory_order_relaxed), (unsigned long long)commands, tick.AverageNs() / 1000.0, 
+                 tick.ValueAtQuantile(0.99) / 1000.0, tick.maxNs / 1000.0);
+        DebugLog(line);
+    });
+    
+    const MatchmakerStats& match = rooms.MatchStats();
+    LatencyHistogramSnapshot queueTime = match.queueTime.Snapshot();
+    DebugLog("Matchmaking: waiting " + std::to_string(match.Waiting()) + ", placed " + std::to_string(match.placed.load()) 
+         + ", cancelled " + std::to_string(match.cancelled.load()) + ", batches " + std::to_string(match.batches.load()) 
+         + ", rooms opened/closed " + std::to_string(match.roomsOpened.load()) + " / " + std::to_string(match.roomsClosed.load()));
+    snprintf(line, sizeof(line), "  Queue time avg/p99/max: %.1f / %.1f / %.1f ms", queueTime.AverageNs() / 1e6, 
+             queueTime.ValueAtQuantile(0.99) / 1e6, queueTime.maxNs / 1e6);
+    DebugLog(line);
+    DebugLog("===========================");
+}
+
+// RMI별 호출 수/초, 수신 바이트, 처리 시간 퍼센타일 출력 (마지막 호출 이후 구간)
+void TankServer::PrintRmiStats() {
+    vector<RmiTypeStats> current = rmiMetrics.Snapshot();
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(now - lastRmiStatsTime).count();
+    
+    DebugLog("========== RMI Stats (last " + std::to_string(seconds) + " s) ==========");
+    char line[256];
+    snprintf(line, sizeof(line), "%-22s %10s %10s %12s %9s %9s %9s %9s %9s",
+             "rmi", "calls", "calls/s", "bytes", "B/msg", "p50 us", "p99 us", "p999 us", "max us");
+    DebugLog(line);
+    
+    for (const RmiTypeStats& stats : current) {
+        // 이전 스냅샷과의 차이로 구간 통계 계산
+        RmiTypeStats window = stats;
+        for (const RmiTypeStats& previous : lastRmiStats) {
+            if (previous.rmiId == stats.rmiId) {
+                window.calls -= previous.calls;
+                window.messages -= previous.messages;
+                window.bytes -= previous.bytes;
+                window.latency = stats.latency.Since(previous.latency);
+                break;
+            }
+        }
+        if (window.messages == 0 && window.calls == 0) {
+            continue;
+        }
+        
+        snprintf(line, sizeof(line), "%-22s %10llu %10.1f %12llu %9.1f %9.2f %9.2f %9.2f %9.2f",
+                 window.name.c_str(), (unsigned long long)window.calls, seconds > 0 ? window.calls / seconds : 0.0,
+                 (unsigned long long)window.bytes, window.messages > 0 ? (double)window.bytes / window.messages : 0.0,
+                 window.latency.ValueAtQuantile(0.50) / 1000.0, window.latency.ValueAtQuantile(0.99) / 1000.0,
+                 window.latency.ValueAtQuantile(0.999) / 1000.0, window.latency.maxNs / 1000.0);
+        DebugLog(line);
+    }
+    DebugLog("(max us is the all-time maximum)");
+    DebugLog("======================================");
+    
+    lastRmiStats = current;
+    lastRmiStatsTime = now;
+}
+
+// 캡처 시작 - 서버 시작 전(방이 열리기 전)에 호출, 방 N의 월드 시드는 seed + N - 1
+void TankServer::StartCapture() {
+    uint32_t seed = std::random_device()();
+    captureSeed = seed;
+    
+    if (capture.Open(config.capturePath, seed)) {
+        DebugLog("Capturing inbound RMIs to " + config.capturePath + " (world seed " + std::to_string(seed) + " for room 1)");
+    } else {
+        TANK_LOG_WARN(LogCategory::General, "Failed to open capture file {}", config.capturePath);
+    }
+}
+
+// 캡처 상태 출력
+void TankServer::PrintCaptureStats() {
+    if (!capture.IsOpen()) {
+        DebugLog("Capture is off (start the server with --capture FILE)");
+        return;
+    }
+    DebugLog("Capture: " + config.capturePath + ", records: " + std::to_string(capture.RecordCount()) 
+         + ", dropped: " + std::to_string(capture.DroppedCount()) + ", bytes: " + std::to_string(capture.ByteCount()));
+}
+
+// ProudNet 송수신 통계를 1초마다 atomic 복사본으로 갱신 (워커 스레드 - 1초가 지난 뒤 먼저 도착한 워커 하나만)
+void TankServer::SampleNetworkStats() {
+    int64_t nowNs = SimNowNs();
+    int64_t lastNs = lastNetworkSampleNs.load(std::memory_order_relaxed);
+    if (nowNs - lastNs < 1000000000LL || !lastNetworkSampleNs.compare_exchange_strong(lastNs, nowNs, std::memory_order_relaxed)) {
+        return;
+    }
+    
+    ::Proud::CNetServerStats stats;
+    server->GetStats(stats);
+    networkSentBytes.store(stats.m_totalTcpSendBytes + stats.m_totalUdpSendBytes, std::memory_order_relaxed);
+    networkReceivedBytes.store(stats.m_totalTcpReceiveBytes + stats.m_totalUdpReceiveBytes, std::memory_order_relaxed);
 }
 
-// 연결된 클라이언트 정보 출력
-void TankServer::PrintConnectedClients() {
-    std::lock_guard<std::mutex> lock(mutex);
+// 방 클라이언트의 송신 대기열 크기를 월드에 반영 (방의 BroadcastSnapshot 직전)
+// 백프레셔를 켜면 매 틱, 끄면 status/메트릭용으로 1초(워커 틱 tickRateHz개)마다 조회합니다.
+// 같은 1초 주기에 지연 보상용 RTT도 반영합니다 (ProudNet의 ping은 왕복 시간의 절반이라 두 배로 넘김).
+// 연결 종료는 ProudNet이 비동기로 처리하고, 실제 퇴장은 OnClientLeave로 들어옵니다
+void TankServer::SampleSendQueues(Room& room, uint32_t tickId) {
+    bool publish = tickId % (uint32_t)config.tickRateHz == 0;
+    if (config.sendQueueHighKB == 0 && !publish) {
+        return;
+    }
+    
+    GameWorld& world = room.World();
+    const TankRegistry& tanks = world.Tanks();
+    ::Proud::CNetClientInfo info;
+    for (size_t i = 0; i < tanks.Size(); i++) {
+        int hostId = tanks.HostIdAt(i);
+        if (!server->GetClientInfo((::Proud::HostID)hostId, info)) {
+            continue;
+        }
+        if (world.UpdateSendQueue(hostId, (uint32_t)std::max(0, (int)info.m_sendQueuedAmountInBytes))) {
+            server->CloseConnection((::Proud::HostID)hostId);
+        }
+        if (publish) {
+            world.UpdateClientRtt(hostId, info.m_recentPingMs * 2);
+        }
+    }
     
-    DebugLog("========== Connected Clients ==========");
-    DebugLog("Total: " + std::to_string(tanks.size()) + " clients");
+    if (publish) {
+        vector<std::pair<int, uint32_t>> samples;
+        samples.reserve(tanks.Size());
+        for (size_t i = 0; i < tanks.Size(); i++) {
+            const SendBacklogState* backlog = world.FindSendBacklog(tanks.HostIdAt(i));
+            samples.emplace_back(tanks.HostIdAt(i), backlog != nullptr ? backlog->queuedBytes : 0u);
+        }
+        std::lock_guard<std::mutex> lock(sendQueueSampleMutex);
+        sendQueueSamples[room.Id()].swap(samples);
+    }
+}
+
+// 메트릭 HTTP 요청 처리 (HTTP 스레드)
+int TankServer::HandleHttpRequest(const std::string& path, std::string& contentType, std::string& body) {
+    if (path == "/metrics") {
+        contentType = "text/plain; version=0.0.4; charset=utf-8";
+        body = BuildMetricsText();
+        return 200;
+    }
     
-    for (const auto& tank : tanks) {
-        string healthStatus = tank.second.isDestroyed ? "DESTROYED" : 
-                              std::to_string(tank.second.currentHealth) + "/" + std::to_string(tank.second.maxHealth);
-        DebugLog("Client ID: " + std::to_string(static_cast<int>(tank.first)) + ", Position: (" + std::to_string(tank.second.posX) + "," + std::to_string(tank.second.posY) 
-             + "), TankType: " + std::to_string(tank.second.tankType) + ", Health: " + healthStatus);
+    if (path == "/healthz") {
+        // 모든 방 워커(actor 모드에서는 명령도 처리하는 스레드)가 멈추지 않았는지 확인
+        int64_t nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        for (size_t i = 0; i < rooms.WorkerCount(); i++) {
+            const TickLoop& loop = rooms.WorkerAt(i).Loop();
+            TickTotals ticks = loop.Totals();
+            if (ticks.lastTickEndNs == 0) {
+                body = "starting\n";
+                return 503;
+            }
+            double sinceLastTickMs = (nowNs - ticks.lastTickEndNs) / 1000000.0;
+            double stallLimitMs = std::max(1000.0, loop.IntervalMs() * 5);
+            if (sinceLastTickMs > stallLimitMs) {
+                body = "worker " + std::to_string(i) + " tick stalled for " + std::to_string((int64_t)sinceLastTickMs) + " ms\n";
+                return 503;
+            }
+        }
+        body = "ok\n";
+        return 200;
     }
     
-    DebugLog("=======================================");
+    body = "not found\n";
+    return 404;
+}
+
+// 방 하나의 메트릭 값 (방 목록 잠금 안에서 복사한 뒤 metric 이름별로 출력)
+struct RoomMetricSample {
+    int id;
+    int worker;
+    int tanks;
+    uint64_t commands[SimCommandTypeCount];
+    LatencyHistogramSnapshot tick;
+};
+
+// Prometheus 형식 메트릭 본문 - 모든 값은 atomic 누적 카운터/게이지에서 읽음
+// 월드 값은 모든 방의 합계이고, 방별 값은 tank_server_room_* 에 room 레이블로 출력
+std::string TankServer::BuildMetricsText() {
+    PrometheusWriter writer;
+    
+    // 방별 값과 모든 방의 합계 수집 (닫힌 방의 누적 값에 열린 방의 값을 더함)
+    vector<RoomMetricSample> roomSamples;
+    int tankCount = 0;
+    WorldMetricTotals totals;
+    {
+        std::lock_guard<std::mutex> lock(retiredRoomsMutex);
+        totals = retiredRoomTotals;
+    }
+    rooms.ForEachRoom([&](Room& room) {
+        const RoomStats& stats = room.Stats();
+        RoomMetricSample sample;
+        sample.id = room.Id();
+        sample.worker = room.Worker();
+        sample.tanks = stats.tanks.load(std::memory_order_relaxed);
+        for (size_t type = 0; type < SimCommandTypeCount; type++) {
+            sample.commands[type] = stats.commands[type].load(std::memory_order_relaxed);
+        }
+        sample.tick = stats.tickDuration.Snapshot();
+        roomSamples.push_back(std::move(sample));
+        tankCount += roomSamples.back().tanks;
+        totals.Add(room);
+    });
+    
+    writer.Gauge("tank_server_tanks", "Connected tanks", tankCount);
+    
+    // RMI별 값 (같은 metric 이름끼리 연속으로 출력)
+    vector<RmiTypeStats> rmiStats = rmiMetrics.Snapshot();
+    for (const RmiTypeStats& stats : rmiStats) {
+        writer.Counter("tank_server_rmi_received_total", "Received RMI messages by type", (double)stats.messages, "rmi=\"" + stats.name + "\"");
+    }
+    for (const RmiTypeStats& stats : rmiStats) {
+        writer.Counter("tank_server_rmi_received_bytes_total", "Received RMI bytes by type", (double)stats.bytes, "rmi=\"" + stats.name + "\"");
+    }
+    for (const RmiTypeStats& stats : rmiStats) {
+        std::string labels = "rmi=\"" + stats.name + "\"";
+        const double quantiles[] = { 0.5, 0.99, 0.999 };
+        for (double q : quantiles) {
+            writer.SummaryQuantile("tank_server_rmi_handler_seconds", "RMI handler duration since start", q, 
+                                   stats.latency.ValueAtQuantile(q) / 1e9, labels);
+        }
+        writer.SummaryTotals("tank_server_rmi_handler_seconds", stats.latency.sumNs / 1e9, stats.latency.count, labels);
+    }
+    
+    // 틱 값은 모든 워커의 합계 (마지막 틱 시간은 가장 긴 워커)
+    TickTotals ticks;
+    size_t queueDepth = 0;
+    for (size_t i = 0; i < rooms.WorkerCount(); i++) {
+        TickTotals worker = rooms.WorkerAt(i).Loop().Totals();
+        ticks.tickCount += worker.tickCount;
+        ticks.overrunCount += worker.overrunCount;
+        ticks.durationSumMs += worker.durationSumMs;
+        ticks.lastDurationMs = std::max(ticks.lastDurationMs, worker.lastDurationMs);
+        queueDepth += rooms.WorkerAt(i).Queue().Depth();
+    }
+    writer.Counter("tank_server_ticks_total", "Snapshot ticks executed (sum over room workers)", (double)ticks.tickCount);
+    writer.Counter("tank_server_tick_overruns_total", "Ticks that took longer than the tick interval", (double)ticks.overrunCount);
+    writer.Counter("tank_server_tick_duration_seconds_total", "Total time spent in tick callbacks", ticks.durationSumMs / 1000.0);
+    writer.Gauge("tank_server_tick_last_duration_seconds", "Duration of the most recent tick (slowest room worker)", ticks.lastDurationMs / 1000.0);
+    
+    writer.Counter("tank_server_network_sent_bytes_total", "Bytes sent by ProudNet (TCP + UDP, sampled every second)", 
+                   (double)networkSentBytes.load(std::memory_order_relaxed));
+    writer.Counter("tank_server_network_received_bytes_total", "Bytes received by ProudNet (TCP + UDP, sampled every second)", 
+                   (double)networkReceivedBytes.load(std::memory_order_relaxed));
+    
+    writer.Counter("tank_server_lock_acquires_total", "Room mutex acquisitions (lock mode)", (double)totals.lockWait.acquireCount);
+    writer.Counter("tank_server_lock_contended_total", "Room mutex acquisitions that had to wait", (double)totals.lockWait.contendedCount);
+    writer.Counter("tank_server_lock_wait_seconds_total", "Total time spent waiting for room mutexes", totals.lockWait.waitSumSeconds);
+    
+    writer.Gauge("tank_server_command_queue_depth", "Pending simulation commands in room worker queues (actor mode)", (double)queueDepth);
+    
+    // 방별 값 - 탱크 수, 적용한 명령(종류별), 방 하나의 틱 처리 시간
+    writer.Gauge("tank_server_rooms", "Open rooms", (double)roomSamples.size());
+    writer.Gauge("tank_server_room_workers", "Room worker threads", (double)rooms.WorkerCount());
+    for (const RoomMetricSample& sample : roomSamples) {
+        writer.Gauge("tank_server_room_tanks", "Tanks in each room", (double)sample.tanks, 
+                     "room=\"" + std::to_string(sample.id) + "\",worker=\"" + std::to_string(sample.worker) + "\"");
+    }
+    for (const RoomMetricSample& sample : roomSamples) {
+        for (size_t type = 0; type < SimCommandTypeCount; type++) {
+            if (sample.commands[type] == 0) {
+                continue;
+            }
+            writer.Counter("tank_server_room_commands_total", "Commands applied to each room's world by type", (double)sample.commands[type], 
+                           "room=\"" + std::to_string(sample.id) + "\",command=\"" + SimCommandTypeName((SimCommandType)type) + "\"");
+        }
+    }
+    for (const RoomMetricSample& sample : roomSamples) {
+        std::string labels = "room=\"" + std::to_string(sample.id) + "\"";
+        const double quantiles[] = { 0.5, 0.99 };
+        for (double q : quantiles) {
+            writer.SummaryQuantile("tank_server_room_tick_seconds", "Time to run one room's snapshot tick since start", q, 
+                                   sample.tick.ValueAtQuantile(q) / 1e9, labels);
+        }
+        writer.SummaryTotals("tank_server_room_tick_seconds", sample.tick.sumNs / 1e9, sample.tick.count, labels);
+    }
+    
+    // 매치메이킹 - 대기 인원, 배정/취소 수, 방 생성/종료 수, 대기열에 들어가 방에 배정되기까지의 시간 (전체와 실력 구간별)
+    const MatchmakerStats& match = rooms.MatchStats();
+    writer.Gauge("tank_server_matchmaking_waiting", "Connected clients waiting for a room", (double)match.Waiting());
+    writer.Counter("tank_server_matchmaking_placed_total", "Clients placed into a room by the matchmaker", 
+                   (double)match.placed.load(std::memory_order_relaxed));
+    writer.Counter("tank_server_matchmaking_cancelled_total", "Clients that left before being placed", 
+                   (double)match.cancelled.load(std::memory_order_relaxed));
+    writer.Counter("tank_server_matchmaking_batches_total", "Matchmaker placement batches", (double)match.batches.load(std::memory_order_relaxed));
+    writer.Counter("tank_server_matchmaking_rooms_opened_total", "Rooms opened by the matchmaker", 
+                   (double)match.roomsOpened.load(std::memory_order_relaxed));
+    writer.Counter("tank_server_matchmaking_rooms_closed_total", "Empty rooms closed after the idle timeout", 
+                   (double)match.roomsClosed.load(std::memory_order_relaxed));
+    {
+        const double quantiles[] = { 0.5, 0.99 };
+        LatencyHistogramSnapshot queueTime = match.queueTime.Snapshot();
+        for (double q : quantiles) {
+            writer.SummaryQuantile("tank_server_matchmaking_queue_seconds", "Time from joining to room placement since start", q, 
+                                   queueTime.ValueAtQuantile(q) / 1e9, std::string());
+        }
+        writer.SummaryTotals("tank_server_matchmaking_queue_seconds", queueTime.sumNs / 1e9, queueTime.count, std::string());
+        for (size_t bucket = 0; bucket < MatchSkillBucketCount; bucket++) {
+            LatencyHistogramSnapshot skill = match.queueTimeBySkill[bucket].Snapshot();
+            if (skill.count == 0) {
+                continue;
+            }
+            std::string labels = "skill=\"" + std::to_string(bucket) + "\"";
+            for (double q : quantiles) {
+                writer.SummaryQuantile("tank_server_matchmaking_skill_queue_seconds", "Time from joining to room placement by skill bucket", q, 
+                                       skill.ValueAtQuantile(q) / 1e9, labels);
+            }
+            writer.SummaryTotals("tank_server_matchmaking_skill_queue_seconds", skill.sumNs / 1e9, skill.count, labels);
+        }
+    }
+    
+    // 스냅샷 형식별 송신량 - 클라이언트당 초당 바이트는 rate(bytes_total) / clients
+    for (size_t f = 0; f < WorldMetricTotals::FormatCount; f++) {
+        writer.Gauge("tank_server_snapshot_clients", "Clients receiving each snapshot format", totals.snapshotClients[f], 
+                     "format=\"" + std::string(SnapshotFormatName(WorldMetricTotals::Formats[f])) + "\"");
+    }
+    for (size_t f = 0; f < WorldMetricTotals::FormatCount; f++) {
+        writer.Counter("tank_server_snapshot_bytes_total", "Snapshot payload bytes sent (size x recipients) by format", totals.snapshotBytes[f], 
+                       "format=\"" + std::string(SnapshotFormatName(WorldMetricTotals::Formats[f])) + "\"");
+    }
+    for (size_t f = 0; f < WorldMetricTotals::FormatCount; f++) {
+        writer.Counter("tank_server_snapshot_deliveries_total", "Snapshots delivered to clients by format", totals.snapshotDeliveries[f], 
+                       "format=\"" + std::string(SnapshotFormatName(WorldMetricTotals::Formats[f])) + "\"");
+    }
+    writer.Counter("tank_server_moves_out_of_order_total", "Sequenced moves dropped because a newer one was already applied", 
+                   totals.outOfOrderMoves);
+    writer.Counter("tank_server_moves_compact_out_of_range_total", "Moves outside the int16 compact position range (clamped in compact and delta snapshots)", 
+                   totals.compactOutOfRangeMoves);
+    writer.Counter("tank_server_lod_entries_sent_total", "Tank positions sent by the per-client priority scheduler", totals.lodSent);
+    writer.Counter("tank_server_lod_entries_deferred_total", "Due tank positions held back because a client's per-tick budget was full", 
+                   totals.lodDeferred);
+    writer.Counter("tank_server_dead_reckoning_forwarded_total", "Tank positions put in float/compact snapshots while dead reckoning is on", 
+                   totals.deadReckoningForwarded);
+    writer.Counter("tank_server_dead_reckoning_suppressed_total", "Tank position changes left out because the extrapolation error was within the threshold", 
+                   totals.deadReckoningSuppressed);
+    writer.Gauge("tank_server_send_backlog_clients", "Clients whose send queue is above the high-water mark", 
+                 totals.backlogCoalescing, "state=\"coalescing\"");
+    writer.Gauge("tank_server_send_backlog_clients", "Clients whose send queue is above the high-water mark", 
+                 totals.backlogDropping, "state=\"dropping\"");
+    writer.Counter("tank_server_send_backlog_skipped_total", "Position snapshots withheld from clients with a backed-up send queue", 
+                   totals.backlogSkipped);
+    writer.Counter("tank_server_send_backlog_coalesced_total", "Coalesced position updates sent to clients with a backed-up send queue", 
+                   totals.backlogCoalesced);
+    writer.Counter("tank_server_send_backlog_dropped_bullets_total", "Bullet spawns not sent because the client's send queue was above the drop level", 
+                   totals.backlogDroppedBullets);
+    writer.Counter("tank_server_send_backlog_disconnects_total", "Clients disconnected because their send queue did not drain", 
+                   totals.backlogDisconnects);
+    writer.Gauge("tank_server_projectiles_live", "Server-simulated shells in flight", totals.projectilesLive);
+    writer.Counter("tank_server_projectiles_spawned_total", "Shells spawned for server-authoritative hit detection", totals.projectilesSpawned);
+    writer.Counter("tank_server_projectile_hits_total", "Shells that hit a tank", totals.projectileHits);
+    writer.Counter("tank_server_projectile_kills_total", "Tanks destroyed by server-detected hits", totals.projectileKills);
+    writer.Counter("tank_server_projectiles_expired_total", "Shells that hit the ground or outlived their lifetime", totals.projectilesExpired);
+    writer.Counter("tank_server_projectiles_dropped_total", "Shells not simulated because the room's pool was full", totals.projectilesDropped);
+    writer.Counter("tank_server_hit_reports_ignored_total", "Client health/destroy reports ignored under server-authoritative hits", 
+                   totals.ignoredHitReports);
+    writer.Counter("tank_server_lag_rewound_shots_total", "Shells caught up from the shooter's view time by lag compensation", 
+                   totals.lagRewoundShots);
+    writer.Counter("tank_server_lag_rewind_seconds_total", "Sum of per-shell rewind (shooter RTT, capped); divide by rewound shots for the average", 
+                   totals.lagRewindSeconds);
+    writer.Counter("tank_server_lag_rewound_targets_total", "Tank positions interpolated from pose history while catching up shells", 
+                   totals.lagRewoundTargets);
+    writer.Counter("tank_server_lag_clamped_targets_total", "Rewound tank positions older than the pose history (oldest kept pose used)", 
+                   totals.lagClampedTargets);
+    writer.Counter("tank_server_lag_rewind_hits_total", "Shells that hit while being caught up from the shooter's view time", 
+                   totals.lagRewindHits);
+    writer.Gauge("tank_server_pose_history_bytes", "Memory held by per-tank pose history ring buffers", totals.poseHistoryBytes);
+    {
+        std::lock_guard<std::mutex> lock(sendQueueSampleMutex);
+        for (const auto& room : sendQueueSamples) {
+            for (const std::pair<int, uint32_t>& sample : room.second) {
+                writer.Gauge("tank_server_client_send_queue_bytes", "ProudNet send queue size per client (sampled every second)", 
+                             (double)sample.second, "client=\"" + std::to_string(sample.first) + "\"");
+            }
+        }
+    }
+    writer.Counter("tank_server_snapshot_full_fallbacks_total", "Delta clients sent a full snapshot (no acknowledged baseline in history)", 
+                   totals.snapshotFullFallbacks);
+    
+    AsyncLog& log = AsyncLog::Instance();
+    writer.Counter("tank_server_log_written_total", "Log records written", (double)log.WrittenCount());
+    writer.Counter("tank_server_log_dropped_total", "Log records dropped because a ring was full", (double)log.DroppedCount());
+    
+    return writer.Text();
+}
+
+// 로그 레벨 조회/변경
+void TankServer::ConfigureLog(const string& input) {
+    std::istringstream iss(input);
+    std::string cmd, categoryName, levelName;
+    
+    iss >> cmd >> categoryName >> levelName;
+    
+    AsyncLog& log = AsyncLog::Instance();
+    if (!categoryName.empty()) {
+        LogLevel level;
+        if (!ParseLogLevel(levelName, level)) {
+            DebugLog("Usage: log [category|all level]");
+            return;
+        }
+        
+        LogCategory category;
+        if (categoryName == "all") {
+            log.SetAllLevels(level);
+        }
+        else if (ParseLogCategory(categoryName, category)) {
+            log.SetLevel(category, level);
+        }
+        else {
+            DebugLog("Unknown log category: " + categoryName);
+            return;
+        }
+    }
+    
+    DebugLog("========== Log Levels ==========");
+    for (int i = 0; i < (int)LogCategory::Count; i++) {
+        LogCategory category = (LogCategory)i;
+        DebugLog(std::string(LogCategoryName(category)) + ": " + LogLevelName(log.GetLevel(category)));
+    }
+    DebugLog("Written: " + std::to_string(log.WrittenCount()) + ", dropped: " + std::to_string(log.DroppedCount()));
+    DebugLog("================================");
 }
 
 // 탱크 체력 정보 출력
 void TankServer::ShowTankHealth(const string& input) {
-    std::lock_guard<std::mutex> lock(mutex);
-    
     std::istringstream iss(input);
     std::string cmd;
     int targetId = -1;
@@ -678,39 +1497,13 @@ void TankServer::ShowTankHealth(const string& input) {
     iss >> cmd;
     iss >> targetId;
     
-    if (targetId == -1) {
-        // 모든 탱크의 체력 정보 출력
-        DebugLog("========== Tank Health Status ==========");
-        for (const auto& tank : tanks) {
-            string healthStatus = tank.second.isDestroyed ? "DESTROYED" : 
-                                   std::to_string(tank.second.currentHealth) + "/" + std::to_string(tank.second.maxHealth);
-            DebugLog("Tank " + std::to_string(static_cast<int>(tank.first)) + ": " + healthStatus);
-        }
-        DebugLog("=======================================");
-    } else {
-        // 특정 탱크의 체력 정보 출력
-        try {
-            // 적절한 HostID 찾기
-            ::Proud::HostID targetHostId = FindHostIDById(targetId);
-            
-            if (targetHostId != ::Proud::HostID_None && tanks.find(targetHostId) != tanks.end()) {
-                const TankInfo& tank = tanks[targetHostId];
-                string healthStatus = tank.isDestroyed ? "DESTROYED" : 
-                                       std::to_string(tank.currentHealth) + "/" + std::to_string(tank.maxHealth);
-                DebugLog("Tank " + std::to_string(targetId) + " health: " + healthStatus);
-            } else {
-                DebugLog("Tank with ID " + std::to_string(targetId) + " not found");
-            }
-        } catch (const std::exception& ex) {
-            DebugLog("Invalid tank ID format: " + std::string(ex.what()));
-        }
-    }
+    TankCommand command = MakeTankCommand(SimCommandType::PrintHealth, ::Proud::HostID_None);
+    command.console = SimConsoleArgs{ targetId, 0.0f, 0.0f, 0.0f };
+    rooms.DispatchConsole(command);
 }
 
 // 탱크에 데미지 적용
 void TankServer::ApplyDamageToTank(const string& input) {
-    std::lock_guard<std::mutex> lock(mutex);
-    
     std::istringstream iss(input);
     std::string cmd;
     int targetId = 0;
@@ -719,49 +1512,9 @@ void TankServer::ApplyDamageToTank(const string& input) {
     iss >> cmd >> targetId >> damageAmount;
     
     if (targetId > 0 && damageAmount > 0) {
-        try {
-            // 적절한 HostID 찾기
-            ::Proud::HostID targetHostId = FindHostIDById(targetId);
-            
-            if (targetHostId != ::Proud::HostID_None && tanks.find(targetHostId) != tanks.end()) {
-                TankInfo& tank = tanks[targetHostId];
-                
-                // 이미 파괴된 탱크라면 처리하지 않음
-                if (tank.isDestroyed) {
-                    DebugLog("Tank " + std::to_string(targetId) + " is already destroyed");
-                    return;
-                }
-                
-                // 체력 감소
-                tank.currentHealth = std::max(0.0f, tank.currentHealth - damageAmount);
-                
-                // 파괴 여부 확인
-                bool wasDestroyed = tank.currentHealth <= 0;
-                tank.isDestroyed = wasDestroyed;
-                
-                // 클라이언트에게 체력 업데이트 전송
-                for (const auto& clientPair : tanks) {
-                    ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                    
-                    tankProxy.OnTankHealthUpdated(clientPair.first, rmiCtx, targetId, 
-                                                 tank.currentHealth, tank.maxHealth);
-                    
-                    // 파괴된 경우 파괴 이벤트도 전송
-                    if (wasDestroyed) {
-                        tankProxy.OnTankDestroyed(clientPair.first, rmiCtx, targetId, 0); // 서버에 의한 파괴는 0으로 표시
-                    }
-                }
-                
-                string result = wasDestroyed ? "DESTROYED" : 
-                                std::to_string(tank.currentHealth) + "/" + std::to_string(tank.maxHealth);
-                DebugLog("Applied " + std::to_string(damageAmount) + " damage to tank " + std::to_string(targetId) 
-                     + ". New health: " + result);
-            } else {
-                DebugLog("Tank with ID " + std::to_string(targetId) + " not found");
-            }
-        } catch (const std::exception& ex) {
-            DebugLog("Invalid parameters: " + std::string(ex.what()));
-        }
+        TankCommand command = MakeTankCommand(SimCommandType::Damage, ::Proud::HostID_None);
+        command.console = SimConsoleArgs{ targetId, damageAmount, 0.0f, 0.0f };
+        rooms.DispatchConsole(command);
     } else {
         DebugLog("Invalid parameters. Format: damage id amount");
     }
@@ -769,8 +1522,6 @@ void TankServer::ApplyDamageToTank(const string& input) {
 
 // 탱크 치유
 void TankServer::HealTank(const string& input) {
-    std::lock_guard<std::mutex> lock(mutex);
-    
     std::istringstream iss(input);
     std::string cmd;
     int targetId = 0;
@@ -779,46 +1530,9 @@ void TankServer::HealTank(const string& input) {
     iss >> cmd >> targetId >> healAmount;
     
     if (targetId > 0 && healAmount > 0) {
-        try {
-            // 적절한 HostID 찾기
-            ::Proud::HostID targetHostId = FindHostIDById(targetId);
-            
-            if (targetHostId != ::Proud::HostID_None && tanks.find(targetHostId) != tanks.end()) {
-                TankInfo& tank = tanks[targetHostId];
-                
-                // 이미 파괴된 탱크라면 처리하지 않음
-                if (tank.isDestroyed) {
-                    DebugLog("Tank " + std::to_string(targetId) + " is destroyed and cannot be healed");
-                    return;
-                }
-                
-                // 이미 최대 체력이라면 처리하지 않음
-                if (tank.currentHealth >= tank.maxHealth) {
-                    DebugLog("Tank " + std::to_string(targetId) + " already has full health");
-                    return;
-                }
-                
-                // 체력 회복 (최대 체력 초과하지 않도록)
-                float oldHealth = tank.currentHealth;
-                tank.currentHealth = std::min(tank.maxHealth, tank.currentHealth + healAmount);
-                float actualHeal = tank.currentHealth - oldHealth;
-                
-                // 클라이언트에게 체력 업데이트 전송
-                for (const auto& clientPair : tanks) {
-                    ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                    
-                    tankProxy.OnTankHealthUpdated(clientPair.first, rmiCtx, targetId, 
-                                                 tank.currentHealth, tank.maxHealth);
-                }
-                
-                DebugLog("Healed tank " + std::to_string(targetId) + " for " + std::to_string(actualHeal) 
-                     + " points. New health: " + std::to_string(tank.currentHealth) + "/" + std::to_string(tank.maxHealth));
-            } else {
-                DebugLog("Tank with ID " + std::to_string(targetId) + " not found");
-            }
-        } catch (const std::exception& ex) {
-            DebugLog("Invalid parameters: " + std::string(ex.what()));
-        }
+        TankCommand command = MakeTankCommand(SimCommandType::Heal, ::Proud::HostID_None);
+        command.console = SimConsoleArgs{ targetId, healAmount, 0.0f, 0.0f };
+        rooms.DispatchConsole(command);
     } else {
         DebugLog("Invalid parameters. Format: heal id amount");
     }
@@ -826,8 +1540,6 @@ void TankServer::HealTank(const string& input) {
 
 // 탱크 리스폰
 void TankServer::RespawnTank(const string& input) {
-    std::lock_guard<std::mutex> lock(mutex);
-    
     std::istringstream iss(input);
     std::string cmd;
     int targetId = 0;
@@ -837,55 +1549,21 @@ void TankServer::RespawnTank(const string& input) {
     iss >> cmd >> targetId >> posX >> posY;
     
     if (targetId > 0) {
-        try {
-            // 적절한 HostID 찾기
-            ::Proud::HostID targetHostId = FindHostIDById(targetId);
-            
-            if (targetHostId != ::Proud::HostID_None && tanks.find(targetHostId) != tanks.end()) {
-                TankInfo& tank = tanks[targetHostId];
-                
-                // 탱크 정보 업데이트
-                tank.posX = posX;
-                tank.posY = posY;
-                tank.currentHealth = tank.maxHealth; // 체력 회복
-                tank.isDestroyed = false; // 파괴 상태 해제
-                
-                // 클라이언트에게 리스폰 정보 전송
-                for (const auto& clientPair : tanks) {
-                    ::Proud::RmiContext rmiCtx = CreateServerRmiContext();
-                    
-                    tankProxy.OnTankSpawned(clientPair.first, rmiCtx, targetId, posX, posY, 
-                                           tank.direction, tank.tankType, tank.maxHealth);
-                }
-                
-                DebugLog("Respawned tank " + std::to_string(targetId) + " at position (" + std::to_string(posX) + "," + std::to_string(posY) 
-                     + ") with full health");
-            } else {
-                DebugLog("Tank with ID " + std::to_string(targetId) + " not found");
-            }
-        } catch (const std::exception& ex) {
-            DebugLog("Invalid parameters: " + std::string(ex.what()));
-        }
+        TankCommand command = MakeTankCommand(SimCommandType::Respawn, ::Proud::HostID_None);
+        command.console = SimConsoleArgs{ targetId, 0.0f, posX, posY };
+        rooms.DispatchConsole(command);
     } else {
         DebugLog("Invalid parameters. Format: respawn id x y");
     }
 }
 
-// 클라이언트 ID로 HostID 찾기
-::Proud::HostID TankServer::FindHostIDById(int clientId) {
-    for (const auto& tank : tanks) {
-        if ((int)tank.first == clientId) {
-            return tank.first;
-        }
-    }
-    return ::Proud::HostID_None; // 찾지 못한 경우
-}
-
 // 메인 함수
-int main() {
+int main(int argc, char* argv[]) {
     srand(static_cast<unsigned int>(time(nullptr)));
     
-    TankServer tankServer;
+    ServerConfig config = ParseServerConfig(argc, argv);
+    
+    TankServer tankServer(config);
     tankServer.Start();
     
     return 0;
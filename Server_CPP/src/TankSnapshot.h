@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// OnTankSnapshot RMI의 snapshot 바이트 배열 형식
+// 항목 하나당 16바이트: clientId(int32), posX(float), posY(float), direction(float) - little-endian
+
+// 틱 스냅샷(OnTankSnapshot)을 받는 최소 프로토콜 리비전
+// SendHello를 보내지 않는 이전 클라이언트는 탱크별 OnTankPositionUpdated를 계속 받습니다
+static const int TickSnapshotProtocolRevision = 1;
+
+struct TankSnapshotEntry {
+    int32_t clientId;
+    float posX;
+    float posY;
+    float direction;
+};
+
+static const size_t TankSnapshotEntrySize = 16;
+
+// dst 위치에 항목 하나를 기록 (dst는 TankSnapshotEntrySize 이상 확보되어 있어야 함)
+inline void WriteTankSnapshotEntry(uint8_t* dst, const TankSnapshotEntry& entry) {
+    std::memcpy(dst + 0, &entry.clientId, 4);
+    std::memcpy(dst + 4, &entry.posX, 4);
+    std::memcpy(dst + 8, &entry.posY, 4);
+    std::memcpy(dst + 12, &entry.direction, 4);
+}
+
+// src 위치에서 항목 하나를 읽음
+inline TankSnapshotEntry ReadTankSnapshotEntry(const uint8_t* src) {
+    TankSnapshotEntry entry;
+    std::memcpy(&entry.clientId, src + 0, 4);
+    std::memcpy(&entry.posX, src + 4, 4);
+    std::memcpy(&entry.posY, src + 8, 4);
+    std::memcpy(&entry.direction, src + 12, 4);
+    return entry;
+}
+
+// 바이트 길이로부터 항목 수 계산 (남는 바이트는 무시)
+inline size_t TankSnapshotEntryCount(size_t byteLength) {
+    return byteLength / TankSnapshotEntrySize;
+}
+
+// OnWorldSnapshot RMI의 world 바이트 배열 형식 (늦게 들어온 클라이언트에게 보내는 방 전체 상태)
+// 항목 하나당 32바이트: clientId(int32), posX(float), posY(float), direction(float), tankType(int32),
+//                       currentHealth(float), maxHealth(float), flags(uint32, TankWorldFlag_*) - little-endian
+struct TankWorldEntry {
+    int32_t clientId;
+    float posX;
+    float posY;
+    float direction;
+    int32_t tankType;
+    float currentHealth;
+    float maxHealth;
+    uint32_t flags;
+};
+
+static const size_t TankWorldEntrySize = 32;
+static const uint32_t TankWorldFlag_Destroyed = 1;
+
+inline void WriteTankWorldEntry(uint8_t* dst, const TankWorldEntry& entry) {
+    std::memcpy(dst + 0, &entry.clientId, 4);
+    std::memcpy(dst + 4, &entry.posX, 4);
+    std::memcpy(dst + 8, &entry.posY, 4);
+    std::memcpy(dst + 12, &entry.direction, 4);
+    std::memcpy(dst + 16, &entry.tankType, 4);
+    std::memcpy(dst + 20, &entry.currentHealth, 4);
+    std::memcpy(dst + 24, &entry.maxHealth, 4);
+    std::memcpy(dst + 28, &entry.flags, 4);
+}
+
+inline TankWorldEntry ReadTankWorldEntry(const uint8_t* src) {
+    TankWorldEntry entry;
+    std::memcpy(&entry.clientId, src + 0, 4);
+    std::memcpy(&entry.posX, src + 4, 4);
+    std::memcpy(&entry.posY, src + 8, 4);
+    std::memcpy(&entry.direction, src + 12, 4);
+    std::memcpy(&entry.tankType, src + 16, 4);
+    std::memcpy(&entry.currentHealth, src + 20, 4);
+    std::memcpy(&entry.maxHealth, src + 24, 4);
+    std::memcpy(&entry.flags, src + 28, 4);
+    return entry;
+}
+
+// OnTanksOutOfRange RMI의 clientIds 바이트 배열 형식 (관심 영역 밖으로 나간 탱크)
+// 항목 하나당 4바이트: clientId(int32) - little-endian
+static const size_t TankOutOfRangeEntrySize = 4;
+
+inline void WriteTankOutOfRangeEntry(uint8_t* dst, int32_t clientId) {
+    std::memcpy(dst, &clientId, 4);
+}
+
+inline int32_t ReadTankOutOfRangeEntry(const uint8_t* src) {
+    int32_t clientId;
+    std::memcpy(&clientId, src, 4);
+    return clientId;
+}
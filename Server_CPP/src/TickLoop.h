@@ -0,0 +1,169 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// 틱 루프 통계 - 마지막 TakeStats() 호출 이후 구간 기준
+struct TickStats {
+    uint64_t tickCount = 0;        // 구간 내 실행된 틱 수
+    uint64_t overrunCount = 0;     // 틱 간격을 넘긴 틱 수
+    double avgDurationMs = 0.0;    // 틱 처리 시간 평균
+    double maxDurationMs = 0.0;    // 틱 처리 시간 최대
+    double avgJitterMs = 0.0;      // 예정 시각 대비 시작 지연 평균
+    double maxJitterMs = 0.0;      // 예정 시각 대비 시작 지연 최대
+    uint32_t lastTickId = 0;
+};
+
+// 틱 루프 누적 값 - 잠금 없이 읽을 수 있음 (메트릭 수집용)
+struct TickTotals {
+    uint64_t tickCount = 0;
+    uint64_t overrunCount = 0;
+    double durationSumMs = 0.0;
+    double lastDurationMs = 0.0;
+    int64_t lastTickEndNs = 0;     // 마지막 틱이 끝난 시각 (steady_clock), 아직 없으면 0
+};
+
+// TickLoop - 고정 주기로 콜백을 호출하는 전용 스레드
+// 예정 시각(steady_clock) 기준으로 sleep_until 하므로 처리 시간이 누적 오차를 만들지 않습니다.
+// 한 주기 이상 밀리면 건너뛰고 현재 시각으로 재정렬합니다.
+// IdleFunc를 주면 틱 사이에 sleep 대신 호출하므로, 틱 스레드가 다른 작업(명령 큐 처리 등)을 함께 맡을 수 있습니다.
+class TickLoop {
+public:
+    using TickFunc = std::function<void(uint32_t tickId)>;
+    // 다음 틱 예정 시각 전까지 할 일을 처리 - 일이 없으면 deadline까지 대기해야 함 (반복 호출됨)
+    using IdleFunc = std::function<void(std::chrono::steady_clock::time_point deadline)>;
+
+    ~TickLoop() { Stop(); }
+
+    void Start(int tickRateHz, TickFunc func, IdleFunc idle = IdleFunc()) {
+        Stop();
+        if (tickRateHz <= 0) {
+            tickRateHz = 1;
+        }
+        interval = std::chrono::nanoseconds(1000000000LL / tickRateHz);
+        tickFunc = std::move(func);
+        idleFunc = std::move(idle);
+        running = true;
+        worker = std::thread([this]() { Run(); });
+    }
+
+    void Stop() {
+        running = false;
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    bool IsRunning() const { return running; }
+
+    double IntervalMs() const {
+        return std::chrono::duration<double, std::milli>(interval).count();
+    }
+
+    // 시작 이후 누적 값 (statsMutex를 잡지 않음)
+    TickTotals Totals() const {
+        TickTotals totals;
+        totals.tickCount = totalTickCount.load(std::memory_order_relaxed);
+        totals.overrunCount = totalOverrunCount.load(std::memory_order_relaxed);
+        totals.durationSumMs = totalDurationNs.load(std::memory_order_relaxed) / 1000000.0;
+        totals.lastDurationMs = lastDurationNs.load(std::memory_order_relaxed) / 1000000.0;
+        totals.lastTickEndNs = lastTickEndNs.load(std::memory_order_relaxed);
+        return totals;
+    }
+
+    // 구간 통계를 가져오고 초기화
+    TickStats TakeStats() {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        TickStats result = window;
+        if (result.tickCount > 0) {
+            result.avgDurationMs = durationSumMs / result.tickCount;
+            result.avgJitterMs = jitterSumMs / result.tickCount;
+        }
+        uint32_t lastTickId = window.lastTickId;
+        window = TickStats();
+        window.lastTickId = lastTickId;
+        durationSumMs = 0.0;
+        jitterSumMs = 0.0;
+        return result;
+    }
+
+private:
+    void Run() {
+        using Clock = std::chrono::steady_clock;
+        uint32_t tickId = 0;
+        Clock::time_point scheduled = Clock::now() + interval;
+
+        while (running) {
+            if (idleFunc) {
+                while (running && Clock::now() < scheduled) {
+                    idleFunc(scheduled);
+                }
+            } else {
+                std::this_thread::sleep_until(scheduled);
+            }
+
+            Clock::time_point start = Clock::now();
+            tickId++;
+            tickFunc(tickId);
+            Clock::time_point end = Clock::now();
+
+            double durationMs = std::chrono::duration<double, std::milli>(end - start).count();
+            double jitterMs = std::chrono::duration<double, std::milli>(start - scheduled).count();
+            bool overrun = (end - start) > interval;
+            
+            // 누적 값은 틱 스레드만 쓰므로 relaxed load/store로 충분
+            int64_t durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            totalTickCount.store(totalTickCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            totalDurationNs.store(totalDurationNs.load(std::memory_order_relaxed) + durationNs, std::memory_order_relaxed);
+            lastDurationNs.store(durationNs, std::memory_order_relaxed);
+            lastTickEndNs.store(std::chrono::duration_cast<std::chrono::nanoseconds>(end.time_since_epoch()).count(), std::memory_order_relaxed);
+            if (overrun) {
+                totalOverrunCount.store(totalOverrunCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(statsMutex);
+                window.tickCount++;
+                window.lastTickId = tickId;
+                durationSumMs += durationMs;
+                jitterSumMs += jitterMs;
+                if (durationMs > window.maxDurationMs) {
+                    window.maxDurationMs = durationMs;
+                }
+                if (jitterMs > window.maxJitterMs) {
+                    window.maxJitterMs = jitterMs;
+                }
+                if (overrun) {
+                    window.overrunCount++;
+                }
+            }
+
+            scheduled += interval;
+            // 한 주기 이상 밀렸으면 밀린 틱을 몰아서 실행하지 않고 재정렬
+            if (end > scheduled + interval) {
+                scheduled = end + interval;
+            }
+        }
+    }
+
+    std::chrono::nanoseconds interval{ 50000000 };
+    TickFunc tickFunc;
+    IdleFunc idleFunc;
+    std::atomic<bool> running{ false };
+    std::thread worker;
+
+    std::atomic<uint64_t> totalTickCount{ 0 };
+    std::atomic<uint64_t> totalOverrunCount{ 0 };
+    std::atomic<int64_t> totalDurationNs{ 0 };
+    std::atomic<int64_t> lastDurationNs{ 0 };
+    std::atomic<int64_t> lastTickEndNs{ 0 };
+
+    std::mutex statsMutex;
+    TickStats window;
+    double durationSumMs = 0.0;
+    double jitterSumMs = 0.0;
+};